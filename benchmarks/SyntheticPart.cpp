@@ -0,0 +1,156 @@
+#include "SyntheticPart.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <BRepBuilderAPI_MakeFace.hxx>
+#include <BRepBuilderAPI_MakePolygon.hxx>
+#include <BRepPrimAPI_MakeRevol.hxx>
+#include <gp_Pnt.hxx>
+
+#include <IntuiCAM/Toolpath/LatheProfile.h>
+
+namespace IntuiCAM {
+namespace Benchmarks {
+
+namespace {
+constexpr double kPi = 3.14159265358979323846;
+
+double grooveCenter(const SyntheticPartSpec& spec, int step, int groove) {
+    return spec.stepLength * (step + static_cast<double>(groove + 1) / (spec.groovesPerStep + 1));
+}
+
+// Closed half-section in (radius, z), starting on the axis at z = 0
+std::vector<std::pair<double, double>> halfSection(const SyntheticPartSpec& spec) {
+    std::vector<std::pair<double, double>> points;
+    points.emplace_back(0.0, 0.0);
+    points.emplace_back(spec.stepRadius(0), 0.0);
+
+    for (int step = 0; step < spec.steps; ++step) {
+        double radius = spec.stepRadius(step);
+        for (int groove = 0; groove < spec.groovesPerStep; ++groove) {
+            double center = grooveCenter(spec, step, groove);
+            double halfWidth = spec.grooveWidth / 2.0;
+            points.emplace_back(radius, center - halfWidth);
+            points.emplace_back(radius - spec.grooveDepth, center - halfWidth);
+            points.emplace_back(radius - spec.grooveDepth, center + halfWidth);
+            points.emplace_back(radius, center + halfWidth);
+        }
+
+        double shoulder = (step + 1) * spec.stepLength;
+        points.emplace_back(radius, shoulder);
+        if (step + 1 < spec.steps) {
+            points.emplace_back(spec.stepRadius(step + 1), shoulder);
+        }
+    }
+
+    double length = spec.length();
+    if (spec.boreDiameter > 0.0 && spec.boreDepth > 0.0) {
+        double boreRadius = spec.boreDiameter / 2.0;
+        points.emplace_back(boreRadius, length);
+        points.emplace_back(boreRadius, length - spec.boreDepth);
+        points.emplace_back(0.0, length - spec.boreDepth);
+    } else {
+        points.emplace_back(0.0, length);
+    }
+    return points;
+}
+}
+
+SyntheticPartSpec makeSpec(int complexity) {
+    SyntheticPartSpec spec;
+    complexity = std::max(1, complexity);
+
+    spec.steps = 1 + complexity;
+    spec.groovesPerStep = complexity > 1 ? 1 + complexity / 4 : 0;
+    spec.stepLength = std::max(20.0, (spec.groovesPerStep + 1) * (spec.grooveWidth + 4.0));
+
+    if (complexity > 1) {
+        spec.boreDiameter = 10.0;
+        spec.boreDepth = std::min(spec.length() / 2.0, 40.0);
+        spec.threadedSteps = 1;
+    }
+
+    // Keep the thinnest grooved step clear of the bore wall
+    double minimumDiameter = spec.boreDiameter + 2.0 * spec.grooveDepth + 8.0;
+    spec.baseDiameter = std::max(40.0, minimumDiameter + spec.steps * spec.stepDrop);
+    return spec;
+}
+
+gp_Ax1 turningAxis() {
+    return gp_Ax1(gp_Pnt(0.0, 0.0, 0.0), gp_Dir(0.0, 0.0, 1.0));
+}
+
+TopoDS_Shape buildShape(const SyntheticPartSpec& spec) {
+    BRepBuilderAPI_MakePolygon polygon;
+    for (const auto& point : halfSection(spec)) {
+        polygon.Add(gp_Pnt(point.first, 0.0, point.second));
+    }
+    polygon.Close();
+
+    BRepBuilderAPI_MakeFace face(polygon.Wire(), Standard_True);
+    BRepPrimAPI_MakeRevol revolution(face.Face(), turningAxis(), 2.0 * kPi);
+    return revolution.Shape();
+}
+
+Toolpath::ToolpathGenerationPipeline::PipelineInputs buildPipelineInputs(const SyntheticPartSpec& spec,
+                                                                         const TopoDS_Shape& shape) {
+    using Pipeline = Toolpath::ToolpathGenerationPipeline;
+
+    Pipeline::PipelineInputs inputs;
+    inputs.profile2D = Toolpath::LatheProfile::extractSegmentProfile(shape, turningAxis());
+    inputs.rawMaterialDiameter = spec.baseDiameter + 4.0;
+    inputs.rawMaterialLength = spec.length() + 10.0;
+    inputs.z0 = inputs.rawMaterialLength;
+    inputs.partLength = spec.length();
+
+    if (spec.boreDiameter > 0.0) {
+        Pipeline::DetectedFeature hole;
+        hole.type = "hole";
+        hole.depth = spec.boreDepth;
+        hole.diameter = spec.boreDiameter;
+        hole.coordinates = Geometry::Point3D(spec.length(), 0.0, 0.0);
+        hole.tool = "drill";
+        inputs.featuresToBeDrilled.push_back(hole);
+    }
+
+    for (int step = 0; step < spec.steps; ++step) {
+        double radius = spec.stepRadius(step);
+        for (int groove = 0; groove < spec.groovesPerStep; ++groove) {
+            Pipeline::DetectedFeature feature;
+            feature.type = "groove";
+            feature.depth = spec.grooveDepth;
+            feature.diameter = 2.0 * (radius - spec.grooveDepth);
+            feature.coordinates = Geometry::Point3D(grooveCenter(spec, step, groove), 0.0,
+                                                    radius - spec.grooveDepth);
+            feature.geometry["width"] = spec.grooveWidth;
+            feature.geometry["depth"] = spec.grooveDepth;
+            feature.tool = "grooving tool";
+            inputs.externalFeaturesToBeGrooved.push_back(feature);
+        }
+
+        Pipeline::DetectedFeature chamfer;
+        chamfer.type = "chamfer";
+        chamfer.coordinates = Geometry::Point3D((step + 1) * spec.stepLength, 0.0, radius);
+        chamfer.geometry["size"] = 0.5;
+        chamfer.tool = "chamfer tool";
+        inputs.featuresToBeChamfered.push_back(chamfer);
+
+        if (step >= spec.steps - spec.threadedSteps) {
+            Pipeline::DetectedFeature thread;
+            thread.type = "thread";
+            thread.diameter = 2.0 * radius;
+            thread.coordinates = Geometry::Point3D((step + 0.5) * spec.stepLength, 0.0, radius);
+            thread.geometry["pitch"] = spec.threadPitch;
+            thread.geometry["length"] = spec.stepLength;
+            thread.tool = "threading tool";
+            inputs.featuresToBeThreaded.push_back(thread);
+        }
+    }
+
+    return inputs;
+}
+
+} // namespace Benchmarks
+} // namespace IntuiCAM
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax1.hxx>
+
+#include <benchmark/benchmark.h>
+
+#include <IntuiCAM/Toolpath/ToolpathGenerationPipeline.h>
+
+namespace IntuiCAM {
+namespace Benchmarks {
+
+/**
+ * @brief Parameters of a synthetic turned part
+ *
+ * The part is a stepped shaft along +Z starting at z = 0. Its diameter drops
+ * by `stepDrop` at each step. Each step can carry rectangular grooves, an
+ * optional blind bore enters from the free end, and the last steps can be
+ * flagged as threaded (feature only, no helix geometry).
+ */
+struct SyntheticPartSpec {
+    int steps = 3;
+    double baseDiameter = 40.0;     // mm - diameter of the first (largest) step
+    double stepDrop = 2.0;          // mm - diameter reduction per step
+    double stepLength = 20.0;       // mm
+
+    int groovesPerStep = 1;
+    double grooveWidth = 3.0;       // mm
+    double grooveDepth = 1.0;       // mm
+
+    double boreDiameter = 0.0;      // mm - 0 for a solid part
+    double boreDepth = 0.0;         // mm
+
+    int threadedSteps = 0;          // counted from the free end
+    double threadPitch = 1.5;       // mm
+
+    double length() const { return steps * stepLength; }
+    double stepRadius(int step) const { return (baseDiameter - step * stepDrop) / 2.0; }
+};
+
+/**
+ * @brief Standard spec scaled by a single complexity knob
+ *
+ * Complexity 1 is a plain two-step shaft. Higher values add steps, grooves,
+ * a bore and threads.
+ */
+SyntheticPartSpec makeSpec(int complexity);
+
+/** @brief Turning axis used for all synthetic parts (world Z) */
+gp_Ax1 turningAxis();
+
+/** @brief Revolve the spec's half-section into a solid */
+TopoDS_Shape buildShape(const SyntheticPartSpec& spec);
+
+/**
+ * @brief Pipeline inputs for the part, with its extracted profile and features
+ */
+Toolpath::ToolpathGenerationPipeline::PipelineInputs buildPipelineInputs(const SyntheticPartSpec& spec,
+                                                                         const TopoDS_Shape& shape);
+
+/** @brief Register the standard complexity sweep (1, 4, 16) on a benchmark */
+inline void complexityRange(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("complexity");
+    for (int complexity : {1, 4, 16}) {
+        bench->Arg(complexity);
+    }
+}
+
+} // namespace Benchmarks
+} // namespace IntuiCAM
@@ -0,0 +1,172 @@
+#include "SyntheticPart.h"
+
+#include <algorithm>
+#include <memory>
+
+#include <IntuiCAM/Geometry/Types.h>
+#include <IntuiCAM/Toolpath/ChamferingOperation.h>
+#include <IntuiCAM/Toolpath/DrillingOperation.h>
+#include <IntuiCAM/Toolpath/ExternalRoughingOperation.h>
+#include <IntuiCAM/Toolpath/FacingOperation.h>
+#include <IntuiCAM/Toolpath/FinishingOperation.h>
+#include <IntuiCAM/Toolpath/GroovingOperation.h>
+#include <IntuiCAM/Toolpath/InternalRoughingOperation.h>
+#include <IntuiCAM/Toolpath/PartingOperation.h>
+#include <IntuiCAM/Toolpath/ThreadingOperation.h>
+
+using namespace IntuiCAM;
+using namespace IntuiCAM::Benchmarks;
+
+namespace {
+
+struct PartFixture {
+    SyntheticPartSpec spec;
+    TopoDS_Shape shape;
+    std::unique_ptr<Geometry::OCCTPart> part;
+};
+
+PartFixture makeFixture(const benchmark::State& state) {
+    PartFixture fixture;
+    fixture.spec = makeSpec(static_cast<int>(state.range(0)));
+    fixture.shape = buildShape(fixture.spec);
+    fixture.part = std::make_unique<Geometry::OCCTPart>(&fixture.shape);
+    return fixture;
+}
+
+// Time generateToolpath() for an operation configured from the part spec
+template <typename OperationT, typename MakeParameters>
+void runOperation(benchmark::State& state, MakeParameters makeParameters) {
+    PartFixture fixture = makeFixture(state);
+    auto tool = std::make_shared<Toolpath::Tool>(Toolpath::Tool::Type::Turning, "Benchmark tool");
+    OperationT operation("Benchmark", tool);
+    operation.setParameters(makeParameters(fixture.spec));
+
+    size_t moves = 0;
+    for (auto _ : state) {
+        auto toolpath = operation.generateToolpath(*fixture.part);
+        moves = toolpath ? toolpath->getMovementCount() : 0;
+        benchmark::DoNotOptimize(toolpath);
+    }
+    state.counters["moves"] = static_cast<double>(moves);
+}
+
+} // namespace
+
+static void BM_FacingOperation(benchmark::State& state) {
+    runOperation<Toolpath::FacingOperation>(state, [](const SyntheticPartSpec& spec) {
+        Toolpath::FacingOperation::Parameters params;
+        params.startZ = spec.length() + 2.0;
+        params.endZ = spec.length();
+        params.maxRadius = spec.stepRadius(0) + 2.0;
+        return params;
+    });
+}
+BENCHMARK(BM_FacingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_ExternalRoughingOperation(benchmark::State& state) {
+    runOperation<Toolpath::ExternalRoughingOperation>(state, [](const SyntheticPartSpec& spec) {
+        Toolpath::ExternalRoughingOperation::Parameters params;
+        params.startDiameter = spec.baseDiameter + 4.0;
+        params.endDiameter = 2.0 * spec.stepRadius(spec.steps - 1);
+        params.startZ = spec.length();
+        params.endZ = 0.0;
+        return params;
+    });
+}
+BENCHMARK(BM_ExternalRoughingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_InternalRoughingOperation(benchmark::State& state) {
+    runOperation<Toolpath::InternalRoughingOperation>(state, [](const SyntheticPartSpec& spec) {
+        Toolpath::InternalRoughingOperation::Parameters params;
+        double boreDiameter = spec.boreDiameter > 0.0 ? spec.boreDiameter : 10.0;
+        double boreDepth = spec.boreDepth > 0.0 ? spec.boreDepth : spec.length() / 2.0;
+        params.startDiameter = boreDiameter / 2.0;
+        params.endDiameter = boreDiameter;
+        params.startZ = spec.length();
+        params.endZ = spec.length() - boreDepth;
+        return params;
+    });
+}
+BENCHMARK(BM_InternalRoughingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_FinishingOperation(benchmark::State& state) {
+    runOperation<Toolpath::FinishingOperation>(state, [](const SyntheticPartSpec& spec) {
+        Toolpath::FinishingOperation::Parameters params;
+        params.startZ = spec.length();
+        params.endZ = 0.0;
+        return params;
+    });
+}
+BENCHMARK(BM_FinishingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_GroovingOperation(benchmark::State& state) {
+    runOperation<Toolpath::GroovingOperation>(state, [](const SyntheticPartSpec& spec) {
+        Toolpath::GroovingOperation::Parameters params;
+        params.grooveDiameter = 2.0 * (spec.stepRadius(0) - spec.grooveDepth);
+        params.grooveWidth = spec.grooveWidth;
+        params.grooveDepth = spec.grooveDepth;
+        params.grooveZ = spec.stepLength / 2.0;
+        return params;
+    });
+}
+BENCHMARK(BM_GroovingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_ChamferingOperation(benchmark::State& state) {
+    runOperation<Toolpath::ChamferingOperation>(state, [](const SyntheticPartSpec& spec) {
+        Toolpath::ChamferingOperation::Parameters params;
+        double diameter = 2.0 * spec.stepRadius(spec.steps - 1);
+        params.startZ = spec.length();
+        params.startDiameter = diameter - 2.0 * params.chamferSize;
+        params.endDiameter = diameter;
+        return params;
+    });
+}
+BENCHMARK(BM_ChamferingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_DrillingOperation(benchmark::State& state) {
+    runOperation<Toolpath::DrillingOperation>(state, [](const SyntheticPartSpec& spec) {
+        Toolpath::DrillingOperation::Parameters params;
+        params.holeDiameter = spec.boreDiameter > 0.0 ? spec.boreDiameter : 6.0;
+        params.holeDepth = spec.boreDepth > 0.0 ? spec.boreDepth : spec.length() / 2.0;
+        params.startZ = spec.length();
+        return params;
+    });
+}
+BENCHMARK(BM_DrillingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_ThreadingOperation(benchmark::State& state) {
+    PartFixture fixture = makeFixture(state);
+    const SyntheticPartSpec& spec = fixture.spec;
+    auto tool = std::make_shared<Toolpath::Tool>(Toolpath::Tool::Type::Threading, "Benchmark threading tool");
+
+    double diameter = 2.0 * spec.stepRadius(spec.steps - 1);
+    auto params = Toolpath::ThreadingOperation::getDefaultParameters(Toolpath::ThreadingOperation::ThreadForm::Metric,
+                                                                     diameter);
+    params.pitch = spec.threadPitch;
+    params.startZ = spec.length();
+    params.endZ = spec.length() - spec.stepLength;
+    params.threadLength = spec.stepLength;
+
+    Toolpath::ThreadingOperation operation;
+    for (auto _ : state) {
+        auto result = operation.generateToolpaths(*fixture.part, tool, params);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ThreadingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_PartingOperation(benchmark::State& state) {
+    PartFixture fixture = makeFixture(state);
+    auto tool = std::make_shared<Toolpath::Tool>(Toolpath::Tool::Type::Parting, "Benchmark parting tool");
+
+    auto params = Toolpath::PartingOperation::getDefaultParameters(fixture.spec.baseDiameter);
+    params.partingDiameter = fixture.spec.baseDiameter;
+    params.partingZ = 0.0;
+
+    Toolpath::PartingOperation operation;
+    for (auto _ : state) {
+        auto result = operation.generateToolpaths(*fixture.part, tool, params);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_PartingOperation)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,133 @@
+#include "SyntheticPart.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <IntuiCAM/PostProcessor/Types.h>
+#include <IntuiCAM/Simulation/Types.h>
+
+using namespace IntuiCAM;
+using namespace IntuiCAM::Benchmarks;
+
+namespace {
+
+// Discards everything it is given, so only formatting is measured
+class NullSink : public PostProcessor::GCodeSink {
+public:
+    NullSink() { setBuffer(buffer_, buffer_ + sizeof(buffer_)); }
+
+protected:
+    bool drain() override {
+        drained_ += static_cast<size_t>(cursor_ - begin_);
+        cursor_ = begin_;
+        return true;
+    }
+
+private:
+    char buffer_[64 * 1024];
+};
+
+struct TimelineFixture {
+    SyntheticPartSpec spec;
+    Toolpath::ToolpathGenerationPipeline pipeline;
+    std::vector<std::unique_ptr<Toolpath::Toolpath>> timeline;
+    std::vector<std::shared_ptr<Toolpath::Toolpath>> shared;
+    size_t moves = 0;
+};
+
+// Generate the part's timeline once; the benchmarks below only consume it
+std::unique_ptr<TimelineFixture> makeTimeline(const benchmark::State& state) {
+    auto fixture = std::make_unique<TimelineFixture>();
+    fixture->spec = makeSpec(static_cast<int>(state.range(0)));
+    TopoDS_Shape shape = buildShape(fixture->spec);
+
+    auto result = fixture->pipeline.executePipeline(buildPipelineInputs(fixture->spec, shape));
+    fixture->timeline = std::move(result.timeline);
+    for (const auto& toolpath : fixture->timeline) {
+        fixture->shared.push_back(std::make_shared<Toolpath::Toolpath>(*toolpath));
+        fixture->moves += toolpath->getMovementCount();
+    }
+    return fixture;
+}
+
+} // namespace
+
+static void BM_GenerateGCodeString(benchmark::State& state) {
+    auto fixture = makeTimeline(state);
+    PostProcessor::GCodeGenerator generator;
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::string program = generator.generateGCode(fixture->shared);
+        bytes = program.size();
+        benchmark::DoNotOptimize(program);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    state.counters["moves"] = static_cast<double>(fixture->moves);
+}
+BENCHMARK(BM_GenerateGCodeString)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_WriteGCodeSink(benchmark::State& state) {
+    auto fixture = makeTimeline(state);
+    PostProcessor::GCodeGenerator generator;
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        NullSink sink;
+        generator.writeGCode(fixture->shared, sink);
+        bytes = sink.bytesWritten();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    state.counters["moves"] = static_cast<double>(fixture->moves);
+}
+BENCHMARK(BM_WriteGCodeSink)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_CreateToolpathDisplayObjects(benchmark::State& state) {
+    auto fixture = makeTimeline(state);
+
+    for (auto _ : state) {
+        auto objects = fixture->pipeline.createToolpathDisplayObjects(fixture->timeline);
+        benchmark::DoNotOptimize(objects);
+    }
+    state.counters["moves"] = static_cast<double>(fixture->moves);
+}
+BENCHMARK(BM_CreateToolpathDisplayObjects)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
+
+static void BM_SimulateMaterialRemoval(benchmark::State& state) {
+    auto fixture = makeTimeline(state);
+    Simulation::MaterialSimulator simulator;
+    simulator.setStockCylinder(fixture->spec.baseDiameter + 4.0, fixture->spec.length() + 10.0);
+
+    for (auto _ : state) {
+        auto result = simulator.simulate(fixture->shared);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["moves"] = static_cast<double>(fixture->moves);
+}
+BENCHMARK(BM_SimulateMaterialRemoval)->Apply(complexityRange)->Unit(benchmark::kMillisecond);
+
+// Roughing passes of four moves each on a 100 mm bar, independent of the
+// pipeline, so the simulator's own cost per move is measured
+static void BM_SimulateRoughingPasses(benchmark::State& state) {
+    const int passes = static_cast<int>(state.range(0)) / 4;
+    auto toolpath = std::make_shared<Toolpath::Toolpath>("roughing",
+        std::make_shared<Toolpath::Tool>(Toolpath::Tool::Type::Turning, "T1"),
+        Toolpath::OperationType::ExternalRoughing);
+    for (int pass = 0; pass < passes; ++pass) {
+        const double radius = 20.0 - 10.0 * (pass + 1) / passes;
+        toolpath->addRapidMove(Geometry::Point3D(102.0, 0.0, radius + 1.0));
+        toolpath->addRapidMove(Geometry::Point3D(102.0, 0.0, radius));
+        toolpath->addLinearMove(Geometry::Point3D(20.0, 0.0, radius), 200.0);
+        toolpath->addLinearMove(Geometry::Point3D(20.0, 0.0, radius + 1.0), 200.0);
+    }
+
+    Simulation::MaterialSimulator simulator;
+    simulator.setStockCylinder(40.0, 100.0);
+    for (auto _ : state) {
+        auto result = simulator.simulate(*toolpath);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["moves"] = static_cast<double>(toolpath->getMovementCount());
+}
+BENCHMARK(BM_SimulateRoughingPasses)->ArgName("moves")->Arg(8000)->Unit(benchmark::kMillisecond);
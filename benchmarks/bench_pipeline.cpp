@@ -0,0 +1,31 @@
+#include "SyntheticPart.h"
+
+using namespace IntuiCAM;
+using namespace IntuiCAM::Benchmarks;
+
+// Complete pipeline on a synthetic part. The second argument is the stage
+// worker count: 1 runs serially, 0 uses all cores.
+static void BM_ExecutePipeline(benchmark::State& state) {
+    SyntheticPartSpec spec = makeSpec(static_cast<int>(state.range(0)));
+    TopoDS_Shape shape = buildShape(spec);
+    auto inputs = buildPipelineInputs(spec, shape);
+    inputs.maxParallelStages = static_cast<int>(state.range(1));
+
+    Toolpath::ToolpathGenerationPipeline pipeline;
+    size_t toolpaths = 0;
+    for (auto _ : state) {
+        auto result = pipeline.executePipeline(inputs);
+        if (!result.success) {
+            state.SkipWithError(result.errorMessage.c_str());
+            break;
+        }
+        toolpaths = result.timeline.size();
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["toolpaths"] = static_cast<double>(toolpaths);
+}
+BENCHMARK(BM_ExecutePipeline)
+    ->ArgNames({"complexity", "threads"})
+    ->ArgsProduct({{1, 4, 16}, {1, 0}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
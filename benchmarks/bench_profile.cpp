@@ -0,0 +1,43 @@
+#include "SyntheticPart.h"
+
+#include <IntuiCAM/Toolpath/LatheProfile.h>
+#include <IntuiCAM/Toolpath/ProfileCache.h>
+
+using namespace IntuiCAM;
+using namespace IntuiCAM::Benchmarks;
+
+// Full section-and-sort path; the profile cache is disabled for the run
+static void BM_ExtractSegmentProfile(benchmark::State& state) {
+    TopoDS_Shape shape = buildShape(makeSpec(static_cast<int>(state.range(0))));
+
+    auto& cache = Toolpath::ProfileCache::instance();
+    size_t capacity = cache.getCapacity();
+    cache.setCapacity(0);
+
+    size_t segments = 0;
+    for (auto _ : state) {
+        auto profile = Toolpath::LatheProfile::extractSegmentProfile(shape, turningAxis());
+        segments = profile.segments.size();
+        benchmark::DoNotOptimize(profile);
+    }
+
+    cache.setCapacity(capacity);
+    state.counters["segments"] = static_cast<double>(segments);
+}
+BENCHMARK(BM_ExtractSegmentProfile)->Apply(complexityRange)->Unit(benchmark::kMillisecond);
+
+// Repeated extraction of an unchanged shape, served from the profile cache
+static void BM_ExtractSegmentProfileCached(benchmark::State& state) {
+    TopoDS_Shape shape = buildShape(makeSpec(static_cast<int>(state.range(0))));
+
+    auto& cache = Toolpath::ProfileCache::instance();
+    cache.clear();
+    Toolpath::LatheProfile::extractSegmentProfile(shape, turningAxis());
+
+    for (auto _ : state) {
+        auto profile = Toolpath::LatheProfile::extractSegmentProfile(shape, turningAxis());
+        benchmark::DoNotOptimize(profile);
+    }
+    cache.clear();
+}
+BENCHMARK(BM_ExtractSegmentProfileCached)->Apply(complexityRange)->Unit(benchmark::kMicrosecond);
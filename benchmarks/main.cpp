@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <IntuiCAM/Common/Version.h>
+
+// Writes a JSON report unless the caller chose another output, so results can
+// be archived and compared across versions:
+//   intuicam_benchmarks                       -> intuicam_benchmarks.json
+//   intuicam_benchmarks --benchmark_out=x.json
+int main(int argc, char** argv) {
+    std::vector<char*> args(argv, argv + argc);
+
+    bool hasOutput = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--benchmark_out=", 16) == 0) {
+            hasOutput = true;
+        }
+    }
+
+    std::string defaultOutput = "--benchmark_out=intuicam_benchmarks.json";
+    std::string defaultFormat = "--benchmark_out_format=json";
+    if (!hasOutput) {
+        args.push_back(defaultOutput.data());
+        args.push_back(defaultFormat.data());
+    }
+
+    int benchmarkArgc = static_cast<int>(args.size());
+    benchmark::Initialize(&benchmarkArgc, args.data());
+    if (benchmark::ReportUnrecognizedArguments(benchmarkArgc, args.data())) {
+        return 1;
+    }
+
+    benchmark::AddCustomContext("intuicam_version", IntuiCAM::Common::Version::getVersionString());
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,331 @@
+#include "BatchConfig.h"
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <locale>
+#include <map>
+#include <sstream>
+
+namespace IntuiCAM {
+namespace Batch {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string trim(const std::string& text) {
+    size_t begin = 0;
+    size_t end = text.size();
+    while (begin < end && std::isspace(static_cast<unsigned char>(text[begin]))) ++begin;
+    while (end > begin && std::isspace(static_cast<unsigned char>(text[end - 1]))) --end;
+    return text.substr(begin, end - begin);
+}
+
+std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return text;
+}
+
+bool parseDouble(const std::string& text, double& value) {
+    std::istringstream stream(text);
+    stream.imbue(std::locale::classic());
+    stream >> value;
+    return stream && stream.peek() == std::char_traits<char>::eof();
+}
+
+bool parseInt(const std::string& text, int& value) {
+    double number = 0.0;
+    if (!parseDouble(text, number) || number != static_cast<int>(number)) {
+        return false;
+    }
+    value = static_cast<int>(number);
+    return true;
+}
+
+bool parseBool(const std::string& text, bool& value) {
+    const std::string lower = toLower(text);
+    if (lower == "true" || lower == "yes" || lower == "on" || lower == "1") {
+        value = true;
+        return true;
+    }
+    if (lower == "false" || lower == "no" || lower == "off" || lower == "0") {
+        value = false;
+        return true;
+    }
+    return false;
+}
+
+bool applyOperations(const std::string& list, BatchConfig::Pipeline::PipelineInputs& inputs,
+                     std::string& error) {
+    const std::map<std::string, bool BatchConfig::Pipeline::PipelineInputs::*> flags = {
+        {"facing", &BatchConfig::Pipeline::PipelineInputs::facing},
+        {"drilling", &BatchConfig::Pipeline::PipelineInputs::drilling},
+        {"internal_roughing", &BatchConfig::Pipeline::PipelineInputs::internalRoughing},
+        {"external_roughing", &BatchConfig::Pipeline::PipelineInputs::externalRoughing},
+        {"internal_finishing", &BatchConfig::Pipeline::PipelineInputs::internalFinishing},
+        {"external_finishing", &BatchConfig::Pipeline::PipelineInputs::externalFinishing},
+        {"internal_grooving", &BatchConfig::Pipeline::PipelineInputs::internalGrooving},
+        {"external_grooving", &BatchConfig::Pipeline::PipelineInputs::externalGrooving},
+        {"chamfering", &BatchConfig::Pipeline::PipelineInputs::chamfering},
+        {"threading", &BatchConfig::Pipeline::PipelineInputs::threading},
+        {"parting", &BatchConfig::Pipeline::PipelineInputs::parting},
+    };
+
+    // The list is exhaustive: anything not named is switched off
+    for (const auto& flag : flags) {
+        inputs.*flag.second = false;
+    }
+
+    std::istringstream stream(list);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        name = toLower(trim(name));
+        if (name.empty()) {
+            continue;
+        }
+        auto it = flags.find(name);
+        if (it == flags.end()) {
+            error = "unknown operation '" + name + "'";
+            return false;
+        }
+        inputs.*it->second = true;
+    }
+
+    inputs.machineInternalFeatures = inputs.drilling || inputs.internalRoughing ||
+                                     inputs.internalFinishing || inputs.internalGrooving;
+    return true;
+}
+
+bool parseMachineType(const std::string& text, PostProcessor::PostProcessor::MachineType& type) {
+    const std::string lower = toLower(text);
+    for (auto candidate : PostProcessor::PostProcessor::getSupportedMachines()) {
+        if (toLower(PostProcessor::PostProcessor::getMachineName(candidate)) == lower) {
+            type = candidate;
+            return true;
+        }
+    }
+    if (lower == "generic") {
+        type = PostProcessor::PostProcessor::MachineType::GenericLathe;
+        return true;
+    }
+    return false;
+}
+
+bool applySetting(BatchConfig& config, const std::string& section, const std::string& key,
+                  const std::string& value, std::string& error) {
+    auto& inputs = config.inputs;
+    bool ok = true;
+
+    if (section == "setup") {
+        if (key == "raw_diameter") {
+            if (toLower(value) == "auto") {
+                config.rawDiameter = 0.0;
+            } else {
+                ok = parseDouble(value, config.rawDiameter) && config.rawDiameter > 0.0;
+            }
+        } else if (key == "raw_diameter_margin") {
+            ok = parseDouble(value, config.rawDiameterMargin);
+        } else if (key == "facing_allowance") {
+            ok = parseDouble(value, inputs.facingAllowance);
+        } else if (key == "extra_stock_length") {
+            ok = parseDouble(value, config.extraStockLength);
+        } else if (key == "largest_drill_size") {
+            ok = parseDouble(value, inputs.largestDrillSize);
+        } else if (key == "internal_finishing_passes") {
+            ok = parseInt(value, inputs.internalFinishingPasses);
+        } else if (key == "external_finishing_passes") {
+            ok = parseInt(value, inputs.externalFinishingPasses);
+        } else if (key == "parting_allowance") {
+            ok = parseDouble(value, inputs.partingAllowance);
+        } else if (key == "profile_tolerance") {
+            ok = parseDouble(value, config.profileTolerance) && config.profileTolerance > 0.0;
+        } else if (key == "turning_axis") {
+            const std::string lower = toLower(value);
+            ok = lower == "auto" || lower == "z";
+            config.autoTurningAxis = lower == "auto";
+        } else if (key == "operations") {
+            return applyOperations(value, inputs, error);
+        } else {
+            error = "unknown key '" + key + "' in [setup]";
+            return false;
+        }
+    } else if (section == "tools") {
+        if (key == "facing") inputs.facingTool = value;
+        else if (key == "internal_roughing") inputs.internalRoughingTool = value;
+        else if (key == "external_roughing") inputs.externalRoughingTool = value;
+        else if (key == "internal_finishing") inputs.internalFinishingTool = value;
+        else if (key == "external_finishing") inputs.externalFinishingTool = value;
+        else if (key == "parting") inputs.partingTool = value;
+        else {
+            error = "unknown key '" + key + "' in [tools]";
+            return false;
+        }
+    } else if (section == "material") {
+        if (key == "name") {
+            config.materialName = value;
+        } else if (key == "type") {
+            inputs.materialType = value;
+        } else {
+            error = "unknown key '" + key + "' in [material]";
+            return false;
+        }
+    } else if (section == "machine") {
+        auto& machine = config.machine;
+        if (key == "type") {
+            ok = parseMachineType(value, config.machineType);
+            if (ok) {
+                machine.machineName = PostProcessor::PostProcessor::getMachineName(config.machineType);
+            }
+        } else if (key == "units") {
+            ok = value == "mm" || value == "inch";
+            machine.units = value;
+        } else if (key == "max_spindle_speed") {
+            ok = parseDouble(value, machine.maxSpindleSpeed);
+        } else if (key == "rapid_feed_rate") {
+            ok = parseDouble(value, machine.rapidFeedRate);
+        } else if (key == "use_coolant") {
+            ok = parseBool(value, machine.useCoolant);
+        } else if (key == "safe_retract_z") {
+            ok = parseDouble(value, machine.safeRetractZ);
+        } else if (key == "max_acceleration_x") {
+            ok = parseDouble(value, machine.maxAccelerationX) && machine.maxAccelerationX > 0.0;
+        } else if (key == "max_acceleration_z") {
+            ok = parseDouble(value, machine.maxAccelerationZ) && machine.maxAccelerationZ > 0.0;
+        } else if (key == "max_jerk") {
+            ok = parseDouble(value, machine.maxJerk) && machine.maxJerk >= 0.0;
+        } else if (key == "junction_deviation") {
+            ok = parseDouble(value, machine.junctionDeviation) && machine.junctionDeviation >= 0.0;
+        } else if (key == "block_rate") {
+            ok = parseDouble(value, machine.blockProcessingRate) && machine.blockProcessingRate >= 0.0;
+        } else if (key == "tool_change_time") {
+            ok = parseDouble(value, machine.toolChangeTime) && machine.toolChangeTime >= 0.0;
+        } else if (key == "compression_tolerance") {
+            ok = parseDouble(value, inputs.compressionTolerance) && inputs.compressionTolerance >= 0.0;
+        } else if (key == "link_rapids") {
+            ok = parseBool(value, inputs.linkRapids);
+        } else if (key == "constant_surface_speed") {
+            ok = parseBool(value, inputs.constantSurfaceSpeed);
+        } else if (key == "link_clearance") {
+            ok = parseDouble(value, inputs.linkClearance) && inputs.linkClearance >= 0.0;
+        } else if (key == "line_numbers") {
+            ok = parseBool(value, config.postOptions.includeLineNumbers);
+        } else if (key == "comments") {
+            ok = parseBool(value, config.postOptions.includeComments);
+        } else if (key == "program_extension") {
+            config.programExtension = value.empty() || value[0] == '.' ? value : "." + value;
+        } else {
+            error = "unknown key '" + key + "' in [machine]";
+            return false;
+        }
+    } else {
+        error = "unknown section [" + section + "]";
+        return false;
+    }
+
+    if (!ok) {
+        error = "invalid value '" + value + "' for " + key;
+    }
+    return ok;
+}
+
+bool isStepFile(const fs::path& path) {
+    const std::string extension = toLower(path.extension().string());
+    return extension == ".step" || extension == ".stp";
+}
+
+} // namespace
+
+bool BatchConfig::load(const std::string& filePath, std::string& error) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        error = "Cannot open config file: " + filePath;
+        return false;
+    }
+
+    std::string section;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        const size_t comment = line.find_first_of("#;");
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        line = trim(line);
+        if (line.empty()) {
+            continue;
+        }
+
+        std::string lineError;
+        if (line.front() == '[') {
+            if (line.back() != ']') {
+                lineError = "unterminated section header";
+            } else {
+                section = toLower(trim(line.substr(1, line.size() - 2)));
+            }
+        } else {
+            const size_t equals = line.find('=');
+            if (equals == std::string::npos) {
+                lineError = "expected key = value";
+            } else if (section.empty()) {
+                lineError = "setting outside of a section";
+            } else {
+                applySetting(*this, section, toLower(trim(line.substr(0, equals))),
+                             trim(line.substr(equals + 1)), lineError);
+            }
+        }
+
+        if (!lineError.empty()) {
+            error = filePath + ":" + std::to_string(lineNumber) + ": " + lineError;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool collectParts(const std::string& source, std::vector<std::string>& parts, std::string& error) {
+    std::error_code ec;
+    const fs::path sourcePath(source);
+
+    if (fs::is_directory(sourcePath, ec)) {
+        for (const auto& entry : fs::directory_iterator(sourcePath, ec)) {
+            if (entry.is_regular_file() && isStepFile(entry.path())) {
+                parts.push_back(entry.path().string());
+            }
+        }
+        if (ec) {
+            error = "Cannot read directory " + source + ": " + ec.message();
+            return false;
+        }
+    } else {
+        std::ifstream manifest(source);
+        if (!manifest.is_open()) {
+            error = "Cannot open input directory or manifest: " + source;
+            return false;
+        }
+
+        const fs::path baseDir = sourcePath.parent_path();
+        std::string line;
+        while (std::getline(manifest, line)) {
+            line = trim(line);
+            if (line.empty() || line.front() == '#') {
+                continue;
+            }
+            fs::path part(line);
+            if (part.is_relative()) {
+                part = baseDir / part;
+            }
+            parts.push_back(part.lexically_normal().string());
+        }
+    }
+
+    std::sort(parts.begin(), parts.end());
+    parts.erase(std::unique(parts.begin(), parts.end()), parts.end());
+    return true;
+}
+
+} // namespace Batch
+} // namespace IntuiCAM
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <IntuiCAM/PostProcessor/Types.h>
+#include <IntuiCAM/Toolpath/ToolpathGenerationPipeline.h>
+
+namespace IntuiCAM {
+namespace Batch {
+
+/**
+ * @brief Setup, tool, material and machine settings shared by every part
+ *
+ * Read from an INI-style file:
+ *
+ *   [setup]
+ *   raw_diameter = auto        # mm, or auto = part diameter + 2 * raw_diameter_margin
+ *   raw_diameter_margin = 2.0
+ *   facing_allowance = 2.0
+ *   extra_stock_length = 5.0   # mm beyond part length + facing allowance
+ *   turning_axis = auto        # auto (dominant revolved axis) or z
+ *   operations = facing, external_roughing, external_finishing, parting
+ *
+ *   [tools]
+ *   facing = facing tool
+ *
+ *   [material]
+ *   name = Aluminum 6061
+ *
+ *   [machine]
+ *   type = Fanuc
+ *   max_spindle_speed = 3000
+ *
+ * Unknown keys are reported as errors so typos do not silently fall back to
+ * defaults.
+ */
+struct BatchConfig {
+    using Pipeline = Toolpath::ToolpathGenerationPipeline;
+
+    // Defaults for every part; profile, lengths and datum are filled per part
+    Pipeline::PipelineInputs inputs;
+
+    double rawDiameter = 0.0;           // mm - 0 derives it from the part
+    double rawDiameterMargin = 2.0;     // mm per side when derived
+    double extraStockLength = 5.0;      // mm
+    bool autoTurningAxis = true;        // false: world Z through the origin
+    double profileTolerance = 0.01;     // mm
+
+    std::string materialName = "Unspecified";
+
+    PostProcessor::PostProcessor::MachineType machineType =
+        PostProcessor::PostProcessor::MachineType::GenericLathe;
+    PostProcessor::GCodeGenerator::MachineConfig machine;
+    PostProcessor::GCodeGenerator::PostProcessorOptions postOptions;
+    std::string programExtension = ".nc";
+
+    /**
+     * @brief Parse a config file over the defaults
+     * @return False with @p error set on I/O or syntax errors
+     */
+    bool load(const std::string& filePath, std::string& error);
+};
+
+/**
+ * @brief Collect the STEP files to process
+ *
+ * @p source is either a directory, scanned (non-recursively) for .step/.stp
+ * files, or a manifest listing one path per line. Manifest paths are relative
+ * to the manifest; blank lines and lines starting with '#' are skipped.
+ * The result is sorted so runs are reproducible.
+ */
+bool collectParts(const std::string& source, std::vector<std::string>& parts, std::string& error);
+
+} // namespace Batch
+} // namespace IntuiCAM
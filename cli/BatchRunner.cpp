@@ -0,0 +1,365 @@
+#include "BatchRunner.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <IFSelect_ReturnStatus.hxx>
+#include <STEPControl_Controller.hxx>
+#include <STEPControl_Reader.hxx>
+#include <Standard_Failure.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Pnt.hxx>
+
+#include <IntuiCAM/Common/Trace.h>
+#include <IntuiCAM/Common/Version.h>
+#include <IntuiCAM/Geometry/ShapeAnalysisIndex.h>
+#include <IntuiCAM/PostProcessor/CycleTimeEstimator.h>
+#include <IntuiCAM/PostProcessor/GCodeSink.h>
+#include <IntuiCAM/Toolpath/LatheProfile.h>
+
+namespace IntuiCAM {
+namespace Batch {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+bool readStepFile(const std::string& path, TopoDS_Shape& shape, std::string& error) {
+    TRACE_SPAN("batch", "readStepFile");
+    STEPControl_Reader reader;
+    if (reader.ReadFile(path.c_str()) != IFSelect_RetDone) {
+        error = "Failed to read STEP file";
+        return false;
+    }
+    if (reader.TransferRoots() == 0) {
+        error = "STEP file contains no transferable shapes";
+        return false;
+    }
+    shape = reader.OneShape();
+    if (shape.IsNull()) {
+        error = "STEP file produced an empty shape";
+        return false;
+    }
+    return true;
+}
+
+void appendEscaped(std::string& out, const std::string& text) {
+    for (char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+                    out += code;
+                } else {
+                    out += c;
+                }
+        }
+    }
+}
+
+void appendString(std::string& out, const char* key, const std::string& value) {
+    out += '"';
+    out += key;
+    out += "\":\"";
+    appendEscaped(out, value);
+    out += '"';
+}
+
+void appendNumber(std::string& out, const char* key, double value) {
+    char number[64];
+    std::snprintf(number, sizeof(number), "\"%s\":%.3f", key, value);
+    out += number;
+}
+
+void appendCount(std::string& out, const char* key, size_t value) {
+    out += '"';
+    out += key;
+    out += "\":";
+    out += std::to_string(value);
+}
+
+// Program names derived from the input stem; duplicates get a numeric suffix
+std::vector<std::string> outputPaths(const std::vector<std::string>& parts,
+                                     const std::string& outputDirectory,
+                                     const std::string& extension) {
+    std::vector<std::string> paths;
+    paths.reserve(parts.size());
+    std::map<std::string, int> seen;
+    for (const auto& part : parts) {
+        std::string stem = fs::path(part).stem().string();
+        int count = seen[stem]++;
+        if (count > 0) {
+            stem += "_" + std::to_string(count);
+        }
+        paths.push_back((fs::path(outputDirectory) / (stem + extension)).string());
+    }
+    return paths;
+}
+
+} // namespace
+
+BatchRunner::BatchRunner(const BatchConfig& config, std::string outputDirectory)
+    : config_(config), outputDirectory_(std::move(outputDirectory)) {}
+
+PartResult BatchRunner::processPart(const std::string& inputPath, const std::string& outputPath) const {
+    TRACE_SPAN("batch", "BatchRunner::processPart");
+    using Pipeline = Toolpath::ToolpathGenerationPipeline;
+
+    PartResult result;
+    result.inputPath = inputPath;
+    result.outputPath = outputPath;
+    const auto partStart = Clock::now();
+
+    try {
+        // Stage 1: import
+        auto stageStart = Clock::now();
+        TopoDS_Shape shape;
+        bool imported = readStepFile(inputPath, shape, result.error);
+        result.importMs = elapsedMs(stageStart);
+        if (!imported) {
+            result.totalMs = elapsedMs(partStart);
+            return result;
+        }
+
+        // Stage 2: turning axis, part extent and profile
+        stageStart = Clock::now();
+        auto analysis = Geometry::ShapeAnalysisIndex::get(shape);
+        gp_Ax1 turningAxis(gp_Pnt(0, 0, 0), gp_Dir(0, 0, 1));
+        if (config_.autoTurningAxis) {
+            const auto& candidates = analysis->getCandidateTurningAxes();
+            if (!candidates.empty()) {
+                turningAxis = candidates.front().axis;
+            } else {
+                result.warnings.push_back("No revolved faces found; using the Z axis");
+            }
+        }
+
+        Pipeline::PipelineInputs inputs = config_.inputs;
+        inputs.maxParallelStages = 1;
+        inputs.maxSpindleSpeed = config_.machine.maxSpindleSpeed;
+        inputs.profile2D = Toolpath::LatheProfile::extractSegmentProfile(shape, turningAxis,
+                                                                         config_.profileTolerance);
+        result.profileMs = elapsedMs(stageStart);
+        result.profileSegments = inputs.profile2D.getSegmentCount();
+        if (inputs.profile2D.isEmpty()) {
+            result.error = "Profile extraction produced no segments";
+            result.totalMs = elapsedMs(partStart);
+            return result;
+        }
+
+        double minZ = 0.0, maxZ = 0.0, minRadius = 0.0, maxRadius = 0.0;
+        inputs.profile2D.getBounds(minZ, maxZ, minRadius, maxRadius);
+
+        inputs.partLength = analysis->getAxialExtent(turningAxis).length();
+        inputs.rawMaterialDiameter = config_.rawDiameter > 0.0
+            ? config_.rawDiameter
+            : 2.0 * (maxRadius + config_.rawDiameterMargin);
+        inputs.rawMaterialLength = inputs.partLength + inputs.facingAllowance + config_.extraStockLength;
+        inputs.z0 = inputs.rawMaterialLength;
+
+        if (2.0 * maxRadius > inputs.rawMaterialDiameter) {
+            result.warnings.push_back("Part diameter exceeds the configured raw material diameter");
+        }
+
+        // Stage 3: toolpaths
+        stageStart = Clock::now();
+        Pipeline pipeline;
+        Pipeline::PipelineResult pipelineResult = pipeline.executePipeline(inputs);
+        result.pipelineMs = elapsedMs(stageStart);
+        result.warnings.insert(result.warnings.end(), pipelineResult.warnings.begin(),
+                               pipelineResult.warnings.end());
+        result.linkingTimeSaved = pipelineResult.linking.timeSaved();
+        result.feedSpeedTimeSaved = pipelineResult.feedSpeedPlan.timeSaved();
+        if (!pipelineResult.success) {
+            result.error = pipelineResult.errorMessage.empty() ? "Toolpath generation failed"
+                                                                : pipelineResult.errorMessage;
+            result.totalMs = elapsedMs(partStart);
+            return result;
+        }
+
+        std::vector<std::shared_ptr<Toolpath::Toolpath>> toolpaths;
+        toolpaths.reserve(pipelineResult.timeline.size());
+        for (auto& toolpath : pipelineResult.timeline) {
+            if (toolpath) {
+                result.movementCount += toolpath->getMovementCount();
+                toolpaths.push_back(std::shared_ptr<Toolpath::Toolpath>(std::move(toolpath)));
+            }
+        }
+        result.toolpathCount = toolpaths.size();
+        result.estimatedMachiningTime = PostProcessor::CycleTimeEstimator(config_.machine).estimate(toolpaths).total();
+
+        // Stage 4: G-code, streamed straight to the program file
+        stageStart = Clock::now();
+        PostProcessor::GCodeGenerator generator(config_.machine);
+        generator.setOptions(config_.postOptions);
+        for (const auto& toolpath : toolpaths) {
+            for (auto& warning : generator.checkMachineLimits(*toolpath)) {
+                result.warnings.push_back(std::move(warning));
+            }
+        }
+
+        PostProcessor::FileSink sink(outputPath);
+        if (!sink.isOpen()) {
+            result.error = "Cannot open output file: " + outputPath;
+        } else {
+            generator.writeGCode(toolpaths, sink);
+            result.programBytes = sink.bytesWritten();
+            if (!sink.good()) {
+                result.error = "Failed to write output file: " + outputPath;
+            }
+        }
+        result.postMs = elapsedMs(stageStart);
+        result.success = result.error.empty();
+    } catch (const Standard_Failure& e) {
+        result.error = std::string("OpenCASCADE error: ") + e.GetMessageString();
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+
+    result.totalMs = elapsedMs(partStart);
+    return result;
+}
+
+BatchSummary BatchRunner::run(const std::vector<std::string>& parts) {
+    TRACE_SPAN("batch", "BatchRunner::run");
+    BatchSummary summary;
+    summary.parts.resize(parts.size());
+
+    int workers = workers_ > 0 ? workers_ : static_cast<int>(std::thread::hardware_concurrency());
+    workers = std::max(1, std::min(workers, static_cast<int>(parts.size())));
+    summary.workers = workers;
+
+    // Register the STEP schemas once, before readers are created concurrently
+    STEPControl_Controller::Init();
+
+    const std::vector<std::string> outputs = outputPaths(parts, outputDirectory_, config_.programExtension);
+    const auto batchStart = Clock::now();
+
+    std::atomic<size_t> nextPart{0};
+    std::atomic<size_t> finished{0};
+    std::mutex printMutex;
+
+    auto worker = [&]() {
+        for (size_t index = nextPart++; index < parts.size(); index = nextPart++) {
+            summary.parts[index] = processPart(parts[index], outputs[index]);
+            size_t done = ++finished;
+
+            if (verbose_) {
+                const PartResult& part = summary.parts[index];
+                std::lock_guard<std::mutex> lock(printMutex);
+                std::cout << "[" << done << "/" << parts.size() << "] "
+                          << (part.success ? "OK   " : "FAIL ") << part.inputPath
+                          << " (" << static_cast<long long>(part.totalMs) << " ms)";
+                if (!part.success) {
+                    std::cout << ": " << part.error;
+                }
+                std::cout << std::endl;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    for (int i = 0; i < workers; ++i) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    summary.wallMs = elapsedMs(batchStart);
+    for (const auto& part : summary.parts) {
+        ++(part.success ? summary.succeeded : summary.failed);
+    }
+    return summary;
+}
+
+std::string BatchRunner::toJson(const BatchSummary& summary) const {
+    std::string json;
+    json.reserve(256 + summary.parts.size() * 512);
+
+    json += "{";
+    appendString(json, "intuicam_version", Common::Version::getVersionString());
+    json += ",";
+    appendString(json, "material", config_.materialName);
+    json += ",";
+    appendString(json, "machine", config_.machine.machineName);
+    json += ",";
+    appendCount(json, "workers", static_cast<size_t>(summary.workers));
+    json += ",";
+    appendNumber(json, "wall_ms", summary.wallMs);
+    json += ",";
+    appendCount(json, "succeeded", summary.succeeded);
+    json += ",";
+    appendCount(json, "failed", summary.failed);
+    json += ",\"parts\":[";
+
+    for (size_t i = 0; i < summary.parts.size(); ++i) {
+        const PartResult& part = summary.parts[i];
+        json += i == 0 ? "\n{" : ",\n{";
+        appendString(json, "input", part.inputPath);
+        json += ",";
+        appendString(json, "output", part.outputPath);
+        json += part.success ? ",\"success\":true," : ",\"success\":false,";
+        appendString(json, "error", part.error);
+        json += ",\"timings_ms\":{";
+        appendNumber(json, "import", part.importMs);
+        json += ",";
+        appendNumber(json, "profile", part.profileMs);
+        json += ",";
+        appendNumber(json, "pipeline", part.pipelineMs);
+        json += ",";
+        appendNumber(json, "post", part.postMs);
+        json += ",";
+        appendNumber(json, "total", part.totalMs);
+        json += "},";
+        appendCount(json, "profile_segments", part.profileSegments);
+        json += ",";
+        appendCount(json, "toolpaths", part.toolpathCount);
+        json += ",";
+        appendCount(json, "movements", part.movementCount);
+        json += ",";
+        appendCount(json, "program_bytes", part.programBytes);
+        json += ",";
+        appendNumber(json, "estimated_machining_min", part.estimatedMachiningTime);
+        json += ",";
+        appendNumber(json, "linking_saved_min", part.linkingTimeSaved);
+        json += ",";
+        appendNumber(json, "feed_speed_saved_min", part.feedSpeedTimeSaved);
+        json += ",\"warnings\":[";
+        for (size_t w = 0; w < part.warnings.size(); ++w) {
+            json += w == 0 ? "\"" : ",\"";
+            appendEscaped(json, part.warnings[w]);
+            json += '"';
+        }
+        json += "]}";
+    }
+
+    json += "\n]}\n";
+    return json;
+}
+
+} // namespace Batch
+} // namespace IntuiCAM
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "BatchConfig.h"
+
+namespace IntuiCAM {
+namespace Batch {
+
+/** @brief Outcome and stage timings of one part */
+struct PartResult {
+    std::string inputPath;
+    std::string outputPath;
+    bool success = false;
+    std::string error;
+    std::vector<std::string> warnings;
+
+    // Wall-clock milliseconds per stage; stages not reached stay at 0
+    double importMs = 0.0;
+    double profileMs = 0.0;
+    double pipelineMs = 0.0;
+    double postMs = 0.0;
+    double totalMs = 0.0;
+
+    size_t profileSegments = 0;
+    size_t toolpathCount = 0;
+    size_t movementCount = 0;
+    size_t programBytes = 0;
+    double estimatedMachiningTime = 0.0;    // minutes
+    double linkingTimeSaved = 0.0;          // minutes saved by re-routing rapids
+    double feedSpeedTimeSaved = 0.0;        // minutes saved by surface speed planning
+};
+
+struct BatchSummary {
+    std::vector<PartResult> parts;          // in input order
+    int workers = 0;
+    double wallMs = 0.0;
+    size_t succeeded = 0;
+    size_t failed = 0;
+};
+
+/**
+ * @brief Runs import, profile extraction, the pipeline and the post-processor
+ *        for many parts on a pool of worker threads
+ *
+ * Every part is independent: a failure is recorded in its PartResult and the
+ * batch carries on. Each part gets its own pipeline and G-code generator, and
+ * the pipeline runs its stages serially since the pool already keeps every
+ * core busy.
+ */
+class BatchRunner {
+public:
+    BatchRunner(const BatchConfig& config, std::string outputDirectory);
+
+    // 0 uses all cores
+    void setWorkerCount(int workers) { workers_ = workers; }
+
+    // Print one line per finished part to stdout
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+
+    BatchSummary run(const std::vector<std::string>& parts);
+
+    PartResult processPart(const std::string& inputPath, const std::string& outputPath) const;
+
+    /** @brief JSON timing report of a finished batch */
+    std::string toJson(const BatchSummary& summary) const;
+
+private:
+    BatchConfig config_;
+    std::string outputDirectory_;
+    int workers_ = 0;
+    bool verbose_ = false;
+};
+
+} // namespace Batch
+} // namespace IntuiCAM
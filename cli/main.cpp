@@ -0,0 +1,139 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <IntuiCAM/Common/Version.h>
+
+#include "BatchConfig.h"
+#include "BatchRunner.h"
+
+// Headless STEP -> G-code batch processing:
+//   intuicam_batch <directory|manifest> -c setup.ini -o programs/ [-j 8] [-r report.json]
+namespace {
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <input> -c <config> -o <output-dir> [options]\n"
+              << "\n"
+              << "  <input>              Directory of .step/.stp files, or a manifest with one path per line\n"
+              << "  -c, --config FILE    Setup, tool, material and machine settings (INI)\n"
+              << "  -o, --output DIR     Directory for the generated programs\n"
+              << "  -j, --jobs N         Parts processed in parallel (default: all cores)\n"
+              << "  -r, --report FILE    JSON timing report (default: <output-dir>/batch_report.json)\n"
+              << "  -q, --quiet          Only print the summary\n"
+              << "  -h, --help           Show this help\n";
+}
+
+bool writeFile(const std::string& path, const std::string& contents) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = std::fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    return std::fclose(file) == 0 && written;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    using namespace IntuiCAM;
+
+    std::string input;
+    std::string configPath;
+    std::string outputDir;
+    std::string reportPath;
+    int jobs = 0;
+    bool quiet = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto value = [&](const char* name) -> const char* {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << name << "\n";
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (arg == "-c" || arg == "--config") {
+            configPath = value("--config");
+        } else if (arg == "-o" || arg == "--output") {
+            outputDir = value("--output");
+        } else if (arg == "-r" || arg == "--report") {
+            reportPath = value("--report");
+        } else if (arg == "-j" || arg == "--jobs") {
+            jobs = std::atoi(value("--jobs"));
+        } else if (arg == "-q" || arg == "--quiet") {
+            quiet = true;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage(argv[0]);
+            return 2;
+        } else if (input.empty()) {
+            input = arg;
+        } else {
+            std::cerr << "Only one input directory or manifest may be given\n";
+            return 2;
+        }
+    }
+
+    if (input.empty() || configPath.empty() || outputDir.empty()) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    std::string error;
+    Batch::BatchConfig config;
+    if (!config.load(configPath, error)) {
+        std::cerr << error << "\n";
+        return 2;
+    }
+
+    std::vector<std::string> parts;
+    if (!Batch::collectParts(input, parts, error)) {
+        std::cerr << error << "\n";
+        return 2;
+    }
+    if (parts.empty()) {
+        std::cerr << "No STEP files found in " << input << "\n";
+        return 2;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(outputDir, ec);
+    if (ec) {
+        std::cerr << "Cannot create output directory " << outputDir << ": " << ec.message() << "\n";
+        return 2;
+    }
+    if (reportPath.empty()) {
+        reportPath = (std::filesystem::path(outputDir) / "batch_report.json").string();
+    }
+
+    if (!quiet) {
+        std::cout << "IntuiCAM " << Common::Version::getVersionString() << " batch: "
+                  << parts.size() << " parts" << std::endl;
+    }
+
+    Batch::BatchRunner runner(config, outputDir);
+    runner.setWorkerCount(jobs);
+    runner.setVerbose(!quiet);
+    Batch::BatchSummary summary = runner.run(parts);
+
+    if (!writeFile(reportPath, runner.toJson(summary))) {
+        std::cerr << "Failed to write report " << reportPath << "\n";
+        return 2;
+    }
+
+    std::cout << summary.succeeded << " succeeded, " << summary.failed << " failed in "
+              << static_cast<long long>(summary.wallMs) << " ms on " << summary.workers
+              << " workers; report: " << reportPath << std::endl;
+
+    // Non-zero when any part failed, so schedulers can flag the run
+    return summary.failed == 0 ? 0 : 1;
+}
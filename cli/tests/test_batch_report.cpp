@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+
+#include "BatchRunner.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace IntuiCAM::Batch;
+
+namespace {
+
+// Just enough of a strict JSON reader to check the report is well formed
+struct JsonValue {
+    enum class Kind { Null, Bool, Number, String, Array, Object };
+    Kind kind = Kind::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::map<std::string, JsonValue> object;
+
+    const JsonValue& operator[](const std::string& key) const { return object.at(key); }
+};
+
+class JsonReader {
+public:
+    explicit JsonReader(const std::string& text) : text_(text) {}
+
+    // False if the text is not exactly one JSON value
+    bool parse(JsonValue& value) {
+        return readValue(value) && (skipSpace(), pos_ == text_.size());
+    }
+
+private:
+    void skipSpace() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    bool readLiteral(const char* literal) {
+        const std::string word(literal);
+        if (text_.compare(pos_, word.size(), word) != 0) {
+            return false;
+        }
+        pos_ += word.size();
+        return true;
+    }
+
+    bool readString(std::string& out) {
+        if (!consume('"')) {
+            return false;
+        }
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            char c = text_[pos_++];
+            if (static_cast<unsigned char>(c) < 0x20) {
+                return false;
+            }
+            if (c == '\\') {
+                if (pos_ >= text_.size()) {
+                    return false;
+                }
+                char escape = text_[pos_++];
+                switch (escape) {
+                    case '"': case '\\': case '/': out += escape; break;
+                    case 'n': out += '\n'; break;
+                    case 't': out += '\t'; break;
+                    case 'r': out += '\r'; break;
+                    case 'b': out += '\b'; break;
+                    case 'f': out += '\f'; break;
+                    case 'u':
+                        if (pos_ + 4 > text_.size()) {
+                            return false;
+                        }
+                        out += static_cast<char>(std::strtol(text_.substr(pos_, 4).c_str(), nullptr, 16));
+                        pos_ += 4;
+                        break;
+                    default: return false;
+                }
+            } else {
+                out += c;
+            }
+        }
+        return consume('"');
+    }
+
+    bool readValue(JsonValue& value) {
+        skipSpace();
+        if (pos_ >= text_.size()) {
+            return false;
+        }
+        char c = text_[pos_];
+        if (c == '{') {
+            value.kind = JsonValue::Kind::Object;
+            ++pos_;
+            if (consume('}')) {
+                return true;
+            }
+            do {
+                std::string key;
+                JsonValue member;
+                if (!readString(key) || !consume(':') || !readValue(member)) {
+                    return false;
+                }
+                value.object[key] = std::move(member);
+            } while (consume(','));
+            return consume('}');
+        }
+        if (c == '[') {
+            value.kind = JsonValue::Kind::Array;
+            ++pos_;
+            if (consume(']')) {
+                return true;
+            }
+            do {
+                JsonValue element;
+                if (!readValue(element)) {
+                    return false;
+                }
+                value.array.push_back(std::move(element));
+            } while (consume(','));
+            return consume(']');
+        }
+        if (c == '"') {
+            value.kind = JsonValue::Kind::String;
+            return readString(value.string);
+        }
+        if (c == 't' || c == 'f') {
+            value.kind = JsonValue::Kind::Bool;
+            value.boolean = c == 't';
+            return readLiteral(value.boolean ? "true" : "false");
+        }
+        if (c == 'n') {
+            return readLiteral("null");
+        }
+        const char* begin = text_.c_str() + pos_;
+        char* end = nullptr;
+        value.kind = JsonValue::Kind::Number;
+        value.number = std::strtod(begin, &end);
+        if (end == begin) {
+            return false;
+        }
+        pos_ += static_cast<size_t>(end - begin);
+        return true;
+    }
+
+    const std::string& text_;
+    size_t pos_ = 0;
+};
+
+PartResult makePart(const std::string& name, bool success) {
+    PartResult part;
+    part.inputPath = "parts/" + name + ".step";
+    part.outputPath = "out/" + name + ".nc";
+    part.success = success;
+    part.importMs = 12.5;
+    part.totalMs = 40.25;
+    part.toolpathCount = 4;
+    part.movementCount = 1200;
+    part.estimatedMachiningTime = 3.5;
+    part.linkingTimeSaved = 0.25;
+    part.feedSpeedTimeSaved = 0.125;
+    return part;
+}
+
+} // namespace
+
+TEST(BatchReportTest, ReportIsValidJson) {
+    BatchConfig config;
+    config.materialName = "Aluminum \"6061\"";
+
+    BatchSummary summary;
+    summary.parts.push_back(makePart("shaft", true));
+    summary.parts.push_back(makePart("bushing", false));
+    summary.parts.back().error = "Failed to read STEP file";
+    summary.parts.back().warnings = {"line one\nline two", "tab\there"};
+    summary.workers = 2;
+    summary.wallMs = 80.0;
+    summary.succeeded = 1;
+    summary.failed = 1;
+
+    const std::string json = BatchRunner(config, "out").toJson(summary);
+    JsonValue report;
+    ASSERT_TRUE(JsonReader(json).parse(report)) << json;
+
+    ASSERT_EQ(report.kind, JsonValue::Kind::Object);
+    EXPECT_EQ(report["material"].string, "Aluminum \"6061\"");
+    EXPECT_DOUBLE_EQ(report["workers"].number, 2.0);
+    EXPECT_DOUBLE_EQ(report["failed"].number, 1.0);
+
+    const auto& parts = report["parts"].array;
+    ASSERT_EQ(parts.size(), 2u);
+    EXPECT_EQ(parts[0]["input"].string, "parts/shaft.step");
+    EXPECT_TRUE(parts[0]["success"].boolean);
+    EXPECT_DOUBLE_EQ(parts[0]["timings_ms"]["import"].number, 12.5);
+    EXPECT_DOUBLE_EQ(parts[0]["movements"].number, 1200.0);
+    EXPECT_DOUBLE_EQ(parts[0]["linking_saved_min"].number, 0.25);
+    EXPECT_DOUBLE_EQ(parts[0]["feed_speed_saved_min"].number, 0.125);
+
+    EXPECT_FALSE(parts[1]["success"].boolean);
+    EXPECT_EQ(parts[1]["error"].string, "Failed to read STEP file");
+    ASSERT_EQ(parts[1]["warnings"].array.size(), 2u);
+    EXPECT_EQ(parts[1]["warnings"].array[0].string, "line one\nline two");
+}
+
+TEST(BatchReportTest, EmptyBatchIsValidJson) {
+    const std::string json = BatchRunner(BatchConfig(), "out").toJson(BatchSummary());
+    JsonValue report;
+    ASSERT_TRUE(JsonReader(json).parse(report)) << json;
+    EXPECT_TRUE(report["parts"].array.empty());
+}
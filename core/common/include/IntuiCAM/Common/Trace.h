@@ -0,0 +1,132 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Tracing is compiled in by default and switched on at runtime. Configure with
+// -DINTUICAM_ENABLE_TRACING=OFF to remove every TRACE_* site from the build.
+#ifndef INTUICAM_ENABLE_TRACING
+#define INTUICAM_ENABLE_TRACING 1
+#endif
+
+namespace IntuiCAM {
+namespace Common {
+
+/**
+ * @brief One event in Chrome trace format
+ *
+ * Names and categories are not owned; they must be string literals or strings
+ * interned with Tracer::intern().
+ */
+struct TraceEvent {
+    const char* name = "";
+    const char* category = "";
+    char phase = 'X';               // 'X' complete span, 'C' counter
+    std::int64_t timestamp = 0;     // microseconds since the tracer started
+    std::int64_t duration = 0;      // microseconds, spans only
+    double value = 0.0;             // counters only
+    std::uint32_t threadId = 0;
+};
+
+/**
+ * @brief Process-wide collector for spans and counters
+ *
+ * Each thread appends to its own buffer, so recording never contends with
+ * other threads. Disabled by default; setting the INTUICAM_TRACE environment
+ * variable to a file path enables it at startup and writes the trace to that
+ * path when the process exits. The file loads in chrome://tracing or Perfetto.
+ */
+class Tracer {
+public:
+    static Tracer& instance();
+
+    ~Tracer();
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    void setEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool isEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /** @brief Write the trace to this path at exit (empty to disable) */
+    void setOutputPath(const std::string& path);
+
+    void record(const TraceEvent& event);
+    void counter(const char* name, double value, const char* category = "intuicam");
+
+    /** @brief Stable copy of a runtime string, for dynamic span names */
+    const char* intern(const std::string& text);
+
+    /** @brief All events recorded so far, ordered by timestamp */
+    std::vector<TraceEvent> collect() const;
+    void clear();
+
+    std::string toChromeTraceJson() const;
+    bool writeChromeTrace(const std::string& path) const;
+
+    /** @brief Microseconds since the tracer was created */
+    std::int64_t now() const;
+
+private:
+    struct ThreadBuffer;
+
+    Tracer();
+    ThreadBuffer& localBuffer();
+
+    std::atomic<bool> enabled_{false};
+    std::int64_t epoch_ = 0;
+    std::string outputPath_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::vector<std::unique_ptr<std::string>> strings_;
+};
+
+/**
+ * @brief RAII span: records a complete event covering its own lifetime
+ *
+ * Costs one relaxed atomic load when tracing is disabled. A null name leaves
+ * the span inactive.
+ */
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name, const char* category = "intuicam");
+    ~TraceSpan();
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* name_ = nullptr;
+    const char* category_ = nullptr;
+    std::int64_t start_ = -1;   // -1 while inactive
+};
+
+// Span name for TRACE_SPAN: literals pass through, runtime strings are interned
+inline const char* traceSpanName(const char* name) { return name; }
+inline const char* traceSpanName(const std::string& name) { return Tracer::instance().intern(name); }
+
+} // namespace Common
+} // namespace IntuiCAM
+
+// Utility macros for tracing. A runtime span name is only built and interned
+// while tracing is enabled.
+#if INTUICAM_ENABLE_TRACING
+#define INTUICAM_TRACE_CONCAT_INNER(a, b) a##b
+#define INTUICAM_TRACE_CONCAT(a, b) INTUICAM_TRACE_CONCAT_INNER(a, b)
+#define TRACE_SPAN(category, name) \
+    IntuiCAM::Common::TraceSpan INTUICAM_TRACE_CONCAT(intuicamTraceSpan_, __LINE__)( \
+        IntuiCAM::Common::Tracer::instance().isEnabled() ? IntuiCAM::Common::traceSpanName(name) : nullptr, \
+        category)
+#define TRACE_COUNTER(category, name, value) \
+    do { \
+        auto& intuicamTracer = IntuiCAM::Common::Tracer::instance(); \
+        if (intuicamTracer.isEnabled()) intuicamTracer.counter(name, static_cast<double>(value), category); \
+    } while (0)
+#else
+#define TRACE_SPAN(category, name) ((void)0)
+#define TRACE_COUNTER(category, name, value) ((void)0)
+#endif
@@ -99,6 +99,9 @@ public:
     virtual ~Logger() = default;
     virtual void log(LogLevel level, const std::string& message) = 0;
     
+    // Checked by the LOG_* macros before the message is built
+    virtual bool isEnabled(LogLevel) const { return true; }
+    
     void debug(const std::string& message) { log(LogLevel::Debug, message); }
     void info(const std::string& message) { log(LogLevel::Info, message); }
     void warning(const std::string& message) { log(LogLevel::Warning, message); }
@@ -111,11 +114,11 @@ Logger* getGlobalLogger();
 void setGlobalLogger(std::unique_ptr<Logger> logger);
 
 // Utility macros for logging
-#define LOG_DEBUG(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger()) logger->debug(msg)
-#define LOG_INFO(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger()) logger->info(msg)
-#define LOG_WARNING(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger()) logger->warning(msg)
-#define LOG_ERROR(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger()) logger->error(msg)
-#define LOG_CRITICAL(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger()) logger->critical(msg)
+#define LOG_DEBUG(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger(); logger && logger->isEnabled(IntuiCAM::Common::LogLevel::Debug)) logger->debug(msg)
+#define LOG_INFO(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger(); logger && logger->isEnabled(IntuiCAM::Common::LogLevel::Info)) logger->info(msg)
+#define LOG_WARNING(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger(); logger && logger->isEnabled(IntuiCAM::Common::LogLevel::Warning)) logger->warning(msg)
+#define LOG_ERROR(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger(); logger && logger->isEnabled(IntuiCAM::Common::LogLevel::Error)) logger->error(msg)
+#define LOG_CRITICAL(msg) if(auto* logger = IntuiCAM::Common::getGlobalLogger(); logger && logger->isEnabled(IntuiCAM::Common::LogLevel::Critical)) logger->critical(msg)
 
 // Progress reporting interface
 class ProgressReporter {
@@ -0,0 +1,202 @@
+#include <IntuiCAM/Common/Trace.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace IntuiCAM {
+namespace Common {
+
+namespace {
+std::int64_t steadyMicroseconds() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void appendEscaped(std::string& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        switch (*c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(*c));
+                    out += code;
+                } else {
+                    out += *c;
+                }
+        }
+    }
+}
+}
+
+struct Tracer::ThreadBuffer {
+    std::mutex mutex;   // only contended while collect() runs
+    std::vector<TraceEvent> events;
+    std::uint32_t threadId = 0;
+};
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+Tracer::Tracer()
+    : epoch_(steadyMicroseconds()) {
+    if (const char* path = std::getenv("INTUICAM_TRACE")) {
+        if (*path) {
+            outputPath_ = path;
+            setEnabled(true);
+        }
+    }
+}
+
+Tracer::~Tracer() {
+    if (!outputPath_.empty()) {
+        writeChromeTrace(outputPath_);
+    }
+}
+
+void Tracer::setOutputPath(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    outputPath_ = path;
+}
+
+Tracer::ThreadBuffer& Tracer::localBuffer() {
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer->threadId = static_cast<std::uint32_t>(buffers_.size() + 1);
+        buffers_.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void Tracer::record(const TraceEvent& event) {
+    ThreadBuffer& buffer = localBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.events.push_back(event);
+    buffer.events.back().threadId = buffer.threadId;
+}
+
+void Tracer::counter(const char* name, double value, const char* category) {
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.phase = 'C';
+    event.timestamp = now();
+    event.value = value;
+    record(event);
+}
+
+const char* Tracer::intern(const std::string& text) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& existing : strings_) {
+        if (*existing == text) {
+            return existing->c_str();
+        }
+    }
+    strings_.push_back(std::make_unique<std::string>(text));
+    return strings_.back()->c_str();
+}
+
+std::vector<TraceEvent> Tracer::collect() const {
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& buffer : buffers_) {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            events.insert(events.end(), buffer->events.begin(), buffer->events.end());
+        }
+    }
+    std::stable_sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+        return a.timestamp < b.timestamp;
+    });
+    return events;
+}
+
+void Tracer::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& buffer : buffers_) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        buffer->events.clear();
+    }
+}
+
+std::string Tracer::toChromeTraceJson() const {
+    std::vector<TraceEvent> events = collect();
+
+    std::string json;
+    json.reserve(64 + events.size() * 96);
+    json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    char number[64];
+    for (size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& event = events[i];
+        json += i == 0 ? "\n" : ",\n";
+        json += "{\"name\":\"";
+        appendEscaped(json, event.name);
+        json += "\",\"cat\":\"";
+        appendEscaped(json, event.category);
+        json += "\",\"ph\":\"";
+        json += event.phase;
+        std::snprintf(number, sizeof(number), "\",\"pid\":1,\"tid\":%u,\"ts\":%lld",
+                      static_cast<unsigned>(event.threadId), static_cast<long long>(event.timestamp));
+        json += number;
+        if (event.phase == 'X') {
+            std::snprintf(number, sizeof(number), ",\"dur\":%lld", static_cast<long long>(event.duration));
+        } else {
+            std::snprintf(number, sizeof(number), ",\"args\":{\"value\":%.17g}", event.value);
+        }
+        json += number;
+        json += '}';
+    }
+    json += "\n]}\n";
+    return json;
+}
+
+bool Tracer::writeChromeTrace(const std::string& path) const {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    std::string json = toChromeTraceJson();
+    bool written = std::fwrite(json.data(), 1, json.size(), file) == json.size();
+    return std::fclose(file) == 0 && written;
+}
+
+std::int64_t Tracer::now() const {
+    return steadyMicroseconds() - epoch_;
+}
+
+// TraceSpan implementation
+TraceSpan::TraceSpan(const char* name, const char* category) {
+    Tracer& tracer = Tracer::instance();
+    if (name && tracer.isEnabled()) {
+        name_ = name;
+        category_ = category;
+        start_ = tracer.now();
+    }
+}
+
+TraceSpan::~TraceSpan() {
+    if (start_ < 0) {
+        return;
+    }
+    Tracer& tracer = Tracer::instance();
+    TraceEvent event;
+    event.name = name_;
+    event.category = category_;
+    event.phase = 'X';
+    event.timestamp = start_;
+    event.duration = tracer.now() - start_;
+    tracer.record(event);
+}
+
+} // namespace Common
+} // namespace IntuiCAM
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+// OpenCASCADE includes
+#include <Bnd_Box.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Trsf.hxx>
+
+namespace IntuiCAM {
+namespace Geometry {
+
+/**
+ * @brief Per-shape analysis built in a single pass over the faces
+ *
+ * Holds what part setup keeps asking about a shape: the surface type of each
+ * face, per-face and overall bounds, the axes of revolved faces and the
+ * extent of the shape along an axis. The face pass runs once per shape, so
+ * asking about many axes costs O(faces) in total, not O(faces x shape).
+ *
+ * Use get() to share one index per shape and pose. The index is immutable
+ * after construction and safe to read from any thread.
+ */
+class ShapeAnalysisIndex {
+public:
+    enum class SurfaceKind {
+        Plane,
+        Cylinder,
+        Cone,
+        Sphere,
+        Torus,
+        Other
+    };
+
+    struct FaceInfo {
+        TopoDS_Face face;
+        SurfaceKind kind = SurfaceKind::Other;
+        Bnd_Box bounds;
+        gp_Ax1 axis;            ///< Revolution axis (plane normal for planes)
+        double radius = 0.0;    ///< Cylinder/sphere radius, cone reference radius, torus major radius
+
+        bool isRevolved() const {
+            return kind == SurfaceKind::Cylinder || kind == SurfaceKind::Cone ||
+                   kind == SurfaceKind::Sphere || kind == SurfaceKind::Torus;
+        }
+    };
+
+    /** @brief Extent of the shape's bounding box projected onto an axis */
+    struct AxialExtent {
+        double min = 0.0;
+        double max = 0.0;
+        double length() const { return max - min; }
+    };
+
+    /** @brief Axis shared by one or more coaxial revolved faces */
+    struct AxisCandidate {
+        gp_Ax1 axis;
+        double maxRadius = 0.0;
+        int faceCount = 0;
+    };
+
+    /**
+     * @brief Shared index for a shape, built on first use
+     *
+     * Keyed by TShape, orientation and location, so a moved copy of a
+     * workpiece gets its own entry. The most recent shapes are kept.
+     */
+    static std::shared_ptr<const ShapeAnalysisIndex> get(const TopoDS_Shape& shape);
+    static void clearCache();
+
+    explicit ShapeAnalysisIndex(const TopoDS_Shape& shape);
+
+    const TopoDS_Shape& getShape() const { return shape_; }
+    bool isEmpty() const { return bounds_.IsVoid(); }
+
+    const Bnd_Box& getBounds() const { return bounds_; }
+    const std::vector<FaceInfo>& getFaces() const { return faces_; }
+    std::vector<const FaceInfo*> getFaces(SurfaceKind kind) const;
+
+    /**
+     * @brief Project the bounding box corners onto the axis
+     * @return {0, 0} for an empty shape
+     */
+    AxialExtent getAxialExtent(const gp_Ax1& axis) const;
+
+    /**
+     * @brief Extent along the axis of the shape moved by @p placement
+     *
+     * Lets callers that only need a posed extent reuse the index of the
+     * unmoved shape instead of indexing a fresh transformed copy.
+     */
+    AxialExtent getAxialExtent(const gp_Ax1& axis, const gp_Trsf& placement) const;
+
+    /** @brief Distinct axes of revolved faces, largest radius first */
+    const std::vector<AxisCandidate>& getCandidateTurningAxes() const { return axes_; }
+
+private:
+    void addFace(const TopoDS_Face& face);
+    void collectAxes();
+
+    TopoDS_Shape shape_;
+    Bnd_Box bounds_;
+    std::vector<FaceInfo> faces_;
+    std::vector<AxisCandidate> axes_;
+};
+
+} // namespace Geometry
+} // namespace IntuiCAM
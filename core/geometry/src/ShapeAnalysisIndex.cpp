@@ -0,0 +1,227 @@
+#include <IntuiCAM/Geometry/ShapeAnalysisIndex.h>
+#include <IntuiCAM/Common/Trace.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <mutex>
+
+// OpenCASCADE includes
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepBndLib.hxx>
+#include <GeomAbs_SurfaceType.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
+#include <gp_Lin.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+
+namespace IntuiCAM {
+namespace Geometry {
+
+namespace {
+constexpr size_t kCacheCapacity = 8;
+constexpr double kPoseTolerance = 1e-9;
+constexpr double kCoaxialDistance = 1e-6;   // mm
+constexpr double kCoaxialAngle = 1e-6;      // rad
+
+bool sameTransform(const gp_Trsf& a, const gp_Trsf& b) {
+    for (int row = 1; row <= 3; ++row) {
+        for (int col = 1; col <= 4; ++col) {
+            if (std::abs(a.Value(row, col) - b.Value(row, col)) > kPoseTolerance) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool isCoaxial(const gp_Ax1& a, const gp_Ax1& b) {
+    return a.IsParallel(b, kCoaxialAngle) && gp_Lin(a).Distance(b.Location()) <= kCoaxialDistance;
+}
+
+struct CacheEntry {
+    TopoDS_Shape shape;     // keeps the TShape alive while cached
+    gp_Trsf pose;
+    std::shared_ptr<const ShapeAnalysisIndex> index;
+};
+
+std::mutex g_cacheMutex;
+std::list<CacheEntry> g_cache;   // most recently used first
+}
+
+std::shared_ptr<const ShapeAnalysisIndex> ShapeAnalysisIndex::get(const TopoDS_Shape& shape) {
+    if (shape.IsNull()) {
+        return std::make_shared<const ShapeAnalysisIndex>(shape);
+    }
+
+    gp_Trsf pose = shape.Location().Transformation();
+    {
+        std::lock_guard<std::mutex> lock(g_cacheMutex);
+        for (auto it = g_cache.begin(); it != g_cache.end(); ++it) {
+            if (it->shape.TShape() == shape.TShape() &&
+                it->shape.Orientation() == shape.Orientation() &&
+                sameTransform(it->pose, pose)) {
+                g_cache.splice(g_cache.begin(), g_cache, it);
+                return g_cache.front().index;
+            }
+        }
+    }
+
+    // Build outside the lock; a concurrent duplicate build is harmless
+    auto index = std::make_shared<const ShapeAnalysisIndex>(shape);
+
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    g_cache.push_front(CacheEntry{shape, pose, index});
+    while (g_cache.size() > kCacheCapacity) {
+        g_cache.pop_back();
+    }
+    return index;
+}
+
+void ShapeAnalysisIndex::clearCache() {
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    g_cache.clear();
+}
+
+ShapeAnalysisIndex::ShapeAnalysisIndex(const TopoDS_Shape& shape)
+    : shape_(shape) {
+    if (shape.IsNull()) {
+        return;
+    }
+
+    TRACE_SPAN("geometry", "ShapeAnalysisIndex::build");
+    for (TopExp_Explorer explorer(shape, TopAbs_FACE); explorer.More(); explorer.Next()) {
+        addFace(TopoDS::Face(explorer.Current()));
+    }
+
+    // Wire and vertex-only shapes have no faces to accumulate
+    if (faces_.empty()) {
+        BRepBndLib::Add(shape, bounds_);
+    }
+
+    collectAxes();
+}
+
+void ShapeAnalysisIndex::addFace(const TopoDS_Face& face) {
+    FaceInfo info;
+    info.face = face;
+    BRepBndLib::Add(face, info.bounds);
+    if (!info.bounds.IsVoid()) {
+        bounds_.Add(info.bounds);
+    }
+
+    BRepAdaptor_Surface surface(face);
+    switch (surface.GetType()) {
+        case GeomAbs_Plane:
+            info.kind = SurfaceKind::Plane;
+            info.axis = surface.Plane().Axis();
+            break;
+        case GeomAbs_Cylinder:
+            info.kind = SurfaceKind::Cylinder;
+            info.axis = surface.Cylinder().Axis();
+            info.radius = surface.Cylinder().Radius();
+            break;
+        case GeomAbs_Cone:
+            info.kind = SurfaceKind::Cone;
+            info.axis = surface.Cone().Axis();
+            info.radius = surface.Cone().RefRadius();
+            break;
+        case GeomAbs_Sphere:
+            info.kind = SurfaceKind::Sphere;
+            info.axis = surface.Sphere().Position().Axis();
+            info.radius = surface.Sphere().Radius();
+            break;
+        case GeomAbs_Torus:
+            info.kind = SurfaceKind::Torus;
+            info.axis = surface.Torus().Axis();
+            info.radius = surface.Torus().MajorRadius();
+            break;
+        default:
+            info.kind = SurfaceKind::Other;
+            break;
+    }
+
+    faces_.push_back(std::move(info));
+}
+
+void ShapeAnalysisIndex::collectAxes() {
+    for (const FaceInfo& face : faces_) {
+        // A sphere's axis is arbitrary and says nothing about the turning axis
+        if (!face.isRevolved() || face.kind == SurfaceKind::Sphere) {
+            continue;
+        }
+
+        auto match = std::find_if(axes_.begin(), axes_.end(), [&face](const AxisCandidate& candidate) {
+            return isCoaxial(candidate.axis, face.axis);
+        });
+        if (match == axes_.end()) {
+            axes_.push_back(AxisCandidate{face.axis, face.radius, 1});
+        } else {
+            match->maxRadius = std::max(match->maxRadius, face.radius);
+            ++match->faceCount;
+        }
+    }
+
+    std::stable_sort(axes_.begin(), axes_.end(), [](const AxisCandidate& a, const AxisCandidate& b) {
+        return a.maxRadius > b.maxRadius;
+    });
+}
+
+std::vector<const ShapeAnalysisIndex::FaceInfo*> ShapeAnalysisIndex::getFaces(SurfaceKind kind) const {
+    std::vector<const FaceInfo*> result;
+    for (const FaceInfo& face : faces_) {
+        if (face.kind == kind) {
+            result.push_back(&face);
+        }
+    }
+    return result;
+}
+
+ShapeAnalysisIndex::AxialExtent ShapeAnalysisIndex::getAxialExtent(const gp_Ax1& axis) const {
+    AxialExtent extent;
+    if (bounds_.IsVoid()) {
+        return extent;
+    }
+
+    double xmin, ymin, zmin, xmax, ymax, zmax;
+    bounds_.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+
+    const gp_Pnt corners[8] = {
+        gp_Pnt(xmin, ymin, zmin), gp_Pnt(xmax, ymin, zmin),
+        gp_Pnt(xmin, ymax, zmin), gp_Pnt(xmax, ymax, zmin),
+        gp_Pnt(xmin, ymin, zmax), gp_Pnt(xmax, ymin, zmax),
+        gp_Pnt(xmin, ymax, zmax), gp_Pnt(xmax, ymax, zmax)
+    };
+
+    extent.min = std::numeric_limits<double>::max();
+    extent.max = std::numeric_limits<double>::lowest();
+    const gp_Vec direction(axis.Direction());
+    for (const gp_Pnt& corner : corners) {
+        double projection = gp_Vec(axis.Location(), corner).Dot(direction);
+        extent.min = std::min(extent.min, projection);
+        extent.max = std::max(extent.max, projection);
+    }
+    return extent;
+}
+
+ShapeAnalysisIndex::AxialExtent ShapeAnalysisIndex::getAxialExtent(const gp_Ax1& axis,
+                                                                   const gp_Trsf& placement) const {
+    if (placement.Form() == gp_Identity) {
+        return getAxialExtent(axis);
+    }
+
+    // (T p - o) . d = |s| (p - T^-1 o) . (T^-1 d): project onto the axis
+    // pulled back into the shape's frame, then scale. gp_Dir already carries
+    // the sign of a negative scale.
+    AxialExtent extent = getAxialExtent(axis.Transformed(placement.Inverted()));
+    const double scale = std::abs(placement.ScaleFactor());
+    extent.min *= scale;
+    extent.max *= scale;
+    return extent;
+}
+
+} // namespace Geometry
+} // namespace IntuiCAM
@@ -1,6 +1,6 @@
 #include <IntuiCAM/Geometry/StepLoader.h>
+#include <IntuiCAM/Common/Trace.h>
 #include <IntuiCAM/Common/Types.h>
-#include <iostream>
 #include <fstream>
 
 namespace IntuiCAM {
@@ -48,6 +48,7 @@ public:
 };
 
 StepLoader::ImportResult StepLoader::importStepFile(const std::string& filePath) {
+    TRACE_SPAN("io", "StepLoader::importStepFile");
     ImportResult result;
     
     // Check if file exists
@@ -65,7 +66,7 @@ StepLoader::ImportResult StepLoader::importStepFile(const std::string& filePath)
         result.parts.push_back(std::move(part));
         result.success = true;
         
-        std::cout << "Note: Using simplified STEP loader - created default part" << std::endl;
+        LOG_INFO("Note: Using simplified STEP loader - created default part");
     } catch (const std::exception& e) {
         result.success = false;
         result.errorMessage = "Error creating part: " + std::string(e.what());
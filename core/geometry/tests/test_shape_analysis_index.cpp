@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/Geometry/ShapeAnalysisIndex.h>
+
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepBuilderAPI_Transform.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <gp_Ax2.hxx>
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace IntuiCAM::Geometry;
+
+namespace {
+// Two coaxial cylinders along Z: diameter 40 x 30 long, then diameter 20 x 20 long
+TopoDS_Shape makeSteppedShaft() {
+    TopoDS_Shape large = BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0, 0, 0), gp_Dir(0, 0, 1)), 20.0, 30.0).Shape();
+    TopoDS_Shape small = BRepPrimAPI_MakeCylinder(gp_Ax2(gp_Pnt(0, 0, 30), gp_Dir(0, 0, 1)), 10.0, 20.0).Shape();
+    return BRepAlgoAPI_Fuse(large, small).Shape();
+}
+}
+
+TEST(ShapeAnalysisIndexTest, ClassifiesFaces) {
+    ShapeAnalysisIndex index(makeSteppedShaft());
+
+    auto cylinders = index.getFaces(ShapeAnalysisIndex::SurfaceKind::Cylinder);
+    ASSERT_EQ(cylinders.size(), 2u);
+    EXPECT_FALSE(index.getFaces(ShapeAnalysisIndex::SurfaceKind::Plane).empty());
+}
+
+TEST(ShapeAnalysisIndexTest, MergesCoaxialTurningAxes) {
+    ShapeAnalysisIndex index(makeSteppedShaft());
+
+    const auto& axes = index.getCandidateTurningAxes();
+    ASSERT_EQ(axes.size(), 1u);
+    EXPECT_NEAR(axes[0].maxRadius, 20.0, 1e-9);
+    EXPECT_EQ(axes[0].faceCount, 2);
+    EXPECT_TRUE(axes[0].axis.Direction().IsParallel(gp_Dir(0, 0, 1), 1e-9));
+}
+
+TEST(ShapeAnalysisIndexTest, AxialExtentCoversShape) {
+    ShapeAnalysisIndex index(makeSteppedShaft());
+
+    auto extent = index.getAxialExtent(gp_Ax1(gp_Pnt(0, 0, 0), gp_Dir(0, 0, 1)));
+    EXPECT_NEAR(extent.min, 0.0, 1e-3);
+    EXPECT_NEAR(extent.max, 50.0, 1e-3);
+}
+
+TEST(ShapeAnalysisIndexTest, SharesIndexPerPose) {
+    ShapeAnalysisIndex::clearCache();
+    TopoDS_Shape shaft = makeSteppedShaft();
+
+    auto first = ShapeAnalysisIndex::get(shaft);
+    EXPECT_EQ(ShapeAnalysisIndex::get(shaft), first);
+
+    gp_Trsf shift;
+    shift.SetTranslation(gp_Vec(0, 0, 10));
+    TopoDS_Shape moved = BRepBuilderAPI_Transform(shaft, shift).Shape();
+    auto movedIndex = ShapeAnalysisIndex::get(moved);
+    EXPECT_NE(movedIndex, first);
+    EXPECT_NEAR(movedIndex->getBounds().CornerMin().Z(), first->getBounds().CornerMin().Z() + 10.0, 1e-6);
+}
+
+TEST(ShapeAnalysisIndexTest, NullShapeIsEmpty) {
+    auto index = ShapeAnalysisIndex::get(TopoDS_Shape());
+    EXPECT_TRUE(index->isEmpty());
+    EXPECT_TRUE(index->getFaces().empty());
+    EXPECT_EQ(index->getAxialExtent(gp_Ax1()).length(), 0.0);
+}
+
+TEST(ShapeAnalysisIndexTest, PosedExtentMatchesTransformedCopy) {
+    TopoDS_Shape shaft = makeSteppedShaft();
+    ShapeAnalysisIndex index(shaft);
+
+    // Lay the shaft along X and shift it, as workpiece placement does
+    gp_Trsf placement;
+    placement.SetRotation(gp_Ax1(gp_Pnt(0, 0, 0), gp_Dir(0, 1, 0)), M_PI / 2.0);
+    gp_Trsf shift;
+    shift.SetTranslation(gp_Vec(5, 0, -12));
+    placement.PreMultiply(shift);
+    ShapeAnalysisIndex moved(BRepBuilderAPI_Transform(shaft, placement).Shape());
+
+    for (const gp_Ax1& axis : {gp_Ax1(gp_Pnt(0, 0, 0), gp_Dir(1, 0, 0)), gp_Ax1(gp_Pnt(3, 1, 2), gp_Dir(0, 0, 1))}) {
+        auto posed = index.getAxialExtent(axis, placement);
+        auto expected = moved.getAxialExtent(axis);
+        EXPECT_NEAR(posed.min, expected.min, 1e-3);
+        EXPECT_NEAR(posed.max, expected.max, 1e-3);
+    }
+}
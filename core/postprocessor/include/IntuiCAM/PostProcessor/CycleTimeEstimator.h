@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <IntuiCAM/PostProcessor/Types.h>
+
+namespace IntuiCAM {
+namespace PostProcessor {
+
+/**
+ * @brief Cycle time estimate from the machine's kinematic limits
+ *
+ * Toolpath::estimateMachiningTime divides distance by feed, which is far off
+ * on programs with many short blocks or frequent direction changes. This
+ * estimator follows the controller instead:
+ * - feeds are resolved per move (G94 mm/min, G95 mm/rev times the spindle
+ *   speed, G96 constant surface speed integrated over the radius change);
+ * - every block accelerates and decelerates with per-axis acceleration limits
+ *   and a jerk-limited (S-curve) ramp;
+ * - look-ahead blends feed moves at corners within junctionDeviation, while
+ *   rapids and mode changes come to a stop;
+ * - no block runs faster than the controller can process blocks;
+ * - dwells and tool changes add their time.
+ *
+ * It reads the movement columns directly with two linear passes, so it is
+ * cheap enough to run after every regeneration.
+ */
+class CycleTimeEstimator {
+public:
+    struct Breakdown {
+        double cutting = 0.0;        // minutes
+        double rapid = 0.0;          // minutes
+        double dwell = 0.0;          // minutes
+        double toolChange = 0.0;     // minutes
+        size_t blocks = 0;
+
+        double total() const { return cutting + rapid + dwell + toolChange; }
+        Breakdown& operator+=(const Breakdown& other);
+    };
+
+    explicit CycleTimeEstimator(const GCodeGenerator::MachineConfig& config);
+
+    Breakdown estimate(const Toolpath::Toolpath& toolpath) const;
+    Breakdown estimate(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths) const;
+
+private:
+    // Velocity-limited block, in mm and seconds
+    struct Block {
+        double length = 0.0;
+        double cruise = 0.0;         // mm/s
+        double acceleration = 0.0;   // mm/s^2 along the path
+        bool blends = false;         // may keep speed into the next block
+    };
+
+    double rampTime(double fromSpeed, double toSpeed, double acceleration) const;
+    double blockTime(const Block& block, double entrySpeed, double exitSpeed) const;
+
+    GCodeGenerator::MachineConfig config_;
+};
+
+} // namespace PostProcessor
+} // namespace IntuiCAM
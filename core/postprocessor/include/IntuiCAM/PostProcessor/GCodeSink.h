@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+namespace IntuiCAM {
+namespace PostProcessor {
+
+/**
+ * @brief Buffered byte sink that G-code is streamed into
+ *
+ * Text is appended to a fixed buffer. When the buffer is full, drain() hands it
+ * to the destination. Numbers are formatted in place with std::to_chars, so
+ * emitting a line never allocates and the output does not depend on the
+ * current locale.
+ *
+ * Write errors are sticky: after the first failure, further output is dropped
+ * and good() returns false.
+ */
+class GCodeSink {
+public:
+    virtual ~GCodeSink() = default;
+
+    GCodeSink(const GCodeSink&) = delete;
+    GCodeSink& operator=(const GCodeSink&) = delete;
+
+    void put(char c) {
+        if (cursor_ == end_ && !makeRoom()) {
+            return;
+        }
+        *cursor_++ = c;
+    }
+
+    void write(const char* data, size_t size);
+    void write(std::string_view text) { write(text.data(), text.size()); }
+
+    /**
+     * @brief Write an integer, left-padded with zeros to @p minWidth digits
+     */
+    void writeInt(long long value, int minWidth = 0);
+
+    /**
+     * @brief Write a value in fixed-point notation with @p decimals digits (0-6)
+     *
+     * Produces the same text as std::fixed << std::setprecision(decimals) in the
+     * classic locale.
+     */
+    void writeFixed(double value, int decimals);
+
+    /**
+     * @brief Push all buffered bytes to the destination
+     * @return false if any write has failed
+     */
+    bool flush();
+
+    bool good() const { return good_; }
+
+    /** @brief Total number of bytes accepted so far */
+    size_t bytesWritten() const { return drained_ + static_cast<size_t>(cursor_ - begin_); }
+
+protected:
+    GCodeSink() = default;
+
+    void setBuffer(char* begin, char* end) {
+        begin_ = cursor_ = begin;
+        end_ = end;
+    }
+
+    /**
+     * @brief Move [begin, cursor) to the destination and reset the cursor
+     * @return false if the destination rejected the data
+     */
+    virtual bool drain() = 0;
+
+    char* begin_ = nullptr;
+    char* cursor_ = nullptr;
+    char* end_ = nullptr;
+    size_t drained_ = 0;
+
+private:
+    bool makeRoom();
+
+    bool good_ = true;
+};
+
+/**
+ * @brief Sink that appends to a std::string, used by the string-returning API
+ */
+class StringSink : public GCodeSink {
+public:
+    explicit StringSink(std::string& target);
+    ~StringSink() override;
+
+protected:
+    bool drain() override;
+
+private:
+    std::string& target_;
+    std::array<char, 4096> buffer_;
+};
+
+/**
+ * @brief Sink that writes into a caller-provided buffer
+ *
+ * Output that does not fit is dropped and the sink reports failure.
+ */
+class BufferSink : public GCodeSink {
+public:
+    BufferSink(char* data, size_t capacity);
+
+    const char* data() const { return begin_; }
+    size_t size() const { return static_cast<size_t>(cursor_ - begin_); }
+    std::string_view view() const { return std::string_view(begin_, size()); }
+
+protected:
+    bool drain() override;
+};
+
+/**
+ * @brief Sink that writes to an open file descriptor, which it does not own
+ */
+class FileDescriptorSink : public GCodeSink {
+public:
+    explicit FileDescriptorSink(int fd);
+    ~FileDescriptorSink() override;
+
+protected:
+    bool drain() override;
+
+private:
+    int fd_;
+    std::array<char, 64 * 1024> buffer_;
+};
+
+/**
+ * @brief Sink that creates (or truncates) a file and writes to it
+ */
+class FileSink : public GCodeSink {
+public:
+    explicit FileSink(const std::string& filePath);
+    ~FileSink() override;
+
+    bool isOpen() const { return file_ != nullptr; }
+
+protected:
+    bool drain() override;
+
+private:
+    std::FILE* file_;
+    std::array<char, 64 * 1024> buffer_;
+};
+
+} // namespace PostProcessor
+} // namespace IntuiCAM
@@ -5,6 +5,7 @@
 #include <memory>
 #include <map>
 #include <IntuiCAM/Toolpath/Types.h>
+#include <IntuiCAM/PostProcessor/GCodeSink.h>
 
 namespace IntuiCAM {
 namespace PostProcessor {
@@ -30,6 +31,21 @@ public:
         bool useToolLengthCompensation = true;
         bool useCoolant = true;
         double safeRetractZ = 5.0;          // mm
+        
+        // Kinematics, used for cycle time estimation
+        double maxAccelerationX = 2000.0;   // mm/s^2 along the X word
+        double maxAccelerationZ = 2000.0;   // mm/s^2 along the Z word
+        double maxJerk = 50000.0;           // mm/s^3 (0 = acceleration-limited)
+        double junctionDeviation = 0.01;    // mm - corner rounding allowed by look-ahead
+        double blockProcessingRate = 500.0; // blocks/s the controller can execute
+        double toolChangeTime = 3.0;        // s
+    };
+    
+    // How G2/G3 blocks give the arc: I/K center offsets from the start point,
+    // or a signed R word (negative for arcs over 180 degrees)
+    enum class ArcFormat {
+        CenterOffset,
+        Radius
     };
     
     struct PostProcessorOptions {
@@ -39,6 +55,7 @@ public:
         bool addSafetyMoves = true;
         int lineNumberIncrement = 10;
         std::string programNumber = "1001";
+        ArcFormat arcFormat = ArcFormat::CenterOffset;
     };
     
 private:
@@ -47,16 +64,27 @@ private:
     int currentLineNumber_;
     
 public:
-    GCodeGenerator(const MachineConfig& config = MachineConfig{});
+    GCodeGenerator();
+    GCodeGenerator(const MachineConfig& config);
     
     // Configuration
     void setMachineConfig(const MachineConfig& config) { config_ = config; }
+    const MachineConfig& getMachineConfig() const { return config_; }
     void setOptions(const PostProcessorOptions& options) { options_ = options; }
     
     // G-code generation
     std::string generateGCode(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths);
     std::string generateGCode(const Toolpath::Toolpath& toolpath);
     
+    /**
+     * @brief Stream a complete program into @p sink without building it in memory
+     *
+     * Produces the same text as generateGCode(). The sink is flushed at the end;
+     * check sink.good() for write errors.
+     */
+    void writeGCode(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths, GCodeSink& sink);
+    void writeGCode(const Toolpath::Toolpath& toolpath, GCodeSink& sink);
+    
     // Individual G-code commands
     std::string generateProgramHeader(const std::string& programName = "");
     std::string generateProgramFooter();
@@ -70,10 +98,28 @@ public:
     std::vector<std::string> checkMachineLimits(const Toolpath::Toolpath& toolpath) const;
     
 private:
-    std::string formatLineNumber();
-    std::string formatCoordinate(double value, char axis) const;
-    std::string formatFeedRate(double feedRate) const;
-    std::string formatSpindleSpeed(double rpm) const;
+    // Streaming writers backing both the sink and the string API
+    void writeToolpath(const Toolpath::Toolpath& toolpath, GCodeSink& sink);
+    void writeProgramHeader(GCodeSink& sink, const std::string& programName);
+    void writeProgramFooter(GCodeSink& sink);
+    void writeToolChange(GCodeSink& sink, const Toolpath::Tool& tool, int toolNumber);
+    void writeMovement(GCodeSink& sink, Toolpath::MovementType type, const Geometry::Point3D& start,
+                       const Geometry::Point3D& position, const Geometry::Point3D& center,
+                       double feedRate, Toolpath::FeedMode feedMode, const std::string& comment);
+    void writeArcWords(GCodeSink& sink, bool clockwise, const Geometry::Point3D& start,
+                       const Geometry::Point3D& end, const Geometry::Point3D& center) const;
+    void writeSpindleControl(GCodeSink& sink, double rpm, bool clockwise);
+    void writeConstantSurfaceSpeed(GCodeSink& sink, double surfaceSpeed, double maxRpm);
+    void writeConstantSpindleSpeed(GCodeSink& sink, double rpm);
+    void writeFeedMode(GCodeSink& sink, Toolpath::FeedMode feedMode);
+    void writeSpindleAndFeedReset(GCodeSink& sink);
+    void writeCoolantControl(GCodeSink& sink, bool on);
+    
+    void writeLineNumber(GCodeSink& sink);
+    void writeComment(GCodeSink& sink, std::string_view comment) const;
+    void writeCoordinate(GCodeSink& sink, double value, char axis) const;
+    void writeFeedRate(GCodeSink& sink, double feedRate, Toolpath::FeedMode feedMode) const;
+    void writeSpindleSpeed(GCodeSink& sink, double rpm) const;
 };
 
 // Post-processor for specific machine types
@@ -107,6 +153,15 @@ public:
     ProcessingResult process(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths);
     ProcessingResult process(const Toolpath::Toolpath& toolpath);
     
+    /**
+     * @brief Stream the program into @p sink instead of ProcessingResult::gcode
+     *
+     * The returned gcode string stays empty. Write failures are reported in errors.
+     */
+    ProcessingResult process(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths, GCodeSink& sink);
+    ProcessingResult processToFile(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths,
+                                   const std::string& outputPath);
+    
     // Machine-specific customization
     void customizeForMachine(MachineType type);
     void loadMachineProfile(const std::string& profilePath);
@@ -0,0 +1,294 @@
+#include <IntuiCAM/PostProcessor/CycleTimeEstimator.h>
+#include <IntuiCAM/Common/Trace.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace IntuiCAM {
+namespace PostProcessor {
+
+namespace {
+
+using Toolpath::MovementType;
+using Toolpath::MovementView;
+
+bool isCircular(MovementType type) {
+    return type == MovementType::CircularCW || type == MovementType::CircularCCW;
+}
+
+// Unit direction of travel in the (X word, Z word) plane at the start or end of a move
+void travelDirection(const MovementView& moves, size_t index, bool atEnd, double& ux, double& uz) {
+    const Geometry::Point3D start = moves.startPoint(index);
+    const Geometry::Point3D end = moves.position(index);
+    const MovementType type = moves.type(index);
+
+    if (isCircular(type)) {
+        // Tangent is the radius turned a quarter turn in the direction of travel
+        const Geometry::Point3D center = moves.arcCenter(index);
+        const Geometry::Point3D& point = atEnd ? end : start;
+        ux = -(point.z - center.z);
+        uz = point.x - center.x;
+        if (type == MovementType::CircularCW) {
+            ux = -ux;
+            uz = -uz;
+        }
+    } else {
+        ux = end.x - start.x;
+        uz = end.z - start.z;
+    }
+
+    const double norm = std::hypot(ux, uz);
+    if (norm > 0.0) {
+        ux /= norm;
+        uz /= norm;
+    }
+}
+
+} // namespace
+
+CycleTimeEstimator::Breakdown& CycleTimeEstimator::Breakdown::operator+=(const Breakdown& other) {
+    cutting += other.cutting;
+    rapid += other.rapid;
+    dwell += other.dwell;
+    toolChange += other.toolChange;
+    blocks += other.blocks;
+    return *this;
+}
+
+CycleTimeEstimator::CycleTimeEstimator(const GCodeGenerator::MachineConfig& config)
+    : config_(config) {
+}
+
+CycleTimeEstimator::Breakdown CycleTimeEstimator::estimate(
+    const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths) const {
+    Breakdown total;
+    for (const auto& toolpath : toolpaths) {
+        if (toolpath) {
+            total += estimate(*toolpath);
+        }
+    }
+    return total;
+}
+
+CycleTimeEstimator::Breakdown CycleTimeEstimator::estimate(const Toolpath::Toolpath& toolpath) const {
+    TRACE_SPAN("postprocessor", "CycleTimeEstimator::estimate");
+
+    Breakdown result;
+    const MovementView moves = toolpath.getMovements();
+    const size_t count = moves.size();
+    result.blocks = count;
+
+    // The generator emits a tool change at the start of every toolpath with a tool
+    if (toolpath.getTool()) {
+        result.toolChange += config_.toolChangeTime / 60.0;
+    }
+
+    const double rapidSpeed = config_.rapidFeedRate / 60.0;
+    const double minBlockTime = config_.blockProcessingRate > 0.0 ? 1.0 / config_.blockProcessingRate : 0.0;
+    const double toolSpindleSpeed = toolpath.getTool()
+        ? toolpath.getTool()->getCuttingParameters().spindleSpeed : 0.0;
+
+    // Spindle speed actually reached at a radius, within the machine's limit
+    auto spindleSpeed = [&](size_t index, double radius) {
+        double rpm = Toolpath::spindleSpeedAt(moves, index, radius);
+        if (rpm <= 0.0) {
+            rpm = toolSpindleSpeed;
+        }
+        return config_.maxSpindleSpeed > 0.0 ? std::min(rpm, config_.maxSpindleSpeed) : rpm;
+    };
+
+    // Pass 1: speed and acceleration limits of every block
+    std::vector<Block> blocks(count);
+    for (size_t i = 0; i < count; ++i) {
+        const MovementType type = moves.type(i);
+        if (type != MovementType::Rapid && type != MovementType::Linear && !isCircular(type)) {
+            continue;
+        }
+        Block& block = blocks[i];
+        block.length = Toolpath::movementLength(moves, i);
+        if (block.length <= 0.0) {
+            continue;
+        }
+
+        // Share of the path speed carried by each axis; arcs use both fully
+        const Geometry::Point3D start = moves.startPoint(i);
+        const Geometry::Point3D end = moves.position(i);
+        double shareX = 1.0;
+        double shareZ = 1.0;
+        if (!isCircular(type)) {
+            shareX = std::abs(end.x - start.x) / block.length;
+            shareZ = std::abs(end.z - start.z) / block.length;
+        }
+        const double inf = std::numeric_limits<double>::infinity();
+        block.acceleration = std::min(shareX > 1e-9 ? config_.maxAccelerationX / shareX : inf,
+                                      shareZ > 1e-9 ? config_.maxAccelerationZ / shareZ : inf);
+        if (!std::isfinite(block.acceleration)) {
+            block.acceleration = std::min(config_.maxAccelerationX, config_.maxAccelerationZ);
+        }
+        const double axisSpeedLimit = rapidSpeed / std::max({shareX, shareZ, 1e-9});
+
+        if (type == MovementType::Rapid) {
+            block.cruise = axisSpeedLimit;
+        } else {
+            const double feed = moves.feedRate(i);
+            if (feed <= 0.0) {
+                block.length = 0.0;  // Not executable; counted as a bare block
+                continue;
+            }
+
+            double speed = feed / 60.0;
+            if (moves.feedMode(i) == Toolpath::FeedMode::PerRevolution) {
+                // Time-averaged speed over the radius change (Simpson's rule);
+                // under G96 the spindle speed follows the radius
+                static constexpr double weights[5] = {1.0, 4.0, 2.0, 4.0, 1.0};
+                double inverseSpeed = 0.0;
+                for (int k = 0; k < 5; ++k) {
+                    const double radius = start.z + (end.z - start.z) * k / 4.0;
+                    const double rpm = spindleSpeed(i, radius);
+                    inverseSpeed += weights[k] / std::max(feed * rpm / 60.0, 1e-9);
+                }
+                speed = 12.0 / inverseSpeed;
+            }
+            block.cruise = std::min(speed, axisSpeedLimit);
+            block.blends = true;
+
+            if (isCircular(type)) {
+                // Centripetal acceleration on the arc
+                const Geometry::Point3D center = moves.arcCenter(i);
+                const double radius = std::hypot(start.x - center.x, start.z - center.z);
+                block.cruise = std::min(block.cruise, std::sqrt(block.acceleration * radius));
+            }
+        }
+
+        // Blocks shorter than the processing time cannot be run faster
+        if (minBlockTime > 0.0) {
+            block.cruise = std::min(block.cruise, block.length / minBlockTime);
+        }
+    }
+
+    // Pass 2: junction speeds. junction[i] is the speed entering block i; rapids,
+    // dwells and changes between rapid and feed stop the axes.
+    std::vector<double> junction(count + 1, 0.0);
+    for (size_t i = 1; i < count; ++i) {
+        const Block& previous = blocks[i - 1];
+        const Block& next = blocks[i];
+        if (!previous.blends || !next.blends || previous.length <= 0.0 || next.length <= 0.0) {
+            continue;
+        }
+
+        double px = 0.0, pz = 0.0, nx = 0.0, nz = 0.0;
+        travelDirection(moves, i - 1, true, px, pz);
+        travelDirection(moves, i, false, nx, nz);
+
+        // Junction deviation model: the look-ahead may round the corner by junctionDeviation
+        const double cosTheta = -(px * nx + pz * nz);
+        double speed = std::min(previous.cruise, next.cruise);
+        if (cosTheta > 0.999999) {
+            speed = 0.0;  // Reversal
+        } else if (cosTheta > -0.999999) {
+            const double sinHalf = std::sqrt(0.5 * (1.0 - cosTheta));
+            const double acceleration = std::min(previous.acceleration, next.acceleration);
+            speed = std::min(speed, std::sqrt(acceleration * config_.junctionDeviation * sinHalf / (1.0 - sinHalf)));
+        }
+        junction[i] = speed;
+    }
+
+    // Backward then forward pass keep every junction reachable within its blocks
+    for (size_t i = count; i-- > 0;) {
+        const Block& block = blocks[i];
+        if (block.length > 0.0) {
+            junction[i] = std::min(junction[i], std::sqrt(junction[i + 1] * junction[i + 1] +
+                                                          2.0 * block.acceleration * block.length));
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        const Block& block = blocks[i];
+        if (block.length > 0.0) {
+            junction[i + 1] = std::min(junction[i + 1], std::sqrt(junction[i] * junction[i] +
+                                                                  2.0 * block.acceleration * block.length));
+        }
+    }
+
+    // Pass 3: block times
+    for (size_t i = 0; i < count; ++i) {
+        const MovementType type = moves.type(i);
+        if (type == MovementType::Dwell) {
+            // Same default as the generator's G4 word
+            const double seconds = moves.feedRate(i) > 0.0 ? moves.feedRate(i) : 1.0;
+            result.dwell += seconds / 60.0;
+            continue;
+        }
+        if (type == MovementType::ToolChange) {
+            result.toolChange += config_.toolChangeTime / 60.0;
+            continue;
+        }
+
+        double seconds = minBlockTime;
+        if (blocks[i].length > 0.0) {
+            seconds = std::max(seconds, blockTime(blocks[i], junction[i], junction[i + 1]));
+        }
+        if (type == MovementType::Rapid) {
+            result.rapid += seconds / 60.0;
+        } else {
+            result.cutting += seconds / 60.0;
+        }
+    }
+
+    return result;
+}
+
+double CycleTimeEstimator::rampTime(double fromSpeed, double toSpeed, double acceleration) const {
+    const double change = std::abs(toSpeed - fromSpeed);
+    if (change <= 0.0) {
+        return 0.0;
+    }
+    if (config_.maxJerk <= 0.0) {
+        return change / acceleration;
+    }
+    // S-curve: reaches full acceleration only for large enough speed changes
+    if (change >= acceleration * acceleration / config_.maxJerk) {
+        return change / acceleration + acceleration / config_.maxJerk;
+    }
+    return 2.0 * std::sqrt(change / config_.maxJerk);
+}
+
+double CycleTimeEstimator::blockTime(const Block& block, double entrySpeed, double exitSpeed) const {
+    // Distance used by ramping up to @p peak and back down to the exit speed
+    auto rampDistance = [&](double peak, double& up, double& down) {
+        up = rampTime(entrySpeed, peak, block.acceleration);
+        down = rampTime(peak, exitSpeed, block.acceleration);
+        return 0.5 * (entrySpeed + peak) * up + 0.5 * (peak + exitSpeed) * down;
+    };
+
+    double up = 0.0;
+    double down = 0.0;
+    double peak = block.cruise;
+    double distance = rampDistance(peak, up, down);
+
+    if (distance > block.length) {
+        // Too short to reach cruise speed: find the highest peak that fits
+        double low = std::max(entrySpeed, exitSpeed);
+        if (rampDistance(low, up, down) > block.length) {
+            // The planner's constant-acceleration bound is optimistic under jerk
+            return 2.0 * block.length / std::max(entrySpeed + exitSpeed, 1e-9);
+        }
+        double high = block.cruise;
+        for (int iteration = 0; iteration < 30; ++iteration) {
+            const double middle = 0.5 * (low + high);
+            if (rampDistance(middle, up, down) <= block.length) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+        peak = low;
+        distance = rampDistance(peak, up, down);
+    }
+
+    const double cruiseTime = peak > 0.0 ? (block.length - distance) / peak : 0.0;
+    return up + down + std::max(0.0, cruiseTime);
+}
+
+} // namespace PostProcessor
+} // namespace IntuiCAM
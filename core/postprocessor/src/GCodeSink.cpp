@@ -0,0 +1,168 @@
+#include <IntuiCAM/PostProcessor/GCodeSink.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <cerrno>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace IntuiCAM {
+namespace PostProcessor {
+
+namespace {
+constexpr int kMaxDecimals = 6;
+}
+
+// GCodeSink implementation
+bool GCodeSink::makeRoom() {
+    if (good_ && !drain()) {
+        good_ = false;
+    }
+    // A sink that cannot make room (e.g. a full caller buffer) fails as well
+    if (cursor_ == end_) {
+        good_ = false;
+    }
+    return good_;
+}
+
+void GCodeSink::write(const char* data, size_t size) {
+    while (size > 0) {
+        if (cursor_ == end_ && !makeRoom()) {
+            return;
+        }
+        size_t chunk = std::min(size, static_cast<size_t>(end_ - cursor_));
+        std::memcpy(cursor_, data, chunk);
+        cursor_ += chunk;
+        data += chunk;
+        size -= chunk;
+    }
+}
+
+void GCodeSink::writeInt(long long value, int minWidth) {
+    char text[24];
+    char* digits = text;
+    unsigned long long magnitude = static_cast<unsigned long long>(value);
+    if (value < 0) {
+        *digits++ = '-';
+        magnitude = 0 - magnitude;
+    }
+
+    char number[24];
+    char* numberEnd = std::to_chars(number, number + sizeof(number), magnitude).ptr;
+    int length = static_cast<int>(numberEnd - number);
+    for (int pad = std::min(minWidth, 20) - length; pad > 0; --pad) {
+        *digits++ = '0';
+    }
+    std::memcpy(digits, number, static_cast<size_t>(length));
+    write(text, static_cast<size_t>(digits - text) + static_cast<size_t>(length));
+}
+
+void GCodeSink::writeFixed(double value, int decimals) {
+    // Large enough for any finite double in fixed notation
+    char text[400];
+    auto result = std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed,
+                                std::clamp(decimals, 0, kMaxDecimals));
+    if (result.ec == std::errc()) {
+        write(text, static_cast<size_t>(result.ptr - text));
+    }
+}
+
+bool GCodeSink::flush() {
+    if (good_ && cursor_ != begin_ && !drain()) {
+        good_ = false;
+    }
+    return good_;
+}
+
+// StringSink implementation
+StringSink::StringSink(std::string& target) : target_(target) {
+    setBuffer(buffer_.data(), buffer_.data() + buffer_.size());
+}
+
+StringSink::~StringSink() {
+    flush();
+}
+
+bool StringSink::drain() {
+    target_.append(begin_, cursor_);
+    drained_ += static_cast<size_t>(cursor_ - begin_);
+    cursor_ = begin_;
+    return true;
+}
+
+// BufferSink implementation
+BufferSink::BufferSink(char* data, size_t capacity) {
+    setBuffer(data, data + capacity);
+}
+
+bool BufferSink::drain() {
+    // The caller's buffer is the destination; there is nowhere to drain to
+    return true;
+}
+
+// FileDescriptorSink implementation
+FileDescriptorSink::FileDescriptorSink(int fd) : fd_(fd) {
+    setBuffer(buffer_.data(), buffer_.data() + buffer_.size());
+}
+
+FileDescriptorSink::~FileDescriptorSink() {
+    flush();
+}
+
+bool FileDescriptorSink::drain() {
+    const char* data = begin_;
+    while (data < cursor_) {
+#ifdef _WIN32
+        int written = ::_write(fd_, data, static_cast<unsigned int>(cursor_ - data));
+#else
+        ssize_t written = ::write(fd_, data, static_cast<size_t>(cursor_ - data));
+#endif
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+    }
+    drained_ += static_cast<size_t>(cursor_ - begin_);
+    cursor_ = begin_;
+    return true;
+}
+
+// FileSink implementation
+FileSink::FileSink(const std::string& filePath) : file_(std::fopen(filePath.c_str(), "wb")) {
+    setBuffer(buffer_.data(), buffer_.data() + buffer_.size());
+    if (file_) {
+        // Output is already buffered here; skip the stdio buffer copy
+        std::setvbuf(file_, nullptr, _IONBF, 0);
+    }
+}
+
+FileSink::~FileSink() {
+    flush();
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+bool FileSink::drain() {
+    if (!file_) {
+        return false;
+    }
+    size_t size = static_cast<size_t>(cursor_ - begin_);
+    if (std::fwrite(begin_, 1, size, file_) != size) {
+        return false;
+    }
+    drained_ += size;
+    cursor_ = begin_;
+    return true;
+}
+
+} // namespace PostProcessor
+} // namespace IntuiCAM
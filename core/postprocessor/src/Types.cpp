@@ -1,189 +1,388 @@
+#define _USE_MATH_DEFINES
 #include <IntuiCAM/PostProcessor/Types.h>
-#include <sstream>
-#include <iomanip>
+#include <IntuiCAM/PostProcessor/CycleTimeEstimator.h>
+#include <IntuiCAM/Common/Trace.h>
 #include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
 
 namespace IntuiCAM {
 namespace PostProcessor {
 
 // GCodeGenerator implementation
+GCodeGenerator::GCodeGenerator()
+    : GCodeGenerator(MachineConfig{}) {
+}
+
 GCodeGenerator::GCodeGenerator(const MachineConfig& config)
     : config_(config), currentLineNumber_(10) {
 }
 
 std::string GCodeGenerator::generateGCode(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths) {
-    std::ostringstream gcode;
+    std::string gcode;
+    {
+        StringSink sink(gcode);
+        writeGCode(toolpaths, sink);
+    }
+    return gcode;
+}
+
+std::string GCodeGenerator::generateGCode(const Toolpath::Toolpath& toolpath) {
+    std::string gcode;
+    {
+        StringSink sink(gcode);
+        writeToolpath(toolpath, sink);
+    }
+    return gcode;
+}
+
+void GCodeGenerator::writeGCode(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths, GCodeSink& sink) {
+    TRACE_SPAN("postprocessor", "GCodeGenerator::writeGCode");
     
     // Program header
-    gcode << generateProgramHeader();
+    writeProgramHeader(sink, "");
     
     // Process each toolpath
     for (const auto& toolpath : toolpaths) {
         if (toolpath) {
-            gcode << generateGCode(*toolpath);
+            writeToolpath(*toolpath, sink);
         }
     }
     
     // Program footer
-    gcode << generateProgramFooter();
-    
-    return gcode.str();
+    writeProgramFooter(sink);
+    sink.flush();
 }
 
-std::string GCodeGenerator::generateGCode(const Toolpath::Toolpath& toolpath) {
-    std::ostringstream gcode;
-    
+void GCodeGenerator::writeGCode(const Toolpath::Toolpath& toolpath, GCodeSink& sink) {
+    writeToolpath(toolpath, sink);
+    sink.flush();
+}
+
+void GCodeGenerator::writeToolpath(const Toolpath::Toolpath& toolpath, GCodeSink& sink) {
     // Tool change if needed
+    double toolSpindleSpeed = 0.0;
     if (toolpath.getTool()) {
-        gcode << generateToolChange(*toolpath.getTool(), 1);
+        writeToolChange(sink, *toolpath.getTool(), 1);
+        toolSpindleSpeed = toolpath.getTool()->getCuttingParameters().spindleSpeed;
+    } else {
+        // A previous toolpath may have left G96 or G95 active
+        writeSpindleAndFeedReset(sink);
     }
     
-    // Process movements
-    for (const auto& movement : toolpath.getMovements()) {
-        gcode << generateMovement(movement);
+    // Modal spindle and feed state; the tool change or reset leaves G97 and G94 active
+    double surfaceSpeed = 0.0;
+    double spindleClamp = 0.0;
+    Toolpath::FeedMode feedMode = Toolpath::FeedMode::PerMinute;
+    
+    // Process movements straight from the compact store
+    const Toolpath::MovementView moves = toolpath.getMovements();
+    for (size_t i = 0; i < moves.size() && sink.good(); ++i) {
+        const Toolpath::MovementType type = moves.type(i);
+        
+        // Dwells and tool changes carry no spindle or feed data of their own
+        if (type != Toolpath::MovementType::Dwell && type != Toolpath::MovementType::ToolChange) {
+            const double moveSurfaceSpeed = moves.surfaceSpeed(i);
+            if (moveSurfaceSpeed > 0.0) {
+                double clamp = moves.spindleSpeed(i) > 0.0 ? moves.spindleSpeed(i) : config_.maxSpindleSpeed;
+                clamp = std::min(clamp, config_.maxSpindleSpeed);
+                if (moveSurfaceSpeed != surfaceSpeed || clamp != spindleClamp) {
+                    writeConstantSurfaceSpeed(sink, moveSurfaceSpeed, clamp);
+                    surfaceSpeed = moveSurfaceSpeed;
+                    spindleClamp = clamp;
+                }
+            } else if (surfaceSpeed > 0.0) {
+                writeConstantSpindleSpeed(sink, moves.spindleSpeed(i) > 0.0 ? moves.spindleSpeed(i) : toolSpindleSpeed);
+                surfaceSpeed = 0.0;
+                spindleClamp = 0.0;
+            }
+            
+            if (type != Toolpath::MovementType::Rapid && moves.feedMode(i) != feedMode) {
+                feedMode = moves.feedMode(i);
+                writeFeedMode(sink, feedMode);
+            }
+        }
+        
+        const Geometry::Point3D position = moves.position(i);
+        if (type == Toolpath::MovementType::CircularCW || type == Toolpath::MovementType::CircularCCW) {
+            writeMovement(sink, type, moves.startPoint(i), position, moves.arcCenter(i),
+                          moves.feedRate(i), moves.feedMode(i), moves.comment(i));
+        } else {
+            writeMovement(sink, type, position, position, position, moves.feedRate(i), moves.feedMode(i),
+                          moves.comment(i));
+        }
     }
     
-    return gcode.str();
+    // Hand the next tool change a spindle in RPM and feeds in mm/min
+    if (surfaceSpeed > 0.0) {
+        writeConstantSpindleSpeed(sink, toolSpindleSpeed);
+    }
+    if (feedMode != Toolpath::FeedMode::PerMinute) {
+        writeFeedMode(sink, Toolpath::FeedMode::PerMinute);
+    }
 }
 
 std::string GCodeGenerator::generateProgramHeader(const std::string& programName) {
-    std::ostringstream header;
-    
+    std::string header;
+    {
+        StringSink sink(header);
+        writeProgramHeader(sink, programName);
+    }
+    return header;
+}
+
+std::string GCodeGenerator::generateProgramFooter() {
+    std::string footer;
+    {
+        StringSink sink(footer);
+        writeProgramFooter(sink);
+    }
+    return footer;
+}
+
+std::string GCodeGenerator::generateToolChange(const Toolpath::Tool& tool, int toolNumber) {
+    std::string toolChange;
+    {
+        StringSink sink(toolChange);
+        writeToolChange(sink, tool, toolNumber);
+    }
+    return toolChange;
+}
+
+std::string GCodeGenerator::generateMovement(const Toolpath::Movement& movement) {
+    std::string move;
+    {
+        StringSink sink(move);
+        writeMovement(sink, movement.type, movement.startPoint, movement.position, movement.center,
+                      movement.feedRate, movement.feedMode, movement.comment);
+    }
+    return move;
+}
+
+std::string GCodeGenerator::generateSpindleControl(double rpm, bool clockwise) {
+    std::string spindle;
+    {
+        StringSink sink(spindle);
+        writeSpindleControl(sink, rpm, clockwise);
+    }
+    return spindle;
+}
+
+std::string GCodeGenerator::generateCoolantControl(bool on) {
+    std::string coolant;
+    {
+        StringSink sink(coolant);
+        writeCoolantControl(sink, on);
+    }
+    return coolant;
+}
+
+void GCodeGenerator::writeProgramHeader(GCodeSink& sink, const std::string& programName) {
     if (options_.includeComments) {
-        header << "; IntuiCAM Generated G-Code\n";
-        header << "; Program: " << (programName.empty() ? options_.programNumber : programName) << "\n";
-        header << "; Machine: " << config_.machineName << "\n";
-        header << "; Units: " << config_.units << "\n\n";
+        sink.write("; IntuiCAM Generated G-Code\n");
+        sink.write("; Program: ");
+        sink.write(programName.empty() ? options_.programNumber : programName);
+        sink.write("\n; Machine: ");
+        sink.write(config_.machineName);
+        sink.write("\n; Units: ");
+        sink.write(config_.units);
+        sink.write("\n\n");
     }
     
     // Program number
-    header << "O" << options_.programNumber << "\n";
+    sink.put('O');
+    sink.write(options_.programNumber);
+    sink.put('\n');
     
     // Initialize machine
-    header << formatLineNumber() << "G21"; // Metric units
-    if (options_.includeComments) header << " ; Metric units";
-    header << "\n";
+    writeLineNumber(sink);
+    sink.write("G21"); // Metric units
+    writeComment(sink, "Metric units");
+    sink.put('\n');
     
-    header << formatLineNumber() << "G90"; // Absolute coordinates
-    if (options_.includeComments) header << " ; Absolute coordinates";
-    header << "\n";
+    writeLineNumber(sink);
+    sink.write("G90"); // Absolute coordinates
+    writeComment(sink, "Absolute coordinates");
+    sink.put('\n');
     
-    header << formatLineNumber() << "G40"; // Cancel cutter compensation
-    if (options_.includeComments) header << " ; Cancel cutter compensation";
-    header << "\n";
+    writeLineNumber(sink);
+    sink.write("G40"); // Cancel cutter compensation
+    writeComment(sink, "Cancel cutter compensation");
+    sink.put('\n');
     
-    return header.str();
+    writeSpindleAndFeedReset(sink);
 }
 
-std::string GCodeGenerator::generateProgramFooter() {
-    std::ostringstream footer;
-    
+void GCodeGenerator::writeProgramFooter(GCodeSink& sink) {
     // Stop spindle and coolant
-    footer << formatLineNumber() << "M5";
-    if (options_.includeComments) footer << " ; Stop spindle";
-    footer << "\n";
+    writeLineNumber(sink);
+    sink.write("M5");
+    writeComment(sink, "Stop spindle");
+    sink.put('\n');
     
-    footer << formatLineNumber() << "M9";
-    if (options_.includeComments) footer << " ; Coolant off";
-    footer << "\n";
+    writeLineNumber(sink);
+    sink.write("M9");
+    writeComment(sink, "Coolant off");
+    sink.put('\n');
     
     // Return to home
-    footer << formatLineNumber() << "G28 U0 W0";
-    if (options_.includeComments) footer << " ; Return to home";
-    footer << "\n";
+    writeLineNumber(sink);
+    sink.write("G28 U0 W0");
+    writeComment(sink, "Return to home");
+    sink.put('\n');
     
     // End program
-    footer << formatLineNumber() << "M30";
-    if (options_.includeComments) footer << " ; End program";
-    footer << "\n";
-    
-    return footer.str();
+    writeLineNumber(sink);
+    sink.write("M30");
+    writeComment(sink, "End program");
+    sink.put('\n');
 }
 
-std::string GCodeGenerator::generateToolChange(const Toolpath::Tool& tool, int toolNumber) {
-    std::ostringstream toolChange;
-    
-    toolChange << formatLineNumber() << "T" << std::setfill('0') << std::setw(2) << toolNumber;
+void GCodeGenerator::writeToolChange(GCodeSink& sink, const Toolpath::Tool& tool, int toolNumber) {
+    writeLineNumber(sink);
+    sink.put('T');
+    sink.writeInt(toolNumber, 2);
     if (options_.includeComments) {
-        toolChange << " ; Tool change: " << tool.getName();
+        sink.write(" ; Tool change: ");
+        sink.write(tool.getName());
     }
-    toolChange << "\n";
+    sink.put('\n');
+    
+    // S words below are RPM and F words per minute until the toolpath says otherwise
+    writeSpindleAndFeedReset(sink);
     
     // Set cutting parameters
     const auto& params = tool.getCuttingParameters();
-    toolChange << generateSpindleControl(params.spindleSpeed, true);
-    
-    return toolChange.str();
+    writeSpindleControl(sink, params.spindleSpeed, true);
 }
 
-std::string GCodeGenerator::generateMovement(const Toolpath::Movement& movement) {
-    std::ostringstream move;
-    
-    move << formatLineNumber();
+void GCodeGenerator::writeMovement(GCodeSink& sink, Toolpath::MovementType type, const Geometry::Point3D& start,
+                                   const Geometry::Point3D& position, const Geometry::Point3D& center,
+                                   double feedRate, Toolpath::FeedMode feedMode, const std::string& comment) {
+    writeLineNumber(sink);
     
-    switch (movement.type) {
+    switch (type) {
         case Toolpath::MovementType::Rapid:
-            move << "G0";
+            sink.write("G0");
             break;
         case Toolpath::MovementType::Linear:
-            move << "G1";
+            sink.write("G1");
             break;
         case Toolpath::MovementType::CircularCW:
-            move << "G2";
+            sink.write("G2");
             break;
         case Toolpath::MovementType::CircularCCW:
-            move << "G3";
+            sink.write("G3");
             break;
         case Toolpath::MovementType::Dwell:
-            move << "G4 P" << std::fixed << std::setprecision(2) << 1.0; // 1 second dwell
+            // Dwell moves keep their duration in seconds in the feed column
+            sink.write("G4 P");
+            sink.writeFixed(feedRate > 0.0 ? feedRate : 1.0, 2);
             break;
         default:
             break;
     }
     
     // Add coordinates
-    if (movement.type != Toolpath::MovementType::Dwell) {
-        move << formatCoordinate(movement.position.x, 'X');
-        move << formatCoordinate(movement.position.z, 'Z');
+    if (type != Toolpath::MovementType::Dwell) {
+        writeCoordinate(sink, position.x, 'X');
+        writeCoordinate(sink, position.z, 'Z');
         
-        if (movement.feedRate > 0.0 && movement.type != Toolpath::MovementType::Rapid) {
-            move << formatFeedRate(movement.feedRate);
+        if (type == Toolpath::MovementType::CircularCW || type == Toolpath::MovementType::CircularCCW) {
+            writeArcWords(sink, type == Toolpath::MovementType::CircularCW, start, position, center);
+        }
+        
+        if (feedRate > 0.0 && type != Toolpath::MovementType::Rapid) {
+            writeFeedRate(sink, feedRate, feedMode);
         }
     }
     
-    if (options_.includeComments && !movement.comment.empty()) {
-        move << " ; " << movement.comment;
+    if (!comment.empty()) {
+        writeComment(sink, comment);
     }
     
-    move << "\n";
-    return move.str();
+    sink.put('\n');
 }
 
-std::string GCodeGenerator::generateSpindleControl(double rpm, bool clockwise) {
-    std::ostringstream spindle;
+void GCodeGenerator::writeArcWords(GCodeSink& sink, bool clockwise, const Geometry::Point3D& start,
+                                   const Geometry::Point3D& end, const Geometry::Point3D& center) const {
+    if (options_.arcFormat == ArcFormat::Radius) {
+        double radius = std::hypot(start.x - center.x, start.z - center.z);
+        if (std::abs(Toolpath::arcSweepAngle(start, end, center, clockwise)) > M_PI) {
+            radius = -radius;
+        }
+        writeCoordinate(sink, radius, 'R');
+        return;
+    }
     
-    spindle << formatLineNumber();
-    spindle << (clockwise ? "M3" : "M4");
-    spindle << formatSpindleSpeed(rpm);
+    // Incremental center offsets, paired with the X and Z words
+    writeCoordinate(sink, center.x - start.x, 'I');
+    writeCoordinate(sink, center.z - start.z, 'K');
+}
+
+void GCodeGenerator::writeSpindleControl(GCodeSink& sink, double rpm, bool clockwise) {
+    writeLineNumber(sink);
+    sink.write(clockwise ? "M3" : "M4");
+    writeSpindleSpeed(sink, rpm);
     
     if (options_.includeComments) {
-        spindle << " ; Spindle " << (clockwise ? "CW" : "CCW") << " at " << rpm << " RPM";
+        sink.write(clockwise ? " ; Spindle CW at " : " ; Spindle CCW at ");
+        sink.writeFixed(rpm, 0);
+        sink.write(" RPM");
     }
-    spindle << "\n";
-    
-    return spindle.str();
+    sink.put('\n');
 }
 
-std::string GCodeGenerator::generateCoolantControl(bool on) {
-    std::ostringstream coolant;
+void GCodeGenerator::writeConstantSurfaceSpeed(GCodeSink& sink, double surfaceSpeed, double maxRpm) {
+    // Clamp first: G96 alone would spin up without limit towards the center
+    writeLineNumber(sink);
+    sink.write("G50");
+    writeSpindleSpeed(sink, maxRpm);
+    writeComment(sink, "Spindle speed limit");
+    sink.put('\n');
     
-    coolant << formatLineNumber() << (on ? "M8" : "M9");
+    writeLineNumber(sink);
+    sink.write("G96");
+    writeSpindleSpeed(sink, surfaceSpeed);
     if (options_.includeComments) {
-        coolant << " ; Coolant " << (on ? "on" : "off");
+        sink.write(" ; Constant surface speed ");
+        sink.writeFixed(surfaceSpeed, 0);
+        sink.write(" m/min");
     }
-    coolant << "\n";
-    
-    return coolant.str();
+    sink.put('\n');
+}
+
+void GCodeGenerator::writeConstantSpindleSpeed(GCodeSink& sink, double rpm) {
+    writeLineNumber(sink);
+    sink.write("G97");
+    writeSpindleSpeed(sink, rpm);
+    writeComment(sink, "Constant spindle speed");
+    sink.put('\n');
+}
+
+void GCodeGenerator::writeFeedMode(GCodeSink& sink, Toolpath::FeedMode feedMode) {
+    const bool perRevolution = feedMode == Toolpath::FeedMode::PerRevolution;
+    writeLineNumber(sink);
+    sink.write(perRevolution ? "G95" : "G94");
+    writeComment(sink, perRevolution ? "Feed per revolution" : "Feed per minute");
+    sink.put('\n');
+}
+
+void GCodeGenerator::writeSpindleAndFeedReset(GCodeSink& sink) {
+    writeLineNumber(sink);
+    sink.write("G94 G97");
+    writeComment(sink, "Feed per minute, constant spindle speed");
+    sink.put('\n');
+}
+
+void GCodeGenerator::writeCoolantControl(GCodeSink& sink, bool on) {
+    writeLineNumber(sink);
+    sink.write(on ? "M8" : "M9");
+    writeComment(sink, on ? "Coolant on" : "Coolant off");
+    sink.put('\n');
 }
 
 bool GCodeGenerator::validateToolpath(const Toolpath::Toolpath& toolpath) const {
@@ -206,33 +405,38 @@ std::vector<std::string> GCodeGenerator::checkMachineLimits(const Toolpath::Tool
     return warnings;
 }
 
-std::string GCodeGenerator::formatLineNumber() {
+void GCodeGenerator::writeLineNumber(GCodeSink& sink) {
     if (!options_.includeLineNumbers) {
-        return "";
+        return;
     }
     
-    std::ostringstream line;
-    line << "N" << currentLineNumber_ << " ";
+    sink.put('N');
+    sink.writeInt(currentLineNumber_);
+    sink.put(' ');
     currentLineNumber_ += options_.lineNumberIncrement;
-    return line.str();
 }
 
-std::string GCodeGenerator::formatCoordinate(double value, char axis) const {
-    std::ostringstream coord;
-    coord << " " << axis << std::fixed << std::setprecision(3) << value;
-    return coord.str();
+void GCodeGenerator::writeComment(GCodeSink& sink, std::string_view comment) const {
+    if (options_.includeComments) {
+        sink.write(" ; ");
+        sink.write(comment);
+    }
+}
+
+void GCodeGenerator::writeCoordinate(GCodeSink& sink, double value, char axis) const {
+    sink.put(' ');
+    sink.put(axis);
+    sink.writeFixed(value, 3);
 }
 
-std::string GCodeGenerator::formatFeedRate(double feedRate) const {
-    std::ostringstream feed;
-    feed << " F" << std::fixed << std::setprecision(1) << feedRate;
-    return feed.str();
+void GCodeGenerator::writeFeedRate(GCodeSink& sink, double feedRate, Toolpath::FeedMode feedMode) const {
+    sink.write(" F");
+    sink.writeFixed(feedRate, feedMode == Toolpath::FeedMode::PerRevolution ? 3 : 1);
 }
 
-std::string GCodeGenerator::formatSpindleSpeed(double rpm) const {
-    std::ostringstream speed;
-    speed << " S" << std::fixed << std::setprecision(0) << rpm;
-    return speed.str();
+void GCodeGenerator::writeSpindleSpeed(GCodeSink& sink, double rpm) const {
+    sink.write(" S");
+    sink.writeFixed(rpm, 0);
 }
 
 // PostProcessor implementation
@@ -248,11 +452,28 @@ PostProcessor::ProcessingResult PostProcessor::process(const std::vector<std::sh
         result.success = true;
         
         // Estimate time
-        for (const auto& toolpath : toolpaths) {
-            if (toolpath) {
-                result.estimatedTime += toolpath->estimateMachiningTime();
-            }
+        result.estimatedTime = CycleTimeEstimator(generator_->getMachineConfig()).estimate(toolpaths).total();
+    } catch (const std::exception& e) {
+        result.success = false;
+        result.errors.push_back(e.what());
+    }
+    
+    return result;
+}
+
+PostProcessor::ProcessingResult PostProcessor::process(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths,
+                                                       GCodeSink& sink) {
+    ProcessingResult result;
+    
+    try {
+        generator_->writeGCode(toolpaths, sink);
+        result.success = sink.good();
+        if (!result.success) {
+            result.errors.push_back("Failed to write G-code output");
         }
+        
+        // Estimate time
+        result.estimatedTime = CycleTimeEstimator(generator_->getMachineConfig()).estimate(toolpaths).total();
     } catch (const std::exception& e) {
         result.success = false;
         result.errors.push_back(e.what());
@@ -261,13 +482,24 @@ PostProcessor::ProcessingResult PostProcessor::process(const std::vector<std::sh
     return result;
 }
 
+PostProcessor::ProcessingResult PostProcessor::processToFile(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths,
+                                                             const std::string& outputPath) {
+    FileSink sink(outputPath);
+    if (!sink.isOpen()) {
+        ProcessingResult result;
+        result.errors.push_back("Cannot open output file: " + outputPath);
+        return result;
+    }
+    return process(toolpaths, sink);
+}
+
 PostProcessor::ProcessingResult PostProcessor::process(const Toolpath::Toolpath& toolpath) {
     ProcessingResult result;
     
     try {
         result.gcode = generator_->generateGCode(toolpath);
         result.success = true;
-        result.estimatedTime = toolpath.estimateMachiningTime();
+        result.estimatedTime = CycleTimeEstimator(generator_->getMachineConfig()).estimate(toolpath).total();
         
         // Check machine limits
         auto warnings = generator_->checkMachineLimits(toolpath);
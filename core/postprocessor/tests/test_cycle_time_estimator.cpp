@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/PostProcessor/CycleTimeEstimator.h>
+
+#define _USE_MATH_DEFINES
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+using namespace IntuiCAM;
+using Geometry::Point3D;
+using PostProcessor::CycleTimeEstimator;
+
+namespace {
+
+// Default machine: a = 2000 mm/s^2 on both axes, j = 50000 mm/s^3, 500 blocks/s
+PostProcessor::GCodeGenerator::MachineConfig machine() {
+    return PostProcessor::GCodeGenerator::MachineConfig{};
+}
+
+// Jerk-limited ramp from rest to @p speed, as a controller runs it
+double sCurveRampTime(double speed, double acceleration, double jerk) {
+    if (speed >= acceleration * acceleration / jerk) {
+        return speed / acceleration + acceleration / jerk;
+    }
+    return 2.0 * std::sqrt(speed / jerk);
+}
+
+// Two feed moves of 50 mm each; the second turns by @p turnDegrees
+double twoBlockCuttingSeconds(double turnDegrees) {
+    const double angle = turnDegrees * M_PI / 180.0;
+    Toolpath::Toolpath toolpath("corner", nullptr);
+    toolpath.addRapidMove(Point3D(0.0, 0.0, 10.0));
+    toolpath.addLinearMove(Point3D(50.0, 0.0, 10.0), 1200.0);
+    toolpath.addLinearMove(Point3D(50.0 + 50.0 * std::cos(angle), 0.0, 10.0 + 50.0 * std::sin(angle)), 1200.0);
+    return CycleTimeEstimator(machine()).estimate(toolpath).cutting * 60.0;
+}
+
+} // namespace
+
+TEST(CycleTimeEstimatorTest, LongBlockIsLengthOverFeedPlusRamp) {
+    const auto config = machine();
+    const double length = 500.0;
+    const double feed = 1000.0;
+    const double speed = feed / 60.0;
+
+    // No tool, so no tool change; the rapid brings the axes to rest first
+    Toolpath::Toolpath toolpath("long block", nullptr);
+    toolpath.addRapidMove(Point3D(0.0, 0.0, 20.0));
+    toolpath.addLinearMove(Point3D(length, 0.0, 20.0), feed);
+    const CycleTimeEstimator::Breakdown result = CycleTimeEstimator(config).estimate(toolpath);
+
+    // A symmetric ramp averages half the cruise speed, so each end costs half
+    // its duration over pure cruising: length / speed + one full ramp
+    const double expected = length / speed + sCurveRampTime(speed, config.maxAccelerationX, config.maxJerk);
+    EXPECT_NEAR(result.cutting * 60.0, expected, 1e-6);
+    EXPECT_DOUBLE_EQ(result.toolChange, 0.0);
+    EXPECT_EQ(result.blocks, 2u);
+}
+
+TEST(CycleTimeEstimatorTest, CornerIsSlowerThanStraightLine) {
+    const double straight = twoBlockCuttingSeconds(0.0);
+    const double corner = twoBlockCuttingSeconds(90.0);
+
+    // Straight through, the junction keeps full speed: one 100 mm block's time
+    const auto config = machine();
+    const double speed = 1200.0 / 60.0;
+    EXPECT_NEAR(straight, 100.0 / speed + sCurveRampTime(speed, config.maxAccelerationX, config.maxJerk), 1e-6);
+
+    // The 90 degree corner within 0.01 mm deviation needs nearly a full stop
+    EXPECT_GT(corner, straight + 0.5 * sCurveRampTime(speed, config.maxAccelerationX, config.maxJerk));
+    EXPECT_LT(corner, straight + 2.0 * sCurveRampTime(speed, config.maxAccelerationX, config.maxJerk));
+}
+
+TEST(CycleTimeEstimatorTest, TinyBlocksAreClampedByBlockProcessingRate) {
+    const auto config = machine();
+    const size_t count = 1000;
+    const double step = 0.01;
+
+    // 10 mm in 0.01 mm blocks at 6000 mm/min: the feed alone would take 0.1 s
+    Toolpath::Toolpath toolpath("tiny blocks", nullptr);
+    toolpath.addRapidMove(Point3D(0.0, 0.0, 10.0));
+    for (size_t i = 1; i <= count; ++i) {
+        toolpath.addLinearMove(Point3D(step * static_cast<double>(i), 0.0, 10.0), 6000.0);
+    }
+    const double seconds = CycleTimeEstimator(config).estimate(toolpath).cutting * 60.0;
+
+    // Every block costs at least one processing period; ramping only adds a
+    // few periods at the ends
+    const double floor = static_cast<double>(count) / config.blockProcessingRate;
+    EXPECT_GE(seconds, floor);
+    EXPECT_LT(seconds, floor * 1.02);
+    EXPECT_GT(seconds, 10.0 * (10.0 / (6000.0 / 60.0)));
+}
+
+TEST(CycleTimeEstimatorTest, ConstantSurfaceSpeedFacingMatchesIntegral) {
+    const auto config = machine();
+    const double feedPerRev = 0.2;      // mm/rev
+    const double surfaceSpeed = 150.0;  // m/min
+    const double outerRadius = 40.0;
+    const double innerRadius = 10.0;    // 2387 RPM here, under the 3000 RPM clamp
+
+    Toolpath::Toolpath toolpath("facing", nullptr);
+    toolpath.addRapidMove(Point3D(0.0, 0.0, outerRadius));
+    toolpath.addLinearMove(Point3D(0.0, 0.0, innerRadius), feedPerRev);
+    toolpath.setCuttingConditions(1, feedPerRev, Toolpath::FeedMode::PerRevolution,
+                                  config.maxSpindleSpeed, surfaceSpeed);
+    const double seconds = CycleTimeEstimator(config).estimate(toolpath).cutting * 60.0;
+
+    // dt = 60 dr / (f n(r)) with n(r) = 1000 vc / (2 pi r), integrated over the pass
+    const double analytic = 60.0 * M_PI * (outerRadius * outerRadius - innerRadius * innerRadius) /
+                            (1000.0 * feedPerRev * surfaceSpeed);
+    EXPECT_NEAR(seconds, analytic, analytic * 0.005);
+
+    // Using the speed at the start radius alone would overestimate it
+    const double startRpm = 1000.0 * surfaceSpeed / (2.0 * M_PI * outerRadius);
+    EXPECT_LT(seconds, 60.0 * (outerRadius - innerRadius) / (feedPerRev * startRpm));
+}
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/PostProcessor/GCodeSink.h>
+#include <IntuiCAM/PostProcessor/Types.h>
+
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#define INTUICAM_FILENO _fileno
+#else
+#include <stdio.h>
+#define INTUICAM_FILENO fileno
+#endif
+
+using namespace IntuiCAM;
+using Geometry::Point3D;
+
+namespace {
+
+// Long enough that every sink drains its buffer several times
+std::vector<std::shared_ptr<Toolpath::Toolpath>> makeProgram() {
+    auto tool = std::make_shared<Toolpath::Tool>(Toolpath::Tool::Type::Turning, "T1");
+    auto toolpath = std::make_shared<Toolpath::Toolpath>("sink test", tool);
+    toolpath->addRapidMove(Point3D(52.0, 0.0, 12.0));
+    for (int i = 0; i < 3000; ++i) {
+        const double radius = 10.0 - 0.001 * i;
+        toolpath->addLinearMove(Point3D(50.0 - 0.01 * i, 0.0, radius), 120.0 + (i % 7));
+        if (i % 500 == 0) {
+            toolpath->addCircularMove(Point3D(45.0 - 0.01 * i, 0.0, radius - 5.0),
+                                      Point3D(45.0 - 0.01 * i, 0.0, radius), true, 80.0);
+            toolpath->addDwell(0.25);
+        }
+    }
+    toolpath->addRapidMove(Point3D(-0.0001, 0.0, 15.0));
+    return {toolpath};
+}
+
+std::string streamFixed(double value, int decimals) {
+    std::ostringstream stream;
+    stream.imbue(std::locale::classic());
+    stream << std::fixed << std::setprecision(decimals) << value;
+    return stream.str();
+}
+
+std::string sinkFixed(double value, int decimals) {
+    std::string text;
+    {
+        PostProcessor::StringSink sink(text);
+        sink.writeFixed(value, decimals);
+    }
+    return text;
+}
+
+std::string readAll(std::FILE* file) {
+    std::string text;
+    std::rewind(file);
+    char buffer[4096];
+    size_t count = 0;
+    while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, count);
+    }
+    return text;
+}
+
+} // namespace
+
+TEST(GCodeSinkTest, EverySinkMatchesGenerateGCode) {
+    const auto program = makeProgram();
+    const std::string expected = PostProcessor::GCodeGenerator().generateGCode(program);
+    ASSERT_GT(expected.size(), 64u * 1024u);
+
+    // String sink
+    std::string viaString;
+    {
+        PostProcessor::StringSink sink(viaString);
+        PostProcessor::GCodeGenerator().writeGCode(program, sink);
+        EXPECT_TRUE(sink.good());
+        EXPECT_EQ(sink.bytesWritten(), expected.size());
+    }
+    EXPECT_EQ(viaString, expected);
+
+    // Caller buffer with room to spare
+    std::vector<char> buffer(expected.size() + 16);
+    PostProcessor::BufferSink bufferSink(buffer.data(), buffer.size());
+    PostProcessor::GCodeGenerator().writeGCode(program, bufferSink);
+    EXPECT_TRUE(bufferSink.good());
+    EXPECT_EQ(bufferSink.view(), expected);
+
+    // File descriptor
+    std::FILE* descriptorFile = std::tmpfile();
+    ASSERT_NE(descriptorFile, nullptr);
+    {
+        PostProcessor::FileDescriptorSink sink(INTUICAM_FILENO(descriptorFile));
+        PostProcessor::GCodeGenerator().writeGCode(program, sink);
+        EXPECT_TRUE(sink.good());
+        EXPECT_EQ(sink.bytesWritten(), expected.size());
+    }
+    EXPECT_EQ(readAll(descriptorFile), expected);
+    std::fclose(descriptorFile);
+
+    // Named file
+    const std::string path = ::testing::TempDir() + "intuicam_sink_test.nc";
+    {
+        PostProcessor::FileSink sink(path);
+        ASSERT_TRUE(sink.isOpen());
+        PostProcessor::GCodeGenerator().writeGCode(program, sink);
+        EXPECT_TRUE(sink.good());
+    }
+    std::FILE* written = std::fopen(path.c_str(), "rb");
+    ASSERT_NE(written, nullptr);
+    EXPECT_EQ(readAll(written), expected);
+    std::fclose(written);
+    std::remove(path.c_str());
+}
+
+TEST(GCodeSinkTest, WriteFixedMatchesClassicStreamFormatting) {
+    const std::vector<double> values = {
+        0.0, -0.0, -0.0004, 0.0004, -0.0005, 0.0005, 0.5, 1.5, 2.5, -2.5,
+        0.125, 1.0005, 123.4565, -98.7654321, 1e6, -1e6, 1e15, 3000.0, 0.035};
+    for (double value : values) {
+        for (int decimals = 0; decimals <= 6; ++decimals) {
+            EXPECT_EQ(sinkFixed(value, decimals), streamFixed(value, decimals))
+                << "value " << value << " with " << decimals << " decimals";
+        }
+    }
+
+    // Spot checks of the edge values
+    EXPECT_EQ(sinkFixed(-0.0004, 3), "-0.000");
+    EXPECT_EQ(sinkFixed(1e6, 3), "1000000.000");
+    EXPECT_EQ(sinkFixed(2.5, 0), "2");
+    EXPECT_EQ(sinkFixed(12.75, 0), "13");
+
+    // Precision is clamped to 0-6 digits
+    EXPECT_EQ(sinkFixed(1.0 / 3.0, 9), "0.333333");
+    EXPECT_EQ(sinkFixed(1.25, -1), "1");
+}
+
+TEST(GCodeSinkTest, WriteIntPadsAndHandlesSign) {
+    std::string text;
+    {
+        PostProcessor::StringSink sink(text);
+        sink.writeInt(7, 2);
+        sink.put(' ');
+        sink.writeInt(-42, 4);
+        sink.put(' ');
+        sink.writeInt(123456, 2);
+    }
+    EXPECT_EQ(text, "07 -0042 123456");
+}
+
+TEST(GCodeSinkTest, BufferOverflowFailsAndStops) {
+    char buffer[8];
+    PostProcessor::BufferSink sink(buffer, sizeof(buffer));
+    sink.write("G1 X10.000");
+    EXPECT_FALSE(sink.good());
+    EXPECT_EQ(sink.view(), "G1 X10.0");
+    EXPECT_FALSE(sink.flush());
+
+    // Failure is sticky
+    sink.put('Z');
+    EXPECT_EQ(sink.size(), 8u);
+    EXPECT_FALSE(sink.good());
+}
+
+TEST(GCodeSinkTest, ReportsFailedWrites) {
+    // Writes to a descriptor that is not open fail on the first drain
+    {
+        PostProcessor::FileDescriptorSink sink(-1);
+        sink.write("N10 G0 X0.000 Z0.000\n");
+        EXPECT_TRUE(sink.good());      // Still buffered
+        EXPECT_FALSE(sink.flush());
+        EXPECT_FALSE(sink.good());
+    }
+
+    PostProcessor::FileSink missing(::testing::TempDir() + "no/such/dir/out.nc");
+    EXPECT_FALSE(missing.isOpen());
+    missing.write("M30\n");
+    EXPECT_FALSE(missing.flush());
+}
+
+TEST(GCodeSinkTest, ToolChangeCancelsConstantSurfaceSpeed) {
+    // The first toolpath ends in G96/G95; the next tool's M3 S word must be RPM
+    auto tool = std::make_shared<Toolpath::Tool>(Toolpath::Tool::Type::Turning, "T1");
+    auto facing = std::make_shared<Toolpath::Toolpath>("facing", tool);
+    facing->addRapidMove(Point3D(0.0, 0.0, 30.0));
+    facing->addLinearMove(Point3D(0.0, 0.0, 0.0), 0.2);
+    facing->setCuttingConditions(1, 0.2, Toolpath::FeedMode::PerRevolution, 2000.0, 180.0);
+    auto turning = std::make_shared<Toolpath::Toolpath>("turning", tool);
+    turning->addRapidMove(Point3D(5.0, 0.0, 20.0));
+    turning->addLinearMove(Point3D(-20.0, 0.0, 20.0), 150.0);
+
+    const std::string program = PostProcessor::GCodeGenerator().generateGCode({facing, turning});
+
+    // The header establishes the modes the tracker starts from
+    const size_t header = program.find("G94 G97");
+    ASSERT_NE(header, std::string::npos);
+    EXPECT_LT(header, program.find("T01"));
+
+    const size_t css = program.find("G96");
+    ASSERT_NE(css, std::string::npos);
+    const size_t secondToolChange = program.find("T01", css);
+    ASSERT_NE(secondToolChange, std::string::npos);
+    const size_t reset = program.find("G94 G97", secondToolChange);
+    ASSERT_NE(reset, std::string::npos);
+    EXPECT_LT(reset, program.find("M3", secondToolChange));
+}
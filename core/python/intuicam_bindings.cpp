@@ -1,6 +1,17 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/operators.h>
+#include <pybind11/numpy.h>
+
+#include <array>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <gp_Ax1.hxx>
+#include <gp_Dir.hxx>
+#include <gp_Pnt.hxx>
 
 // Include all module headers
 #include <IntuiCAM/Common/Types.h>
@@ -9,11 +20,109 @@
 #include <IntuiCAM/Geometry/StepLoader.h>
 #include <IntuiCAM/Toolpath/Types.h>
 #include <IntuiCAM/Toolpath/Operations.h>
+#include <IntuiCAM/Toolpath/LatheProfile.h>
+#include <IntuiCAM/Toolpath/ToolpathGenerationPipeline.h>
 #include <IntuiCAM/PostProcessor/Types.h>
 #include <IntuiCAM/Simulation/Types.h>
 
 namespace py = pybind11;
 
+namespace {
+
+// Borrows per toolpath: live NumPy views and native calls running without the
+// GIL. As with bytearray, a borrowed toolpath refuses to grow: appending may
+// reallocate the columns under a view or a call reading them. The count is
+// only touched with the GIL held.
+std::unordered_map<const IntuiCAM::Toolpath::Toolpath*, size_t>& borrowedToolpaths() {
+    static std::unordered_map<const IntuiCAM::Toolpath::Toolpath*, size_t> borrows;
+    return borrows;
+}
+
+void checkNotBorrowed(const IntuiCAM::Toolpath::Toolpath& toolpath) {
+    auto it = borrowedToolpaths().find(&toolpath);
+    if (it != borrowedToolpaths().end() && it->second > 0) {
+        throw py::buffer_error("Existing exports of data or running calls: toolpath cannot be modified");
+    }
+}
+
+void releaseBorrow(const IntuiCAM::Toolpath::Toolpath* toolpath) {
+    auto it = borrowedToolpaths().find(toolpath);
+    if (it != borrowedToolpaths().end() && --it->second == 0) {
+        borrowedToolpaths().erase(it);
+    }
+}
+
+// Holds a toolpath borrowed across a GIL release. Construct it before the
+// gil_scoped_release so it is destroyed after the GIL is taken back.
+class ToolpathBorrow {
+public:
+    explicit ToolpathBorrow(const IntuiCAM::Toolpath::Toolpath& toolpath) : toolpath_(&toolpath) {
+        ++borrowedToolpaths()[toolpath_];
+    }
+    ~ToolpathBorrow() { releaseBorrow(toolpath_); }
+
+    ToolpathBorrow(const ToolpathBorrow&) = delete;
+    ToolpathBorrow& operator=(const ToolpathBorrow&) = delete;
+
+private:
+    const IntuiCAM::Toolpath::Toolpath* toolpath_;
+};
+
+// Buffer exporter behind a column view: keeps the Python owner alive and the
+// toolpath borrowed until the last array sharing it is released. Python
+// deallocates it with the GIL held.
+struct ColumnExport {
+    ColumnExport(const IntuiCAM::Toolpath::Toolpath& toolpath, py::object owner, const void* data,
+                 py::ssize_t itemSize, std::string format, py::ssize_t size)
+        : toolpath(&toolpath), owner(std::move(owner)), data(data), itemSize(itemSize),
+          format(std::move(format)), size(size) {
+        ++borrowedToolpaths()[this->toolpath];
+    }
+    ~ColumnExport() { releaseBorrow(toolpath); }
+
+    ColumnExport(const ColumnExport&) = delete;
+    ColumnExport& operator=(const ColumnExport&) = delete;
+
+    py::buffer_info bufferInfo() const {
+        return py::buffer_info(const_cast<void*>(data), itemSize, format, 1, {size}, {itemSize},
+                               /*readonly=*/true);
+    }
+
+    const IntuiCAM::Toolpath::Toolpath* toolpath;
+    py::object owner;
+    const void* data;
+    py::ssize_t itemSize;
+    std::string format;
+    py::ssize_t size;
+};
+
+// Read-only NumPy view of a toolpath column. The array borrows the vector's
+// storage through a ColumnExport; owner must be the Python object wrapping
+// that toolpath.
+template <typename T, typename Column>
+py::array columnView(py::handle owner,
+                     const std::vector<Column>& (IntuiCAM::Toolpath::Toolpath::*getColumn)() const) {
+    static_assert(sizeof(T) == sizeof(Column) && std::is_trivially_copyable<Column>::value,
+                  "column must be reinterpretable as T");
+    const auto& toolpath = owner.cast<const IntuiCAM::Toolpath::Toolpath&>();
+    const std::vector<Column>& column = (toolpath.*getColumn)();
+
+    py::object exporter = py::cast(new ColumnExport(toolpath, py::reinterpret_borrow<py::object>(owner),
+                                                    column.data(), static_cast<py::ssize_t>(sizeof(T)),
+                                                    py::format_descriptor<T>::format(),
+                                                    static_cast<py::ssize_t>(column.size())),
+                                   py::return_value_policy::take_ownership);
+    // NumPy takes the buffer, read-only flag included, and keeps the exporter as its base
+    return py::array(exporter);
+}
+
+gp_Ax1 makeAxis(const std::array<double, 3>& origin, const std::array<double, 3>& direction) {
+    return gp_Ax1(gp_Pnt(origin[0], origin[1], origin[2]),
+                  gp_Dir(direction[0], direction[1], direction[2]));
+}
+
+} // namespace
+
 // Forward declarations for module binding functions
 void bind_common(py::module& m);
 void bind_geometry(py::module& m);
@@ -43,9 +152,10 @@ PYBIND11_MODULE(intuicam_py, m) {
     bind_simulation(simulation_module);
     
     // Convenience functions at top level
+    // Long-running calls release the GIL so other Python threads keep running
     m.def("load_step_file", &IntuiCAM::Geometry::StepLoader::importStepFile,
           "Load a STEP file and return the imported parts",
-          py::arg("file_path"));
+          py::arg("file_path"), py::call_guard<py::gil_scoped_release>());
     
     m.def("create_facing_operation", [](const std::string& name) {
         auto tool = std::make_shared<IntuiCAM::Toolpath::Tool>(
@@ -143,13 +253,29 @@ void bind_geometry(py::module& m) {
         .def("size", &BoundingBox::size)
         .def("center", &BoundingBox::center);
     
+    // Parts
+    py::class_<Part>(m, "Part")
+        .def("get_bounding_box", &Part::getBoundingBox)
+        .def("get_volume", &Part::getVolume)
+        .def("get_surface_area", &Part::getSurfaceArea);
+    
+    py::class_<OCCTPart, Part>(m, "OCCTPart");
+    
     // StepLoader
     py::class_<StepLoader::ImportResult>(m, "ImportResult")
         .def_readonly("success", &StepLoader::ImportResult::success)
-        .def_readonly("error_message", &StepLoader::ImportResult::errorMessage);
+        .def_readonly("error_message", &StepLoader::ImportResult::errorMessage)
+        .def_property_readonly("parts", [](py::object self) {
+            py::list parts;
+            for (const auto& part : self.cast<const StepLoader::ImportResult&>().parts) {
+                parts.append(py::cast(part.get(), py::return_value_policy::reference_internal, self));
+            }
+            return parts;
+        });
     
     py::class_<StepLoader>(m, "StepLoader")
-        .def_static("import_step_file", &StepLoader::importStepFile)
+        .def_static("import_step_file", &StepLoader::importStepFile,
+                    py::call_guard<py::gil_scoped_release>())
         .def_static("validate_step_file", &StepLoader::validateStepFile)
         .def_static("get_supported_formats", &StepLoader::getSupportedFormats);
 }
@@ -175,6 +301,11 @@ void bind_toolpath(py::module& m) {
         .value("Dwell", MovementType::Dwell)
         .value("ToolChange", MovementType::ToolChange);
     
+    // FeedMode enum
+    py::enum_<FeedMode>(m, "FeedMode")
+        .value("PerMinute", FeedMode::PerMinute)
+        .value("PerRevolution", FeedMode::PerRevolution);
+    
     // Tool class
     py::class_<Tool, std::shared_ptr<Tool>>(m, "Tool")
         .def(py::init<Tool::Type, const std::string&>())
@@ -186,20 +317,151 @@ void bind_toolpath(py::module& m) {
         .def(py::init<MovementType, const IntuiCAM::Geometry::Point3D&>())
         .def_readwrite("type", &Movement::type)
         .def_readwrite("position", &Movement::position)
+        .def_readwrite("center", &Movement::center)
         .def_readwrite("feed_rate", &Movement::feedRate)
         .def_readwrite("spindle_speed", &Movement::spindleSpeed)
+        .def_readwrite("surface_speed", &Movement::surfaceSpeed)
+        .def_readwrite("feed_mode", &Movement::feedMode)
         .def_readwrite("comment", &Movement::comment);
     
-    // Toolpath class
+    py::class_<ColumnExport>(m, "_ColumnExport", py::buffer_protocol())
+        .def_buffer(&ColumnExport::bufferInfo);
+    
+    // Toolpath class. The array properties are zero-copy, read-only NumPy views
+    // of the movement columns; get_movements() copies into Movement objects.
+    // While any view or GIL-free call holds it the add_* methods raise BufferError.
     py::class_<Toolpath>(m, "Toolpath")
         .def(py::init<const std::string&, std::shared_ptr<Tool>>())
-        .def("add_movement", &Toolpath::addMovement)
-        .def("add_rapid_move", &Toolpath::addRapidMove)
-        .def("add_linear_move", &Toolpath::addLinearMove)
-        .def("get_movements", &Toolpath::getMovements, py::return_value_policy::reference)
+        .def("add_movement", [](Toolpath& toolpath, const Movement& movement) {
+            checkNotBorrowed(toolpath);
+            toolpath.addMovement(movement);
+        })
+        .def("add_rapid_move", [](Toolpath& toolpath, const IntuiCAM::Geometry::Point3D& position) {
+            checkNotBorrowed(toolpath);
+            toolpath.addRapidMove(position);
+        })
+        .def("add_linear_move", [](Toolpath& toolpath, const IntuiCAM::Geometry::Point3D& position, double feedRate) {
+            checkNotBorrowed(toolpath);
+            toolpath.addLinearMove(position, feedRate);
+        })
+        .def("get_movements", [](const Toolpath& tp) { return tp.getMovements().toVector(); })
         .def("get_name", &Toolpath::getName)
         .def("get_movement_count", &Toolpath::getMovementCount)
-        .def("estimate_machining_time", &Toolpath::estimateMachiningTime);
+        .def("__len__", &Toolpath::getMovementCount)
+        .def("estimate_machining_time", &Toolpath::estimateMachiningTime)
+        .def_property_readonly("x", [](py::object self) {
+            return columnView<double>(self, &Toolpath::getPositionsX);
+        })
+        .def_property_readonly("y", [](py::object self) {
+            return columnView<double>(self, &Toolpath::getPositionsY);
+        })
+        .def_property_readonly("z", [](py::object self) {
+            return columnView<double>(self, &Toolpath::getPositionsZ);
+        })
+        .def_property_readonly("feed_rates", [](py::object self) {
+            return columnView<double>(self, &Toolpath::getFeedRates);
+        })
+        .def_property_readonly("spindle_speeds", [](py::object self) {
+            return columnView<double>(self, &Toolpath::getSpindleSpeeds);
+        })
+        .def_property_readonly("surface_speeds", [](py::object self) {
+            return columnView<double>(self, &Toolpath::getSurfaceSpeeds);
+        })
+        // int32 values of FeedMode
+        .def_property_readonly("feed_modes", [](py::object self) {
+            return columnView<std::int32_t>(self, &Toolpath::getFeedModes);
+        })
+        // int32 values of MovementType
+        .def_property_readonly("move_types", [](py::object self) {
+            return columnView<std::int32_t>(self, &Toolpath::getMovementTypes);
+        })
+        .def_property_readonly("pass_numbers", [](py::object self) {
+            return columnView<std::int32_t>(self, &Toolpath::getPassNumbers);
+        });
+    
+    // Lathe profile extraction
+    py::class_<LatheProfile::Profile2D>(m, "Profile2D")
+        .def("is_empty", &LatheProfile::Profile2D::isEmpty)
+        .def("get_segment_count", &LatheProfile::Profile2D::getSegmentCount)
+        .def("get_total_length", &LatheProfile::Profile2D::getTotalLength)
+        .def("__len__", &LatheProfile::Profile2D::size)
+        .def("get_bounds", [](const LatheProfile::Profile2D& profile) {
+            double minZ = 0.0, maxZ = 0.0, minRadius = 0.0, maxRadius = 0.0;
+            profile.getBounds(minZ, maxZ, minRadius, maxRadius);
+            return py::make_tuple(minZ, maxZ, minRadius, maxRadius);
+        }, "Return (min_z, max_z, min_radius, max_radius)");
+    
+    m.def("extract_segment_profile", [](const IntuiCAM::Geometry::OCCTPart& part,
+                                        const std::array<double, 3>& axisOrigin,
+                                        const std::array<double, 3>& axisDirection,
+                                        double tolerance) {
+        const gp_Ax1 axis = makeAxis(axisOrigin, axisDirection);
+        py::gil_scoped_release release;
+        return LatheProfile::extractSegmentProfile(part.getOCCTShape(), axis, tolerance);
+    }, "Section a part into its lathe half-profile",
+       py::arg("part"), py::arg("axis_origin") = std::array<double, 3>{0.0, 0.0, 0.0},
+       py::arg("axis_direction") = std::array<double, 3>{0.0, 0.0, 1.0},
+       py::arg("tolerance") = 0.01);
+    
+    // Toolpath generation pipeline
+    using Pipeline = ToolpathGenerationPipeline;
+    py::class_<Pipeline::PipelineInputs>(m, "PipelineInputs")
+        .def(py::init<>())
+        .def_readwrite("profile_2d", &Pipeline::PipelineInputs::profile2D)
+        .def_readwrite("raw_material_diameter", &Pipeline::PipelineInputs::rawMaterialDiameter)
+        .def_readwrite("raw_material_length", &Pipeline::PipelineInputs::rawMaterialLength)
+        .def_readwrite("z0", &Pipeline::PipelineInputs::z0)
+        .def_readwrite("part_length", &Pipeline::PipelineInputs::partLength)
+        .def_readwrite("machine_internal_features", &Pipeline::PipelineInputs::machineInternalFeatures)
+        .def_readwrite("drilling", &Pipeline::PipelineInputs::drilling)
+        .def_readwrite("internal_roughing", &Pipeline::PipelineInputs::internalRoughing)
+        .def_readwrite("external_roughing", &Pipeline::PipelineInputs::externalRoughing)
+        .def_readwrite("internal_finishing", &Pipeline::PipelineInputs::internalFinishing)
+        .def_readwrite("external_finishing", &Pipeline::PipelineInputs::externalFinishing)
+        .def_readwrite("internal_grooving", &Pipeline::PipelineInputs::internalGrooving)
+        .def_readwrite("external_grooving", &Pipeline::PipelineInputs::externalGrooving)
+        .def_readwrite("chamfering", &Pipeline::PipelineInputs::chamfering)
+        .def_readwrite("threading", &Pipeline::PipelineInputs::threading)
+        .def_readwrite("facing", &Pipeline::PipelineInputs::facing)
+        .def_readwrite("parting", &Pipeline::PipelineInputs::parting)
+        .def_readwrite("largest_drill_size", &Pipeline::PipelineInputs::largestDrillSize)
+        .def_readwrite("facing_allowance", &Pipeline::PipelineInputs::facingAllowance)
+        .def_readwrite("internal_finishing_passes", &Pipeline::PipelineInputs::internalFinishingPasses)
+        .def_readwrite("external_finishing_passes", &Pipeline::PipelineInputs::externalFinishingPasses)
+        .def_readwrite("parting_allowance", &Pipeline::PipelineInputs::partingAllowance)
+        .def_readwrite("max_parallel_stages", &Pipeline::PipelineInputs::maxParallelStages);
+    
+    py::class_<Pipeline::PipelineResult>(m, "PipelineResult")
+        .def_readonly("success", &Pipeline::PipelineResult::success)
+        .def_readonly("error_message", &Pipeline::PipelineResult::errorMessage)
+        .def_readonly("warnings", &Pipeline::PipelineResult::warnings)
+        .def_property_readonly("processing_time_ms", [](const Pipeline::PipelineResult& result) {
+            return static_cast<double>(result.processingTime.count());
+        })
+        // Toolpaths are owned by the result and stay valid while it is alive
+        .def_property_readonly("timeline", [](py::object self) {
+            py::list timeline;
+            for (const auto& toolpath : self.cast<const Pipeline::PipelineResult&>().timeline) {
+                timeline.append(py::cast(toolpath.get(), py::return_value_policy::reference_internal, self));
+            }
+            return timeline;
+        });
+    
+    py::class_<Pipeline>(m, "ToolpathGenerationPipeline")
+        .def(py::init<>())
+        .def("extract_inputs_from_part", [](Pipeline& pipeline,
+                                            const IntuiCAM::Geometry::OCCTPart& part,
+                                            const std::array<double, 3>& axisOrigin,
+                                            const std::array<double, 3>& axisDirection) {
+            const gp_Ax1 axis = makeAxis(axisOrigin, axisDirection);
+            py::gil_scoped_release release;
+            return pipeline.extractInputsFromPart(part.getOCCTShape(), axis);
+        }, py::arg("part"), py::arg("axis_origin") = std::array<double, 3>{0.0, 0.0, 0.0},
+           py::arg("axis_direction") = std::array<double, 3>{0.0, 0.0, 1.0})
+        .def("execute_pipeline", py::overload_cast<const Pipeline::PipelineInputs&>(&Pipeline::executePipeline),
+             py::arg("inputs"), py::call_guard<py::gil_scoped_release>())
+        .def("cancel_generation", &Pipeline::cancelGeneration)
+        .def("is_generating", &Pipeline::isGenerating);
 }
 
 // PostProcessor module bindings
@@ -215,10 +477,32 @@ void bind_postprocessor(py::module& m) {
         .value("Okuma", PostProcessor::MachineType::Okuma)
         .value("Siemens", PostProcessor::MachineType::Siemens);
     
+    // G-code generation
+    py::class_<GCodeGenerator>(m, "GCodeGenerator")
+        .def(py::init<>())
+        .def("generate_gcode", [](GCodeGenerator& generator, const IntuiCAM::Toolpath::Toolpath& toolpath) {
+            ToolpathBorrow borrow(toolpath);
+            py::gil_scoped_release release;
+            return generator.generateGCode(toolpath);
+        }, py::arg("toolpath"))
+        .def("validate_toolpath", &GCodeGenerator::validateToolpath)
+        .def("check_machine_limits", &GCodeGenerator::checkMachineLimits);
+    
+    py::class_<PostProcessor::ProcessingResult>(m, "ProcessingResult")
+        .def_readonly("gcode", &PostProcessor::ProcessingResult::gcode)
+        .def_readonly("success", &PostProcessor::ProcessingResult::success)
+        .def_readonly("warnings", &PostProcessor::ProcessingResult::warnings)
+        .def_readonly("errors", &PostProcessor::ProcessingResult::errors)
+        .def_readonly("estimated_time", &PostProcessor::ProcessingResult::estimatedTime);
+    
     // PostProcessor class
     py::class_<PostProcessor>(m, "PostProcessor")
         .def(py::init<PostProcessor::MachineType>())
-        .def("process", py::overload_cast<const IntuiCAM::Toolpath::Toolpath&>(&PostProcessor::process))
+        .def("process", [](PostProcessor& postProcessor, const IntuiCAM::Toolpath::Toolpath& toolpath) {
+            ToolpathBorrow borrow(toolpath);
+            py::gil_scoped_release release;
+            return postProcessor.process(toolpath);
+        })
         .def_static("create_for_machine", &PostProcessor::createForMachine)
         .def_static("get_supported_machines", &PostProcessor::getSupportedMachines)
         .def_static("get_machine_name", &PostProcessor::getMachineName);
@@ -231,7 +515,11 @@ void bind_simulation(py::module& m) {
     // MaterialSimulator class
     py::class_<MaterialSimulator>(m, "MaterialSimulator")
         .def(py::init<>())
-        .def("simulate", py::overload_cast<const IntuiCAM::Toolpath::Toolpath&>(&MaterialSimulator::simulate))
+        .def("simulate", [](MaterialSimulator& simulator, const IntuiCAM::Toolpath::Toolpath& toolpath) {
+            ToolpathBorrow borrow(toolpath);
+            py::gil_scoped_release release;
+            return simulator.simulate(toolpath);
+        })
         .def("calculate_machining_time", &MaterialSimulator::calculateMachiningTime);
     
     // CollisionDetector::CollisionType enum
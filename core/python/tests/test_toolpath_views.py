@@ -0,0 +1,81 @@
+"""Toolpath column views must not outlive the storage they borrow."""
+
+import gc
+import unittest
+
+import numpy as np
+
+import intuicam_py
+
+Point3D = intuicam_py.geometry.Point3D
+toolpath_module = intuicam_py.toolpath
+
+
+def make_toolpath(moves=4):
+    tool = toolpath_module.Tool(toolpath_module.ToolType.Turning, "T1")
+    toolpath = toolpath_module.Toolpath("views", tool)
+    for i in range(moves):
+        toolpath.add_linear_move(Point3D(float(i), 0.0, 10.0 - i), 100.0)
+    return toolpath
+
+
+class ToolpathViewTest(unittest.TestCase):
+    def test_views_are_read_only_and_zero_copy(self):
+        toolpath = make_toolpath()
+        x = toolpath.x
+        np.testing.assert_array_equal(x, [0.0, 1.0, 2.0, 3.0])
+        self.assertFalse(x.flags.writeable)
+        with self.assertRaises(ValueError):
+            x[0] = 5.0
+
+    def test_mutators_raise_while_a_view_is_alive(self):
+        toolpath = make_toolpath()
+        x = toolpath.x
+        for mutate in (lambda: toolpath.add_linear_move(Point3D(9.0, 0.0, 1.0), 50.0),
+                       lambda: toolpath.add_rapid_move(Point3D(9.0, 0.0, 20.0)),
+                       lambda: toolpath.add_movement(toolpath.get_movements()[0])):
+            with self.assertRaises(BufferError):
+                mutate()
+        self.assertEqual(len(toolpath), 4)
+        np.testing.assert_array_equal(x, [0.0, 1.0, 2.0, 3.0])
+
+    def test_derived_arrays_keep_the_export(self):
+        toolpath = make_toolpath()
+        tail = toolpath.feed_rates[2:]
+        gc.collect()
+        with self.assertRaises(BufferError):
+            toolpath.add_rapid_move(Point3D(0.0, 0.0, 20.0))
+        self.assertEqual(tail.tolist(), [100.0, 100.0])
+
+    def test_mutators_work_again_once_views_are_released(self):
+        toolpath = make_toolpath()
+        x = toolpath.x
+        z = toolpath.z
+        del x
+        with self.assertRaises(BufferError):
+            toolpath.add_rapid_move(Point3D(0.0, 0.0, 20.0))
+        del z
+        gc.collect()
+
+        # Many appends force the columns to reallocate
+        for i in range(1000):
+            toolpath.add_linear_move(Point3D(float(i), 0.0, 1.0), 80.0)
+        self.assertEqual(len(toolpath), 1004)
+        self.assertEqual(toolpath.x[-1], 999.0)
+
+    def test_copies_do_not_hold_the_export(self):
+        toolpath = make_toolpath()
+        copy = np.array(toolpath.x)
+        gc.collect()
+        toolpath.add_rapid_move(Point3D(4.0, 0.0, 20.0))
+        self.assertEqual(len(toolpath), 5)
+        self.assertEqual(copy.tolist(), [0.0, 1.0, 2.0, 3.0])
+
+    def test_view_keeps_the_toolpath_alive(self):
+        x = make_toolpath().x
+        gc.collect()
+        np.testing.assert_array_equal(x, [0.0, 1.0, 2.0, 3.0])
+
+
+if __name__ == "__main__":
+    unittest.main()
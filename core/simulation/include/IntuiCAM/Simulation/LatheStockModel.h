@@ -0,0 +1,93 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <IntuiCAM/Geometry/Types.h>
+
+namespace IntuiCAM {
+namespace Simulation {
+
+/**
+ * @brief Axisymmetric stock model for turning simulation
+ *
+ * A turned part is fully described by its half-section. The stock is therefore
+ * stored as a heightfield along the turning axis. Each axial slice of width
+ * `resolution` keeps the inner and outer radius of the material left in it.
+ * Compared to a 3D voxel grid, a 100 mm bar at 0.1 mm needs 1000 slices
+ * instead of millions of voxels.
+ *
+ * Coordinates follow the toolpath convention: Point2D::z is the axial position
+ * and Point2D::x is the radius.
+ */
+class LatheStockModel {
+public:
+    /**
+     * @brief Which side of the material a cutter approaches from
+     *
+     * External tools remove everything above the lowest point they reach in a
+     * slice. Internal tools (drills, boring bars) remove everything below the
+     * highest point they reach.
+     */
+    enum class CutSide {
+        External,
+        Internal
+    };
+
+    struct Slice {
+        double innerRadius = 0.0;
+        double outerRadius = 0.0;
+
+        bool isEmpty() const { return outerRadius <= innerRadius; }
+    };
+
+private:
+    double axialMin_ = 0.0;
+    double resolution_ = 0.1;
+    std::vector<double> innerRadii_;
+    std::vector<double> outerRadii_;
+    double initialVolume_ = 0.0;
+
+public:
+    LatheStockModel() = default;
+
+    /**
+     * @brief Reset to a (hollow) cylinder spanning [axialMin, axialMax]
+     * @param resolution Axial slice width in mm
+     */
+    void initializeCylinder(double axialMin, double axialMax, double outerRadius,
+                            double innerRadius = 0.0, double resolution = 0.1);
+
+    bool isInitialized() const { return !outerRadii_.empty(); }
+
+    /**
+     * @brief Sweep a round cutter of @p cutterRadius from @p start to @p end
+     * @param apply When false, only measure what the sweep would remove
+     * @return Volume removed (or that would be removed) in cubic mm
+     */
+    double sweep(const Geometry::Point2D& start, const Geometry::Point2D& end,
+                 double cutterRadius, CutSide side, bool apply = true);
+
+    // Analysis
+    double getVolume() const;
+    double getInitialVolume() const { return initialVolume_; }
+    double getRemovedVolume() const { return initialVolume_ - getVolume(); }
+
+    // Slice access
+    size_t getSliceCount() const { return outerRadii_.size(); }
+    double getResolution() const { return resolution_; }
+    double getAxialMin() const { return axialMin_; }
+    double getAxialMax() const { return axialMin_ + resolution_ * static_cast<double>(outerRadii_.size()); }
+    double getSliceCenter(size_t index) const { return axialMin_ + (static_cast<double>(index) + 0.5) * resolution_; }
+    Slice getSlice(size_t index) const { return Slice{innerRadii_[index], outerRadii_[index]}; }
+
+    /**
+     * @brief Revolve the remaining material into a closed triangle mesh
+     *
+     * The mesh uses the viewer convention: Z is the turning axis, X/Y radial.
+     * Consecutive slices with the same radii are merged into single bands.
+     */
+    std::unique_ptr<Geometry::Mesh> generateMesh(int angularSegments = 64) const;
+};
+
+} // namespace Simulation
+} // namespace IntuiCAM
@@ -4,15 +4,17 @@
 #include <vector>
 #include <IntuiCAM/Geometry/Types.h>
 #include <IntuiCAM/Toolpath/Types.h>
+#include <IntuiCAM/Simulation/LatheStockModel.h>
 
 namespace IntuiCAM {
 namespace Simulation {
 
 // Material removal simulation and verification
+// Stock is modelled as an axisymmetric heightfield (see LatheStockModel)
 class MaterialSimulator {
 public:
     struct SimulationSettings {
-        double voxelSize = 0.1;             // mm - resolution of simulation
+        double voxelSize = 0.1;             // mm - axial slice width of the stock model
         bool enableCollisionDetection = true;
         bool enableVisualization = true;
         double simulationSpeed = 1.0;       // 1.0 = real-time
@@ -35,19 +37,33 @@ private:
     std::unique_ptr<Geometry::Part> stockMaterial_;
     std::unique_ptr<Geometry::Part> chuckGeometry_;
     
+    // Stock as set up, and the copy material is removed from
+    LatheStockModel initialStock_;
+    LatheStockModel currentStock_;
+    
+    // Step-by-step state
+    const Toolpath::Toolpath* activeToolpath_ = nullptr;
+    size_t nextMovement_ = 0;
+    bool paused_ = false;
+    
 public:
-    MaterialSimulator(const SimulationSettings& settings = SimulationSettings{});
+    MaterialSimulator();
+    MaterialSimulator(const SimulationSettings& settings);
     
     // Setup
+    // The stock part's turning axis is taken to be world Z, as in the viewer
     void setStockMaterial(std::unique_ptr<Geometry::Part> stock);
+    void setStockCylinder(double outerDiameter, double length, double axialStart = 0.0,
+                          double innerDiameter = 0.0);
     void setChuckGeometry(std::unique_ptr<Geometry::Part> chuck);
     void setSettings(const SimulationSettings& settings) { settings_ = settings; }
+    const LatheStockModel& getStockModel() const { return currentStock_; }
     
     // Simulation
     SimulationResult simulate(const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths);
     SimulationResult simulate(const Toolpath::Toolpath& toolpath);
     
-    // Step-by-step simulation
+    // Step-by-step simulation (the toolpath must outlive the stepping)
     void startSimulation(const Toolpath::Toolpath& toolpath);
     bool stepSimulation();  // Returns false when complete
     void pauseSimulation();
@@ -123,7 +139,8 @@ private:
     VisualizationOptions options_;
     
 public:
-    SimulationVisualizer(const VisualizationOptions& options = VisualizationOptions{});
+    SimulationVisualizer();
+    SimulationVisualizer(const VisualizationOptions& options);
     
     // Mesh generation
     std::unique_ptr<Geometry::Mesh> generateStockMesh(const Geometry::Part& stock) const;
@@ -0,0 +1,274 @@
+#include <IntuiCAM/Simulation/LatheStockModel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace IntuiCAM {
+namespace Simulation {
+
+namespace {
+constexpr double kPi = 3.14159265358979323846;
+
+// A run of consecutive slices with identical radii, used for meshing
+struct Band {
+    double axialStart;
+    double axialEnd;
+    double innerRadius;
+    double outerRadius;
+
+    bool isEmpty() const { return outerRadius <= innerRadius; }
+};
+
+double annulusArea(double innerRadius, double outerRadius) {
+    return outerRadius > innerRadius ? kPi * (outerRadius * outerRadius - innerRadius * innerRadius) : 0.0;
+}
+
+void addTriangle(Geometry::Mesh& mesh, const Geometry::Point3D& a, const Geometry::Point3D& b,
+                 const Geometry::Point3D& c) {
+    Geometry::Mesh::Triangle triangle;
+    triangle.vertices[0] = a;
+    triangle.vertices[1] = b;
+    triangle.vertices[2] = c;
+
+    double ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+    double vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+    double nx = uy * vz - uz * vy;
+    double ny = uz * vx - ux * vz;
+    double nz = ux * vy - uy * vx;
+    double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+    if (length > 0.0) {
+        triangle.normal = Geometry::Vector3D(nx / length, ny / length, nz / length);
+    }
+    mesh.addTriangle(triangle);
+}
+
+// Ring in the plane z = axial between two radii, facing +Z or -Z
+void addAnnulus(Geometry::Mesh& mesh, const std::vector<double>& cosines, const std::vector<double>& sines,
+                double axial, double innerRadius, double outerRadius, bool facingPositive) {
+    const size_t segments = cosines.size() - 1;
+    for (size_t j = 0; j < segments; ++j) {
+        Geometry::Point3D inner0(innerRadius * cosines[j], innerRadius * sines[j], axial);
+        Geometry::Point3D inner1(innerRadius * cosines[j + 1], innerRadius * sines[j + 1], axial);
+        Geometry::Point3D outer0(outerRadius * cosines[j], outerRadius * sines[j], axial);
+        Geometry::Point3D outer1(outerRadius * cosines[j + 1], outerRadius * sines[j + 1], axial);
+
+        if (facingPositive) {
+            addTriangle(mesh, inner0, outer0, outer1);
+            if (innerRadius > 0.0) {
+                addTriangle(mesh, inner0, outer1, inner1);
+            }
+        } else {
+            addTriangle(mesh, inner0, outer1, outer0);
+            if (innerRadius > 0.0) {
+                addTriangle(mesh, inner0, inner1, outer1);
+            }
+        }
+    }
+}
+
+// Cylindrical band at one radius between two axial positions
+void addCylinder(Geometry::Mesh& mesh, const std::vector<double>& cosines, const std::vector<double>& sines,
+                 double radius, double axialStart, double axialEnd, bool facingOutward) {
+    const size_t segments = cosines.size() - 1;
+    for (size_t j = 0; j < segments; ++j) {
+        Geometry::Point3D p00(radius * cosines[j], radius * sines[j], axialStart);
+        Geometry::Point3D p10(radius * cosines[j + 1], radius * sines[j + 1], axialStart);
+        Geometry::Point3D p01(radius * cosines[j], radius * sines[j], axialEnd);
+        Geometry::Point3D p11(radius * cosines[j + 1], radius * sines[j + 1], axialEnd);
+
+        if (facingOutward) {
+            addTriangle(mesh, p00, p10, p11);
+            addTriangle(mesh, p00, p11, p01);
+        } else {
+            addTriangle(mesh, p00, p11, p10);
+            addTriangle(mesh, p00, p01, p11);
+        }
+    }
+}
+
+// Parts of the annulus `a` not covered by annulus `b`
+void addExposedRings(Geometry::Mesh& mesh, const std::vector<double>& cosines, const std::vector<double>& sines,
+                     double axial, const Band& a, const Band& b, bool facingPositive) {
+    if (a.isEmpty()) {
+        return;
+    }
+    if (b.isEmpty()) {
+        addAnnulus(mesh, cosines, sines, axial, a.innerRadius, a.outerRadius, facingPositive);
+        return;
+    }
+
+    double lowerEnd = std::min(a.outerRadius, b.innerRadius);
+    if (a.innerRadius < lowerEnd) {
+        addAnnulus(mesh, cosines, sines, axial, a.innerRadius, lowerEnd, facingPositive);
+    }
+    double upperStart = std::max(a.innerRadius, b.outerRadius);
+    if (upperStart < a.outerRadius) {
+        addAnnulus(mesh, cosines, sines, axial, upperStart, a.outerRadius, facingPositive);
+    }
+}
+}
+
+void LatheStockModel::initializeCylinder(double axialMin, double axialMax, double outerRadius,
+                                         double innerRadius, double resolution) {
+    resolution_ = resolution > 0.0 ? resolution : 0.1;
+    axialMin_ = std::min(axialMin, axialMax);
+
+    double length = std::abs(axialMax - axialMin);
+    auto sliceCount = static_cast<size_t>(std::max(1.0, std::ceil(length / resolution_ - 1e-9)));
+
+    innerRadii_.assign(sliceCount, std::max(0.0, innerRadius));
+    outerRadii_.assign(sliceCount, std::max(0.0, outerRadius));
+    initialVolume_ = getVolume();
+}
+
+double LatheStockModel::sweep(const Geometry::Point2D& start, const Geometry::Point2D& end,
+                              double cutterRadius, CutSide side, bool apply) {
+    if (!isInitialized()) {
+        return 0.0;
+    }
+
+    const double radius = std::max(0.0, cutterRadius);
+    const bool external = side == CutSide::External;
+
+    // Slices whose centre lies inside the swept capsule's axial span
+    double spanStart = std::min(start.z, end.z) - radius;
+    double spanEnd = std::max(start.z, end.z) + radius;
+    double firstIndex = std::ceil((spanStart - axialMin_) / resolution_ - 0.5);
+    double lastIndex = std::floor((spanEnd - axialMin_) / resolution_ - 0.5);
+    if (lastIndex < 0.0 || firstIndex >= static_cast<double>(outerRadii_.size())) {
+        return 0.0;
+    }
+    size_t first = static_cast<size_t>(std::max(0.0, firstIndex));
+    size_t last = std::min(outerRadii_.size() - 1, static_cast<size_t>(lastIndex));
+
+    // The capsule boundary facing the material is the offset segment on that
+    // side plus the two end caps
+    double dz = end.z - start.z;
+    double dx = end.x - start.x;
+    double length = std::sqrt(dz * dz + dx * dx);
+    bool hasOffsetSegment = false;
+    Geometry::Point2D offsetStart, offsetEnd;
+    if (length > 0.0 && dz != 0.0) {
+        double normalZ = dx / length;
+        double normalX = -dz / length;
+        if ((external && normalX > 0.0) || (!external && normalX < 0.0)) {
+            normalZ = -normalZ;
+            normalX = -normalX;
+        }
+        offsetStart = Geometry::Point2D(start.x + normalX * radius, start.z + normalZ * radius);
+        offsetEnd = Geometry::Point2D(end.x + normalX * radius, end.z + normalZ * radius);
+        hasOffsetSegment = offsetStart.z != offsetEnd.z;
+    }
+
+    const double unreached = external ? std::numeric_limits<double>::infinity()
+                                      : -std::numeric_limits<double>::infinity();
+    auto closer = [external](double a, double b) { return external ? std::min(a, b) : std::max(a, b); };
+
+    double removed = 0.0;
+    for (size_t i = first; i <= last; ++i) {
+        double inner = innerRadii_[i];
+        double outer = outerRadii_[i];
+        if (outer <= inner) {
+            continue;
+        }
+
+        // Extreme radius the cutter reaches at this slice
+        double axial = getSliceCenter(i);
+        double reach = unreached;
+        for (const Geometry::Point2D* cap : {&start, &end}) {
+            double offset = axial - cap->z;
+            if (std::abs(offset) <= radius) {
+                double halfChord = std::sqrt(radius * radius - offset * offset);
+                reach = closer(reach, external ? cap->x - halfChord : cap->x + halfChord);
+            }
+        }
+        if (hasOffsetSegment &&
+            axial >= std::min(offsetStart.z, offsetEnd.z) &&
+            axial <= std::max(offsetStart.z, offsetEnd.z)) {
+            double t = (axial - offsetStart.z) / (offsetEnd.z - offsetStart.z);
+            reach = closer(reach, offsetStart.x + t * (offsetEnd.x - offsetStart.x));
+        }
+
+        if (external && reach < outer) {
+            double newOuter = std::max(reach, inner);
+            removed += (annulusArea(inner, outer) - annulusArea(inner, newOuter)) * resolution_;
+            if (apply) {
+                outerRadii_[i] = newOuter;
+            }
+        } else if (!external && reach > inner) {
+            double newInner = std::min(reach, outer);
+            removed += (annulusArea(inner, outer) - annulusArea(newInner, outer)) * resolution_;
+            if (apply) {
+                innerRadii_[i] = newInner;
+            }
+        }
+    }
+
+    return removed;
+}
+
+double LatheStockModel::getVolume() const {
+    double volume = 0.0;
+    for (size_t i = 0; i < outerRadii_.size(); ++i) {
+        volume += annulusArea(innerRadii_[i], outerRadii_[i]);
+    }
+    return volume * resolution_;
+}
+
+std::unique_ptr<Geometry::Mesh> LatheStockModel::generateMesh(int angularSegments) const {
+    auto mesh = std::make_unique<Geometry::Mesh>();
+    if (!isInitialized()) {
+        return mesh;
+    }
+
+    // Merge slices into bands of constant radii; empty slices become empty bands
+    std::vector<Band> bands;
+    for (size_t i = 0; i < outerRadii_.size(); ++i) {
+        Band band{axialMin_ + static_cast<double>(i) * resolution_,
+                  axialMin_ + static_cast<double>(i + 1) * resolution_,
+                  innerRadii_[i], outerRadii_[i]};
+        if (band.isEmpty()) {
+            band.innerRadius = band.outerRadius = 0.0;
+        }
+        if (!bands.empty() &&
+            bands.back().innerRadius == band.innerRadius &&
+            bands.back().outerRadius == band.outerRadius) {
+            bands.back().axialEnd = band.axialEnd;
+        } else {
+            bands.push_back(band);
+        }
+    }
+
+    const size_t segments = static_cast<size_t>(std::max(3, angularSegments));
+    std::vector<double> cosines(segments + 1), sines(segments + 1);
+    for (size_t j = 0; j <= segments; ++j) {
+        double angle = 2.0 * kPi * static_cast<double>(j % segments) / static_cast<double>(segments);
+        cosines[j] = std::cos(angle);
+        sines[j] = std::sin(angle);
+    }
+
+    const Band none{0.0, 0.0, 0.0, 0.0};
+    for (size_t k = 0; k < bands.size(); ++k) {
+        const Band& band = bands[k];
+        if (band.isEmpty()) {
+            continue;
+        }
+
+        addCylinder(*mesh, cosines, sines, band.outerRadius, band.axialStart, band.axialEnd, true);
+        if (band.innerRadius > 0.0) {
+            addCylinder(*mesh, cosines, sines, band.innerRadius, band.axialStart, band.axialEnd, false);
+        }
+
+        // End faces where this band is not covered by its neighbours
+        const Band& previous = k > 0 ? bands[k - 1] : none;
+        const Band& next = k + 1 < bands.size() ? bands[k + 1] : none;
+        addExposedRings(*mesh, cosines, sines, band.axialStart, band, previous, false);
+        addExposedRings(*mesh, cosines, sines, band.axialEnd, band, next, true);
+    }
+
+    return mesh;
+}
+
+} // namespace Simulation
+} // namespace IntuiCAM
@@ -0,0 +1,249 @@
+#include <IntuiCAM/Simulation/Types.h>
+#include <IntuiCAM/Common/Trace.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace IntuiCAM {
+namespace Simulation {
+
+namespace {
+constexpr double kPi = 3.14159265358979323846;
+
+// Rapids removing less than this are treated as grazing, not as collisions
+constexpr double kCollisionVolume = 1e-3;   // cubic mm
+
+bool isInternalOperation(Toolpath::OperationType type) {
+    switch (type) {
+        case Toolpath::OperationType::InternalRoughing:
+        case Toolpath::OperationType::InternalFinishing:
+        case Toolpath::OperationType::InternalGrooving:
+        case Toolpath::OperationType::Drilling:
+        case Toolpath::OperationType::Boring:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Radius of the round cutter the insert is approximated by
+double cutterRadius(const Toolpath::Tool* tool, Toolpath::OperationType type) {
+    Toolpath::Tool::Geometry geometry = tool ? tool->getGeometry() : Toolpath::Tool::Geometry{};
+    switch (type) {
+        case Toolpath::OperationType::Drilling:
+            return geometry.diameter / 2.0;
+        case Toolpath::OperationType::ExternalGrooving:
+        case Toolpath::OperationType::InternalGrooving:
+        case Toolpath::OperationType::Parting:
+            return geometry.insertWidth / 2.0;
+        default:
+            return geometry.tipRadius;
+    }
+}
+
+/**
+ * Apply one movement to the stock. Rapids never remove material; if they
+ * would, the end point is recorded as a collision instead.
+ * @return Volume removed in cubic mm
+ */
+double applyMovement(LatheStockModel& stock, const Toolpath::Toolpath& toolpath, size_t index,
+                     bool detectCollisions, std::vector<Geometry::Point3D>* collisions) {
+    const Toolpath::MovementView moves = toolpath.getMovements();
+    Toolpath::MovementType type = moves.type(index);
+    if (type == Toolpath::MovementType::Dwell || type == Toolpath::MovementType::ToolChange) {
+        return 0.0;
+    }
+
+    Toolpath::OperationType operation = moves.operationType(index);
+    if (operation == Toolpath::OperationType::Unknown) {
+        operation = toolpath.getOperationType();
+    }
+
+    // Toolpath positions store axial in x and radius in z
+    Geometry::Point3D startPoint = moves.startPoint(index);
+    Geometry::Point3D endPoint = moves.position(index);
+    Geometry::Point2D start(startPoint.z, startPoint.x);
+    Geometry::Point2D end(endPoint.z, endPoint.x);
+
+    double radius = cutterRadius(toolpath.getTool().get(), operation);
+    auto side = isInternalOperation(operation) ? LatheStockModel::CutSide::Internal
+                                               : LatheStockModel::CutSide::External;
+
+    if (type == Toolpath::MovementType::Rapid) {
+        if (detectCollisions && collisions &&
+            stock.sweep(start, end, radius, side, false) > kCollisionVolume) {
+            collisions->push_back(endPoint);
+        }
+        return 0.0;
+    }
+    return stock.sweep(start, end, radius, side, true);
+}
+
+void simulateToolpath(LatheStockModel& stock, const Toolpath::Toolpath& toolpath, bool detectCollisions,
+                      MaterialSimulator::SimulationResult& result) {
+    TRACE_SPAN("simulation", "MaterialSimulator::simulateToolpath");
+    size_t collisionsBefore = result.collisionPoints.size();
+    for (size_t i = 0; i < toolpath.getMovementCount(); ++i) {
+        applyMovement(stock, toolpath, i, detectCollisions, &result.collisionPoints);
+    }
+
+    size_t newCollisions = result.collisionPoints.size() - collisionsBefore;
+    if (newCollisions > 0) {
+        result.warnings.push_back(std::to_string(newCollisions) + " rapid move(s) in '" +
+                                  toolpath.getName() + "' pass through material");
+    }
+    result.totalMachiningTime += toolpath.estimateMachiningTime();
+}
+}
+
+MaterialSimulator::MaterialSimulator()
+    : MaterialSimulator(SimulationSettings{}) {
+}
+
+MaterialSimulator::MaterialSimulator(const SimulationSettings& settings)
+    : settings_(settings) {
+}
+
+void MaterialSimulator::setStockMaterial(std::unique_ptr<Geometry::Part> stock) {
+    stockMaterial_ = std::move(stock);
+    if (!stockMaterial_) {
+        initialStock_ = LatheStockModel();
+        resetSimulation();
+        return;
+    }
+
+    auto bounds = stockMaterial_->getBoundingBox();
+    double radius = std::max({std::abs(bounds.min.x), std::abs(bounds.max.x),
+                              std::abs(bounds.min.y), std::abs(bounds.max.y)});
+    initialStock_.initializeCylinder(bounds.min.z, bounds.max.z, radius, 0.0, settings_.voxelSize);
+    resetSimulation();
+}
+
+void MaterialSimulator::setStockCylinder(double outerDiameter, double length, double axialStart,
+                                         double innerDiameter) {
+    initialStock_.initializeCylinder(axialStart, axialStart + length, outerDiameter / 2.0,
+                                     innerDiameter / 2.0, settings_.voxelSize);
+    resetSimulation();
+}
+
+void MaterialSimulator::setChuckGeometry(std::unique_ptr<Geometry::Part> chuck) {
+    chuckGeometry_ = std::move(chuck);
+}
+
+MaterialSimulator::SimulationResult MaterialSimulator::simulate(
+    const std::vector<std::shared_ptr<Toolpath::Toolpath>>& toolpaths) {
+    SimulationResult result;
+    if (!initialStock_.isInitialized()) {
+        result.errors.push_back("No stock material defined");
+        return result;
+    }
+
+    resetSimulation();
+    for (const auto& toolpath : toolpaths) {
+        if (toolpath) {
+            simulateToolpath(currentStock_, *toolpath, settings_.enableCollisionDetection, result);
+        }
+    }
+
+    result.materialRemoved = currentStock_.getRemovedVolume();
+    result.finalPartMesh = currentStock_.generateMesh();
+    result.success = true;
+    return result;
+}
+
+MaterialSimulator::SimulationResult MaterialSimulator::simulate(const Toolpath::Toolpath& toolpath) {
+    SimulationResult result;
+    if (!initialStock_.isInitialized()) {
+        result.errors.push_back("No stock material defined");
+        return result;
+    }
+
+    resetSimulation();
+    simulateToolpath(currentStock_, toolpath, settings_.enableCollisionDetection, result);
+
+    result.materialRemoved = currentStock_.getRemovedVolume();
+    result.finalPartMesh = currentStock_.generateMesh();
+    result.success = true;
+    return result;
+}
+
+void MaterialSimulator::startSimulation(const Toolpath::Toolpath& toolpath) {
+    resetSimulation();
+    activeToolpath_ = &toolpath;
+}
+
+bool MaterialSimulator::stepSimulation() {
+    if (!activeToolpath_ || paused_ || nextMovement_ >= activeToolpath_->getMovementCount()) {
+        return false;
+    }
+
+    applyMovement(currentStock_, *activeToolpath_, nextMovement_, false, nullptr);
+    ++nextMovement_;
+    return nextMovement_ < activeToolpath_->getMovementCount();
+}
+
+void MaterialSimulator::pauseSimulation() {
+    paused_ = true;
+}
+
+void MaterialSimulator::resetSimulation() {
+    currentStock_ = initialStock_;
+    nextMovement_ = 0;
+    paused_ = false;
+}
+
+std::vector<Geometry::Point3D> MaterialSimulator::detectCollisions(const Toolpath::Toolpath& toolpath) const {
+    std::vector<Geometry::Point3D> collisions;
+    LatheStockModel stock = initialStock_;
+    for (size_t i = 0; i < toolpath.getMovementCount(); ++i) {
+        applyMovement(stock, toolpath, i, true, &collisions);
+    }
+    return collisions;
+}
+
+double MaterialSimulator::calculateMachiningTime(const Toolpath::Toolpath& toolpath) const {
+    return toolpath.estimateMachiningTime();
+}
+
+double MaterialSimulator::calculateMaterialRemovalRate(const Toolpath::Toolpath& toolpath) const {
+    double time = toolpath.estimateMachiningTime();
+    if (time <= 0.0) {
+        return 0.0;
+    }
+
+    LatheStockModel stock = initialStock_;
+    double removed = 0.0;
+    for (size_t i = 0; i < toolpath.getMovementCount(); ++i) {
+        removed += applyMovement(stock, toolpath, i, false, nullptr);
+    }
+    return removed / time;   // cubic mm per minute
+}
+
+std::unique_ptr<Geometry::Mesh> MaterialSimulator::getCurrentStateMesh() const {
+    return currentStock_.generateMesh();
+}
+
+std::unique_ptr<Geometry::Mesh> MaterialSimulator::getToolMesh(const Toolpath::Tool& tool,
+                                                               const Geometry::Point3D& position) const {
+    // Flat disc of the nose radius in the XZ viewer plane (X = radius, Z = axial)
+    auto mesh = std::make_unique<Geometry::Mesh>();
+    const int segments = 16;
+    const double radius = std::max(tool.getGeometry().tipRadius, 0.05);
+    Geometry::Point3D center(position.z, 0.0, position.x);
+
+    for (int j = 0; j < segments; ++j) {
+        double a0 = 2.0 * kPi * j / segments;
+        double a1 = 2.0 * kPi * (j + 1) / segments;
+        Geometry::Mesh::Triangle triangle;
+        triangle.vertices[0] = center;
+        triangle.vertices[1] = Geometry::Point3D(center.x + radius * std::cos(a0), 0.0, center.z + radius * std::sin(a0));
+        triangle.vertices[2] = Geometry::Point3D(center.x + radius * std::cos(a1), 0.0, center.z + radius * std::sin(a1));
+        triangle.normal = Geometry::Vector3D(0.0, -1.0, 0.0);
+        mesh->addTriangle(triangle);
+    }
+    return mesh;
+}
+
+} // namespace Simulation
+} // namespace IntuiCAM
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/Simulation/Types.h>
+
+#include <cmath>
+#include <map>
+#include <tuple>
+
+using namespace IntuiCAM;
+using Geometry::Point3D;
+using Simulation::LatheStockModel;
+using Simulation::MaterialSimulator;
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kNoseRadius = 0.4;
+
+double annulusArea(double innerRadius, double outerRadius) {
+    return kPi * (outerRadius * outerRadius - innerRadius * innerRadius);
+}
+
+std::shared_ptr<Toolpath::Tool> makeTool(const std::string& name) {
+    auto tool = std::make_shared<Toolpath::Tool>(Toolpath::Tool::Type::Turning, name);
+    Toolpath::Tool::Geometry geometry;
+    geometry.tipRadius = kNoseRadius;
+    tool->setGeometry(geometry);
+    return tool;
+}
+
+// Toolpath positions are (axial, 0, radius); the nose centre runs one nose
+// radius off the surface it leaves
+std::shared_ptr<Toolpath::Toolpath> makeTurningPass(double fromAxial, double toAxial, double radius) {
+    auto toolpath = std::make_shared<Toolpath::Toolpath>("turning", makeTool("T1"),
+                                                         Toolpath::OperationType::ExternalRoughing);
+    toolpath->addRapidMove(Point3D(fromAxial, 0.0, radius + 10.0));
+    toolpath->addRapidMove(Point3D(fromAxial, 0.0, radius + kNoseRadius));
+    toolpath->addLinearMove(Point3D(toAxial, 0.0, radius + kNoseRadius), 200.0);
+    toolpath->addRapidMove(Point3D(toAxial, 0.0, radius + 10.0));
+    return toolpath;
+}
+
+std::shared_ptr<Toolpath::Toolpath> makeBoringPass(double fromAxial, double toAxial, double radius) {
+    auto toolpath = std::make_shared<Toolpath::Toolpath>("boring", makeTool("T2"),
+                                                         Toolpath::OperationType::Boring);
+    toolpath->addRapidMove(Point3D(fromAxial, 0.0, 0.0));
+    toolpath->addRapidMove(Point3D(fromAxial, 0.0, radius - kNoseRadius));
+    toolpath->addLinearMove(Point3D(toAxial, 0.0, radius - kNoseRadius), 100.0);
+    toolpath->addRapidMove(Point3D(toAxial, 0.0, 0.0));
+    return toolpath;
+}
+
+double outerRadiusAt(const LatheStockModel& stock, double axial) {
+    return stock.getSlice(static_cast<size_t>((axial - stock.getAxialMin()) / stock.getResolution())).outerRadius;
+}
+
+double innerRadiusAt(const LatheStockModel& stock, double axial) {
+    return stock.getSlice(static_cast<size_t>((axial - stock.getAxialMin()) / stock.getResolution())).innerRadius;
+}
+
+} // namespace
+
+TEST(MaterialSimulatorTest, ExternalPassRemovesAnnulus) {
+    // 40 mm bar, 100 mm long; turn the last 50 mm down to 30 mm
+    MaterialSimulator simulator;
+    simulator.setStockCylinder(40.0, 100.0);
+    auto result = simulator.simulate(*makeTurningPass(105.0, 50.0, 15.0));
+
+    ASSERT_TRUE(result.success);
+    EXPECT_TRUE(result.collisionPoints.empty());
+
+    // The nose rounds the shoulder; that fillet is at most one nose radius wide
+    const double expected = annulusArea(15.0, 20.0) * 50.0;
+    EXPECT_NEAR(result.materialRemoved, expected, annulusArea(15.0, 20.0) * kNoseRadius);
+    EXPECT_GE(result.materialRemoved, expected);
+
+    const LatheStockModel& stock = simulator.getStockModel();
+    EXPECT_NEAR(outerRadiusAt(stock, 75.0), 15.0, 1e-9);
+    EXPECT_DOUBLE_EQ(outerRadiusAt(stock, 25.0), 20.0);
+    EXPECT_NEAR(stock.getRemovedVolume(), result.materialRemoved, 1e-9);
+}
+
+TEST(MaterialSimulatorTest, BoringCutsFromTheInside) {
+    // Tube 40 x 10 mm; bore the last 40 mm out to 16 mm
+    MaterialSimulator simulator;
+    simulator.setStockCylinder(40.0, 100.0, 0.0, 10.0);
+    auto result = simulator.simulate(*makeBoringPass(105.0, 60.0, 8.0));
+
+    ASSERT_TRUE(result.success);
+    EXPECT_TRUE(result.collisionPoints.empty());
+
+    const double expected = annulusArea(5.0, 8.0) * 40.0;
+    EXPECT_NEAR(result.materialRemoved, expected, annulusArea(5.0, 8.0) * kNoseRadius);
+
+    // Only the bore grows; the outside is untouched
+    const LatheStockModel& stock = simulator.getStockModel();
+    EXPECT_NEAR(innerRadiusAt(stock, 80.0), 8.0, 1e-9);
+    EXPECT_DOUBLE_EQ(innerRadiusAt(stock, 30.0), 5.0);
+    EXPECT_DOUBLE_EQ(outerRadiusAt(stock, 80.0), 20.0);
+}
+
+TEST(MaterialSimulatorTest, RapidThroughStockIsCollisionAndRemovesNothing) {
+    MaterialSimulator simulator;
+    simulator.setStockCylinder(40.0, 100.0);
+
+    Toolpath::Toolpath toolpath("crash", makeTool("T1"), Toolpath::OperationType::ExternalRoughing);
+    toolpath.addRapidMove(Point3D(50.0, 0.0, 30.0));
+    toolpath.addRapidMove(Point3D(50.0, 0.0, 10.0));    // Plunges 10 mm into the bar
+    toolpath.addRapidMove(Point3D(50.0, 0.0, 30.0));
+
+    auto result = simulator.simulate(toolpath);
+    ASSERT_TRUE(result.success);
+    EXPECT_DOUBLE_EQ(result.materialRemoved, 0.0);
+    EXPECT_DOUBLE_EQ(simulator.getStockModel().getVolume(), simulator.getStockModel().getInitialVolume());
+    EXPECT_FALSE(result.warnings.empty());
+
+    // The retract crosses the same material, which the plunge left in place
+    ASSERT_EQ(result.collisionPoints.size(), 2u);
+    EXPECT_DOUBLE_EQ(result.collisionPoints[0].z, 10.0);
+    EXPECT_EQ(simulator.detectCollisions(toolpath).size(), 2u);
+}
+
+TEST(MaterialSimulatorTest, GeneratesClosedMesh) {
+    // Turned and bored tube: outer step, inner step and both end faces
+    MaterialSimulator simulator;
+    simulator.setStockCylinder(40.0, 100.0, 0.0, 10.0);
+    auto result = simulator.simulate({makeTurningPass(105.0, 50.0, 15.0), makeBoringPass(105.0, 60.0, 8.0)});
+    ASSERT_TRUE(result.success);
+    ASSERT_TRUE(result.finalPartMesh);
+
+    const int segments = 32;
+    auto mesh = simulator.getStockModel().generateMesh(segments);
+    ASSERT_GT(mesh->getTriangleCount(), 0u);
+
+    // Closed and consistently oriented: every directed edge is matched by its reverse
+    using Vertex = std::tuple<double, double, double>;
+    std::map<std::pair<Vertex, Vertex>, int> edges;
+    for (const auto& triangle : mesh->triangles) {
+        for (int k = 0; k < 3; ++k) {
+            const Point3D& a = triangle.vertices[k];
+            const Point3D& b = triangle.vertices[(k + 1) % 3];
+            ++edges[{Vertex(a.x, a.y, a.z), Vertex(b.x, b.y, b.z)}];
+        }
+    }
+    for (const auto& [edge, count] : edges) {
+        EXPECT_EQ(count, 1);
+        auto reverse = edges.find({edge.second, edge.first});
+        ASSERT_NE(reverse, edges.end());
+        EXPECT_EQ(reverse->second, 1);
+    }
+
+    // The enclosed volume is the model's, scaled by the polygon's share of the circle
+    const double polygonFactor = segments / (2.0 * kPi) * std::sin(2.0 * kPi / segments);
+    EXPECT_NEAR(mesh->calculateVolume(), simulator.getStockModel().getVolume() * polygonFactor,
+                simulator.getStockModel().getVolume() * 1e-9);
+}
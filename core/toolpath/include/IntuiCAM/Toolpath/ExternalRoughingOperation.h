@@ -2,6 +2,7 @@
 
 #include <IntuiCAM/Toolpath/Types.h>
 #include <IntuiCAM/Toolpath/LatheProfile.h>
+#include <IntuiCAM/Toolpath/ProfileIndex.h>
 #include <IntuiCAM/Geometry/Types.h>
 #include <vector>
 
@@ -60,7 +61,7 @@ private:
     std::unique_ptr<Toolpath> generateAxialRoughing();
     std::unique_ptr<Toolpath> generateRadialRoughing();
     std::unique_ptr<Toolpath> generateProfileFollowingRoughing(const LatheProfile::Profile2D& profile);
-    void generateProfileFollowingPass(Toolpath* toolpath, const LatheProfile::Profile2D& profile, double targetRadius, bool reverse);
+    void generateProfileFollowingPass(Toolpath* toolpath, const ProfileIndex& profileIndex, double targetRadius, bool reverse);
     void addRoughingPass(Toolpath* toolpath, double currentZ, double currentDiameter, bool reverse = false);
 };
 
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <IntuiCAM/Toolpath/Types.h>
+#include <IntuiCAM/Toolpath/OperationParameterManager.h>
+
+namespace IntuiCAM {
+namespace Toolpath {
+
+/**
+ * @brief Plans constant surface speed and feed per revolution for turning moves
+ *
+ * Operations emit one fixed feed in mm/min and the tool's fixed RPM, so
+ * facing towards the center and roughing across large diameter changes run
+ * far from the material's cutting speed. The planner annotates every move of
+ * a turning operation with:
+ * - a surface speed (G96) from the material, scaled per operation kind, and
+ *   the machine's spindle limit as the G50 clamp;
+ * - a feed per revolution (G95) from the material's chip load, keeping the
+ *   operation's own slow-downs (plunges, entries) as a fraction of it.
+ *
+ * Threading needs a fixed RPM for the spindle sync and drilling happens on
+ * the axis, so both are left as generated, as is any move that already
+ * carries a per-revolution feed or a surface speed.
+ */
+class FeedSpeedPlanner {
+public:
+    struct Parameters {
+        OperationParameterManager::MaterialProperties material;
+        double maxSpindleSpeed = 3000.0;  // RPM - G50 clamp (MachineConfig::maxSpindleSpeed)
+    };
+
+    struct Report {
+        size_t toolpathsPlanned = 0;
+        size_t movesPlanned = 0;
+        double timeBefore = 0.0;     // minutes, from Toolpath::estimateMachiningTime
+        double timeAfter = 0.0;
+
+        double timeSaved() const { return timeBefore - timeAfter; }
+    };
+
+    FeedSpeedPlanner() = default;
+    explicit FeedSpeedPlanner(const Parameters& params) : params_(params) {}
+
+    // Annotate every toolpath of @p timeline in place
+    Report plan(std::vector<std::unique_ptr<Toolpath>>& timeline) const;
+
+    // Annotate one toolpath in place; returns the number of moves planned
+    size_t plan(Toolpath& toolpath) const;
+
+private:
+    Parameters params_;
+};
+
+} // namespace Toolpath
+} // namespace IntuiCAM
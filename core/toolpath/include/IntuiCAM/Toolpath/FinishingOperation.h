@@ -92,6 +92,19 @@ public:
 private:
     Parameters params_;
     
+    /**
+     * @brief Finishing profile vertex; arcFromPrevious marks an exact arc from
+     *        the previous vertex (arcStart) about arcCenter, in travel direction
+     */
+    struct FinishingPoint : IntuiCAM::Geometry::Point2D {
+        bool arcFromPrevious = false;
+        IntuiCAM::Geometry::Point2D arcStart;
+        IntuiCAM::Geometry::Point2D arcCenter;
+        bool arcClockwise = false;
+        
+        FinishingPoint(const IntuiCAM::Geometry::Point2D& point) : IntuiCAM::Geometry::Point2D(point) {}
+    };
+    
 public:
     FinishingOperation(const std::string& name, std::shared_ptr<Tool> tool);
     
@@ -112,13 +125,13 @@ private:
     std::unique_ptr<Toolpath> generateSpringPassFinishing(const LatheProfile::Profile2D& profile);
     
     // Profile processing methods
-    std::vector<IntuiCAM::Geometry::Point2D> optimizeProfileForFinishing(const LatheProfile::Profile2D& profile);
+    std::vector<FinishingPoint> optimizeProfileForFinishing(const LatheProfile::Profile2D& profile);
     double calculateSpindleSpeed(double diameter) const;
     double calculateAdaptiveFeedRate(const IntuiCAM::Geometry::Point2D& point, 
                                    const IntuiCAM::Geometry::Point2D& nextPoint) const;
     
     // Tool path optimization
-    void addFinishingMove(Toolpath* toolpath, const IntuiCAM::Geometry::Point3D& point, double feedRate);
+    void addFinishingMove(Toolpath* toolpath, const FinishingPoint& point, double stockAllowance, double feedRate);
     void addApproachMove(Toolpath* toolpath, const IntuiCAM::Geometry::Point3D& startPoint);
     void addRetractMove(Toolpath* toolpath, const IntuiCAM::Geometry::Point3D& endPoint);
 };
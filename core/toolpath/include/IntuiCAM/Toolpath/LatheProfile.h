@@ -29,13 +29,23 @@ public:
         TopoDS_Edge edge;                    // Original OCCT edge
         IntuiCAM::Geometry::Point2D start;   // Start point (radius, z) 
         IntuiCAM::Geometry::Point2D end;     // End point (radius, z)
-        double length;                       // Segment length
+        double length;                       // Segment length (arc length for arcs)
         bool isLinear;                       // True if linear, false if curved
         
+        // Exact circular arc parameters, set when the edge is a circle in the
+        // profile plane. Clockwise is seen with Z to the right and radius up.
+        bool isArc = false;
+        IntuiCAM::Geometry::Point2D center;  // Arc center (radius, z)
+        double radius = 0.0;
+        bool clockwise = false;
+        
         ProfileSegment() : length(0.0), isLinear(true) {}
         ProfileSegment(const TopoDS_Edge& e, const IntuiCAM::Geometry::Point2D& s, 
                       const IntuiCAM::Geometry::Point2D& e_pt, double len, bool linear)
             : edge(e), start(s), end(e_pt), length(len), isLinear(linear) {}
+        
+        // Signed sweep from start to end in radians, negative when clockwise (arcs only)
+        double sweepAngle() const;
     };
 
     /**
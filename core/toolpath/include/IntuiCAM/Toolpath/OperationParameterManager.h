@@ -160,6 +160,20 @@ public:
      */
     static MaterialProperties getMaterialProperties(const std::string& materialType);
 
+    /**
+     * @brief Recommended cutting (surface) speed for a material
+     * @param material Material properties
+     * @return Cutting speed in m/min
+     */
+    static double recommendedCuttingSpeed(const MaterialProperties& material);
+
+    /**
+     * @brief Recommended feed per revolution (chip load) for a material
+     * @param material Material properties
+     * @return Feed in mm/rev
+     */
+    static double recommendedFeedPerRevolution(const MaterialProperties& material);
+
     /**
      * @brief Create default configuration for operation type
      * @param operationType Type of operation
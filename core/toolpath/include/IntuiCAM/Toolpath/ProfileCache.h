@@ -0,0 +1,88 @@
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+
+// OpenCASCADE includes
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax1.hxx>
+#include <gp_Trsf.hxx>
+
+// IntuiCAM includes
+#include <IntuiCAM/Toolpath/LatheProfile.h>
+
+namespace IntuiCAM {
+namespace Toolpath {
+
+/**
+ * @brief Process-wide cache of extracted lathe profiles
+ *
+ * Sectioning a part is expensive, so LatheProfile::extractSegmentProfile stores
+ * its result here, keyed by shape identity, workpiece pose, turning axis and
+ * tolerance. Shape identity is the underlying TShape plus orientation. The pose
+ * is the numeric value of the shape's location. Because of this, a workpiece
+ * moved with BRepBuilderAPI_Transform (which only updates the location) hits the
+ * same entry as long as the pose is unchanged. Each entry holds the shape, so
+ * its TShape cannot be freed and reused by another part while it is cached.
+ *
+ * Entries are evicted least-recently-used. All methods are thread-safe.
+ */
+class ProfileCache {
+public:
+    static ProfileCache& instance();
+
+    /**
+     * @brief Look up a previously extracted profile
+     * @return true and fill @p profile on a hit
+     */
+    bool lookup(const TopoDS_Shape& partGeometry,
+                const gp_Ax1& turningAxis,
+                double tolerance,
+                LatheProfile::Profile2D& profile);
+
+    /**
+     * @brief Store an extracted profile, evicting the least recently used entry if full
+     */
+    void store(const TopoDS_Shape& partGeometry,
+               const gp_Ax1& turningAxis,
+               double tolerance,
+               const LatheProfile::Profile2D& profile);
+
+    void clear();
+
+    void setCapacity(size_t capacity);
+    size_t getCapacity() const;
+    size_t size() const;
+
+    size_t getHitCount() const { return hits_; }
+    size_t getMissCount() const { return misses_; }
+
+private:
+    ProfileCache() = default;
+    ProfileCache(const ProfileCache&) = delete;
+    ProfileCache& operator=(const ProfileCache&) = delete;
+
+    struct Entry {
+        TopoDS_Shape shape;     // keeps the TShape alive while cached
+        gp_Trsf pose;
+        gp_Ax1 turningAxis;
+        double tolerance = 0.0;
+        LatheProfile::Profile2D profile;
+    };
+
+    static bool matches(const Entry& entry,
+                        const TopoDS_Shape& partGeometry,
+                        const gp_Ax1& turningAxis,
+                        double tolerance);
+
+    mutable std::mutex mutex_;
+    std::list<Entry> entries_;   // most recently used first
+    size_t capacity_ = 16;
+    std::atomic<size_t> hits_{0};
+    std::atomic<size_t> misses_{0};
+};
+
+} // namespace Toolpath
+} // namespace IntuiCAM
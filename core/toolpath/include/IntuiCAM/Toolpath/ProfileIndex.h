@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <IntuiCAM/Toolpath/LatheProfile.h>
+
+namespace IntuiCAM {
+namespace Toolpath {
+
+/**
+ * @brief Static interval index over the segments of a Profile2D
+ *
+ * Operations that query a profile many times (roughing passes at decreasing
+ * radius, parting checks) used to scan every segment for every query. A
+ * single query is cheaper as a linear scan than building the index. The
+ * index keeps two augmented interval trees, one over the radius
+ * span and one over the Z span of each segment, so a query costs
+ * O(log n + k) for k matching segments. Building is O(n log n).
+ *
+ * Arc segments (ProfileSegment::isArc) are indexed by the full extent of the
+ * arc, not of its chord, and queries evaluate them on the circle.
+ *
+ * The index copies the segment end points; it stays valid after the profile
+ * it was built from is destroyed.
+ */
+class ProfileIndex {
+public:
+    ProfileIndex() = default;
+    explicit ProfileIndex(const LatheProfile::Profile2D& profile);
+
+    bool isEmpty() const { return starts_.empty(); }
+    size_t getSegmentCount() const { return starts_.size(); }
+
+    /**
+     * @brief Z positions where the profile crosses radius @p radius, ascending
+     *
+     * A segment with constant radius equal to @p radius contributes its start Z.
+     */
+    std::vector<double> zCrossingsAtRadius(double radius) const;
+
+    /**
+     * @brief Z intervals of material at @p radius
+     *
+     * Consecutive crossings are paired, so for a closed half-section the
+     * intervals are where the radius line lies inside the part.
+     */
+    std::vector<std::pair<double, double>> materialIntervalsAtRadius(double radius) const;
+
+    /**
+     * @brief Largest profile radius over Z in [@p z - tolerance, @p z + tolerance]
+     * @return false when no segment reaches that Z range
+     */
+    bool radiusEnvelopeAtZ(double z, double& radius, double tolerance = 0.0) const;
+
+    /** @brief Indices of segments whose Z span overlaps [minZ, maxZ], ascending */
+    std::vector<size_t> segmentsInZRange(double minZ, double maxZ) const;
+
+    /** @brief Indices of segments whose radius span overlaps [minRadius, maxRadius], ascending */
+    std::vector<size_t> segmentsInRadiusRange(double minRadius, double maxRadius) const;
+
+    const IntuiCAM::Geometry::Point2D& segmentStart(size_t index) const { return starts_[index]; }
+    const IntuiCAM::Geometry::Point2D& segmentEnd(size_t index) const { return ends_[index]; }
+
+private:
+    // Circle of an arc segment, with angles measured with Z horizontal and
+    // radius vertical as in LatheProfile::ProfileSegment::sweepAngle
+    struct ArcSpan {
+        bool isArc = false;
+        IntuiCAM::Geometry::Point2D center;
+        double radius = 0.0;
+        double startAngle = 0.0;
+        double sweep = 0.0;
+
+        bool contains(double angle) const;
+        IntuiCAM::Geometry::Point2D pointAt(double angle) const;
+        double highestRadiusNear(double z, double tolerance) const;
+    };
+
+    /**
+     * Intervals sorted by low end and laid out as an implicit balanced tree:
+     * the middle of every index range is that subtree's root, and maxHigh
+     * holds the largest high end within the subtree.
+     */
+    struct IntervalTree {
+        std::vector<double> low;
+        std::vector<double> high;
+        std::vector<double> maxHigh;
+        std::vector<size_t> segment;
+
+        void build(std::vector<std::pair<double, double>> spans);
+        void query(double minValue, double maxValue, std::vector<size_t>& hits) const;
+
+    private:
+        double buildRange(size_t begin, size_t end);
+        void queryRange(size_t begin, size_t end, double minValue, double maxValue,
+                        std::vector<size_t>& hits) const;
+    };
+
+    std::vector<IntuiCAM::Geometry::Point2D> starts_;
+    std::vector<IntuiCAM::Geometry::Point2D> ends_;
+    std::vector<ArcSpan> arcs_;
+    IntervalTree byRadius_;
+    IntervalTree byZ_;
+};
+
+} // namespace Toolpath
+} // namespace IntuiCAM
@@ -7,15 +7,22 @@
 
 #include <AIS_InteractiveObject.hxx>
 #include <AIS_ColoredShape.hxx>
+#include <Graphic3d_ArrayOfSegments.hxx>
 #include <Prs3d_Presentation.hxx>
 #include <Quantity_Color.hxx>
+#include <Select3D_SensitivePrimitiveArray.hxx>
 #include <TopoDS_Shape.hxx>
 #include <gp_Pnt.hxx>
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <string>
 
+class AIS_InteractiveContext;
+class V3d_View;
+
 // Forward declarations
 namespace IntuiCAM {
 namespace Toolpath {
@@ -58,14 +65,16 @@ public:
         bool showToolPath = true;
         bool showStartPoint = true;
         bool showEndPoint = true;
-        bool animateProgress = false;
+        bool animateProgress = false;       // Playback: build once, setProgress only moves the draw range
         double animationSpeed = 1.0;
         ColorScheme colorScheme = ColorScheme::Default;
         double transparency = 0.0;
+        bool levelOfDetail = true;          // Simplify the wireframe when zoomed out
+        double lodPixelTolerance = 0.5;     // Largest allowed on-screen deviation, pixels
     };
 
     // Constructor
-    explicit ToolpathDisplayObject(std::shared_ptr<Toolpath> toolpath,
+    explicit ToolpathDisplayObject(std::shared_ptr<const Toolpath> toolpath,
                                    const VisualizationSettings& settings = VisualizationSettings{});
 
     // Standard AIS methods
@@ -77,8 +86,8 @@ public:
                           const Standard_Integer theMode) override;
 
     // Toolpath specific methods
-    void setToolpath(std::shared_ptr<Toolpath> toolpath);
-    std::shared_ptr<Toolpath> getToolpath() const { return toolpath_; }
+    void setToolpath(std::shared_ptr<const Toolpath> toolpath);
+    std::shared_ptr<const Toolpath> getToolpath() const { return toolpath_; }
 
     void setVisualizationSettings(const VisualizationSettings& settings);
     const VisualizationSettings& getVisualizationSettings() const { return settings_; }
@@ -90,10 +99,21 @@ public:
     void setProgress(double progress); // 0.0 to 1.0 for animation
     double getProgress() const { return progress_; }
 
+    /**
+     * @brief Pick the wireframe detail level for the view's current scale
+     *
+     * Selects the coarsest precomputed level whose deviation from the full
+     * toolpath stays below lodPixelTolerance pixels. Call after zoom changes;
+     * returns true when the level changed and the presentation must be updated.
+     */
+    bool updateLevelOfDetail(const Handle(V3d_View)& view);
+    size_t getDetailLevelCount() const { return detailLevels_.size() + 1; }
+    size_t getCurrentDetailLevel() const { return currentDetailLevel_; }
+
     // Color management
     void setColorScheme(ColorScheme scheme);
     void setCustomColor(const Quantity_Color& color);
-    Quantity_Color getColorForMove(const Movement& move, size_t moveIndex) const;
+    Quantity_Color getColorForMove(const MovementRecord& move, size_t moveIndex) const;
 
     // Statistics
     struct DisplayStatistics {
@@ -112,25 +132,62 @@ public:
     DisplayStatistics calculateStatistics() const;
 
     // Utility methods
-    static Handle(ToolpathDisplayObject) create(std::shared_ptr<Toolpath> toolpath,
+    static Handle(ToolpathDisplayObject) create(std::shared_ptr<const Toolpath> toolpath,
                                                 const VisualizationSettings& settings = VisualizationSettings{});
 
     // Selection and highlighting
+    /**
+     * @brief Move under the cursor at the context's last detection
+     * @return False when the detected object is not this toolpath
+     */
+    bool getDetectedMove(const Handle(AIS_InteractiveContext)& context, size_t& moveIndex) const;
+    
     void highlightMove(size_t moveIndex, bool highlight = true);
     void clearHighlights();
     std::vector<size_t> getSelectedMoves() const { return selectedMoves_; }
 
 private:
     // Core data
-    std::shared_ptr<Toolpath> toolpath_;
+    std::shared_ptr<const Toolpath> toolpath_;
     VisualizationSettings settings_;
     bool isVisible_;
     double progress_; // For animation
+    bool hasCustomColor_;
+    Quantity_Color customColor_;  // Overrides feed/cutting colors when set
     
     // Display state
     std::vector<size_t> selectedMoves_;
     bool needsUpdate_;
     
+    // Selection: one BVH-backed entity; element k belongs to move
+    // selectionElementMoves_[k] (arcs span several elements)
+    Handle(Select3D_SensitivePrimitiveArray) selectionEntity_;
+    std::vector<size_t> selectionElementMoves_;
+    
+    // Wireframe level-of-detail hierarchy, built on first use. Level 0 is the
+    // full toolpath and is not stored; detailLevels_[k - 1] holds the move
+    // indices kept at level k, which deviates at most `tolerance` (viewer
+    // units) from the full polyline. Runs of one move category and operation
+    // are simplified independently, so colors and boundaries are preserved.
+    struct DetailLevel {
+        double tolerance = 0.0;
+        std::vector<std::uint32_t> vertices;
+    };
+    std::vector<DetailLevel> detailLevels_;
+    bool detailLevelsBuilt_ = false;
+    size_t currentDetailLevel_ = 0;
+    
+    // Playback (animateProgress): the whole toolpath is uploaded once, one
+    // array per move category (rapid, feed, cutting). setProgress only changes
+    // how many elements of each array are drawn.
+    struct PlaybackArray {
+        Handle(Graphic3d_ArrayOfSegments) segments;
+        std::vector<std::uint32_t> moveIndices;  // end move of each segment, ascending
+        std::vector<std::uint32_t> vertexEnds;   // vertex count after each move (arcs use several chords)
+    };
+    std::array<PlaybackArray, 3> playbackArrays_;
+    bool playbackBuilt_ = false;
+    
     // Computed geometry
     std::vector<Handle(AIS_InteractiveObject)> moveObjects_;
     Handle(AIS_InteractiveObject) startPointMarker_;
@@ -140,16 +197,22 @@ private:
     void computeWireframePresentation(const Handle(Prs3d_Presentation)& presentation);
     void computeShadedPresentation(const Handle(Prs3d_Presentation)& presentation);
     void computeMoveTypePresentation(const Handle(Prs3d_Presentation)& presentation, DisplayMode mode);
+    void computePlaybackPresentation(const Handle(Prs3d_Presentation)& presentation);
+    bool applyPlaybackRange();  // true when a draw count changed
+    void resetPlayback();
+    
+    void buildDetailLevels();
+    void invalidateDetailLevels();
     
     void createMoveGeometry();
     Handle(AIS_InteractiveObject) createMoveObject(const Movement& move, size_t moveIndex);
     Handle(AIS_InteractiveObject) createPointMarker(const gp_Pnt& point, const Quantity_Color& color);
     
     // Color calculation
-    Quantity_Color getDefaultColor(const Movement& move) const;
+    Quantity_Color getDefaultColor(const MovementRecord& move) const;
     Quantity_Color getRainbowColor(double value, double min, double max) const;
     Quantity_Color getDepthBasedColor(double z, double minZ, double maxZ) const;
-    Quantity_Color getOperationTypeColor(const Movement& move) const;
+    Quantity_Color getOperationTypeColor(const MovementRecord& move) const;
     
     // Geometry utilities
     TopoDS_Shape createLineShape(const gp_Pnt& start, const gp_Pnt& end) const;
@@ -230,7 +293,7 @@ private:
 class ToolpathDisplayFactory {
 public:
     static Handle(ToolpathDisplayObject) createToolpathDisplay(
-        std::shared_ptr<Toolpath> toolpath,
+        std::shared_ptr<const Toolpath> toolpath,
         const std::string& operationType = "",
         const ToolpathDisplayObject::VisualizationSettings& settings = ToolpathDisplayObject::VisualizationSettings{});
 
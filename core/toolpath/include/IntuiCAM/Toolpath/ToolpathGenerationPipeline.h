@@ -7,6 +7,9 @@
 #include <functional>
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
 
 // OpenCASCADE includes
 #include <TopoDS_Shape.hxx>
@@ -16,6 +19,8 @@
 // IntuiCAM includes
 #include <IntuiCAM/Toolpath/Types.h>
 #include <IntuiCAM/Toolpath/LatheProfile.h>
+#include <IntuiCAM/Toolpath/ToolpathLinker.h>
+#include <IntuiCAM/Toolpath/FeedSpeedPlanner.h>
 #include <IntuiCAM/Geometry/Types.h>
 
 namespace IntuiCAM {
@@ -24,6 +29,8 @@ namespace Toolpath {
 // Forward declarations
 class Tool;
 class Toolpath;
+class PipelineJob;
+class PipelineStageCache;
 
 /**
  * @brief New Toolpath Generation Pipeline following chronological CAM strategy
@@ -98,6 +105,17 @@ public:
         std::string internalFinishingTool = "internal finishing tool";
         std::string externalFinishingTool = "external finishing tool";
         std::string partingTool = "parting tool";
+        
+        // Output
+        double compressionTolerance = 0.002; // mm - line/arc merging of feed moves (0 = off)
+        bool linkRapids = true;              // re-route rapids between cuts against the stock envelope
+        double linkClearance = 2.0;          // mm - kept above the remaining stock by re-routed rapids
+        bool constantSurfaceSpeed = true;    // plan G96 surface speed and G95 feed per move
+        std::string materialType = "steel";  // OperationParameterManager material for the plan
+        double maxSpindleSpeed = 3000.0;     // RPM - G50 clamp, MachineConfig::maxSpindleSpeed
+        
+        // Execution
+        int maxParallelStages = 0;           // worker threads for independent stages (0 = all cores)
     };
 
     // Pipeline result containing timeline of operations
@@ -109,6 +127,12 @@ public:
         // Generated timeline (ordered list of toolpaths)
         std::vector<std::unique_ptr<Toolpath>> timeline;
         
+        // Rapid linking over the timeline, with estimated cycle time before and after
+        ToolpathLinker::Report linking;
+        
+        // Feed and speed planning, with estimated cycle time before and after
+        FeedSpeedPlanner::Report feedSpeedPlan;
+        
         // Display objects for visualization
         std::vector<Handle(AIS_InteractiveObject)> toolpathDisplayObjects;
         Handle(AIS_InteractiveObject) profileDisplayObject;
@@ -132,6 +156,42 @@ public:
      */
     PipelineResult executePipeline(const PipelineInputs& inputs);
 
+    /**
+     * @brief Pipeline execution with progress reporting
+     * @param inputs Complete input parameters
+     * @param progressCallback Receives (progress 0..1, status) after each stage
+     * @return Pipeline result with ordered timeline of toolpaths
+     */
+    PipelineResult executePipeline(const PipelineInputs& inputs,
+                                   std::function<void(double, const std::string&)> progressCallback);
+
+    /**
+     * @brief Start pipeline execution on a background thread
+     *
+     * Each job owns its own pipeline instance, so several jobs may be in flight
+     * while a stale one winds down after cancellation. Both callbacks are invoked
+     * on the worker thread; GUI callers must marshal them to their own thread.
+     *
+     * @param inputs Complete input parameters (copied into the job)
+     * @param progressCallback Receives (progress 0..1, status) while generating
+     * @param completionCallback Invoked once when the job has finished, failed or been cancelled
+     * @return Handle used to poll, wait for, cancel and collect the job
+     */
+    static std::shared_ptr<PipelineJob> executePipelineAsync(
+        const PipelineInputs& inputs,
+        std::function<void(double, const std::string&)> progressCallback = nullptr,
+        std::function<void(const std::shared_ptr<PipelineJob>&)> completionCallback = nullptr,
+        std::shared_ptr<PipelineStageCache> stageCache = nullptr);
+
+    /**
+     * @brief Attach a stage cache so unchanged stages are reused between runs
+     *
+     * The cache may be shared by several pipelines (e.g. successive async jobs).
+     * Pass nullptr to always regenerate every stage.
+     */
+    void setStageCache(std::shared_ptr<PipelineStageCache> stageCache) { m_stageCache = std::move(stageCache); }
+    std::shared_ptr<PipelineStageCache> getStageCache() const { return m_stageCache; }
+
     /**
      * @brief Extract inputs from part geometry and GUI settings
      * @param partGeometry 3D part to machine
@@ -212,17 +272,136 @@ private:
 
 public:
     // Public helper methods for toolpath display 
+    // Takes ownership of the toolpaths; each display object shares its
+    // toolpath instead of holding a copy.
     std::vector<Handle(AIS_InteractiveObject)> createToolpathDisplayObjects(
-        const std::vector<std::unique_ptr<Toolpath>>& toolpaths,
+        std::vector<std::unique_ptr<Toolpath>> toolpaths,
         const gp_Trsf& workpieceTransform = gp_Trsf());
 
 private:
     // Helper methods
     void reportProgress(double progress, const std::string& status, const PipelineResult& result);
+    bool checkCancelled(PipelineResult& result);
+
+    friend class PipelineJob;
 
     // State management
     std::atomic<bool> m_isGenerating{false};
     std::atomic<bool> m_cancelRequested{false};
+    // Cancel flag of the owning PipelineJob; survives the reset on entry
+    const std::atomic<bool>* m_externalCancel = nullptr;
+    std::shared_ptr<PipelineStageCache> m_stageCache;
+};
+
+/**
+ * @brief Memo of per-stage pipeline output
+ *
+ * Each stage stores its toolpaths under a hash of the PipelineInputs fields it
+ * actually reads, so changing e.g. externalFinishingPasses only invalidates
+ * external finishing. Only the latest result per stage is kept. Reused
+ * toolpaths are deep-copied into the new timeline. All methods are thread-safe.
+ */
+class PipelineStageCache {
+public:
+    /**
+     * @brief Copy the cached toolpaths of a stage if its key matches
+     * @return true on a cache hit
+     */
+    bool lookup(const std::string& stage, std::uint64_t key,
+                std::vector<std::unique_ptr<Toolpath>>& toolpaths) const;
+
+    // Replace the cached result of a stage
+    void store(const std::string& stage, std::uint64_t key,
+               const std::vector<std::unique_ptr<Toolpath>>& toolpaths);
+
+    void clear();
+
+    size_t getHitCount() const { return m_hits; }
+    size_t getMissCount() const { return m_misses; }
+
+private:
+    struct Entry {
+        std::uint64_t key = 0;
+        std::vector<std::unique_ptr<Toolpath>> toolpaths;
+    };
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, Entry> m_entries;
+    mutable std::atomic<size_t> m_hits{0};
+    mutable std::atomic<size_t> m_misses{0};
+};
+
+/**
+ * @brief Handle to a pipeline run executing on a background thread
+ *
+ * Created by ToolpathGenerationPipeline::executePipelineAsync(). The worker keeps
+ * the job alive until it finishes, so dropping the handle never blocks the caller.
+ */
+class PipelineJob : public std::enable_shared_from_this<PipelineJob> {
+public:
+    enum class State {
+        Running,
+        Completed,
+        Failed,
+        Cancelled
+    };
+
+    using ProgressCallback = std::function<void(double, const std::string&)>;
+    using CompletionCallback = std::function<void(const std::shared_ptr<PipelineJob>&)>;
+
+    ~PipelineJob() = default;
+
+    // Unique, monotonically increasing id - later jobs always have larger ids
+    std::uint64_t getId() const { return m_id; }
+
+    State getState() const { return m_state; }
+    bool isFinished() const;
+    bool isCancelRequested() const { return m_cancelRequested; }
+
+    // Last progress value reported by the pipeline (0..1)
+    double getProgress() const { return m_progress; }
+
+    /**
+     * @brief Request cancellation; the pipeline stops at the next stage boundary
+     */
+    void cancel();
+
+    // Block until the job has finished and its completion callback has returned
+    void wait() const;
+    bool waitFor(std::chrono::milliseconds timeout) const;
+
+    /**
+     * @brief Move the result out of a finished job
+     * @return The pipeline result, or an unsuccessful result if the job is still
+     *         running or the result was already taken
+     */
+    ToolpathGenerationPipeline::PipelineResult takeResult();
+
+private:
+    friend class ToolpathGenerationPipeline;
+
+    PipelineJob(const ToolpathGenerationPipeline::PipelineInputs& inputs,
+                ProgressCallback progressCallback,
+                CompletionCallback completionCallback);
+
+    void start();
+    void run();
+
+    std::uint64_t m_id;
+    ToolpathGenerationPipeline m_pipeline;
+    ToolpathGenerationPipeline::PipelineInputs m_inputs;
+    ProgressCallback m_progressCallback;
+    CompletionCallback m_completionCallback;
+
+    std::atomic<State> m_state{State::Running};
+    std::atomic<bool> m_cancelRequested{false};
+    std::atomic<double> m_progress{0.0};
+
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_finishedCondition;
+    ToolpathGenerationPipeline::PipelineResult m_result;
+    bool m_resultTaken = false;
+    bool m_finished = false;    // Set once the completion callback has returned
 };
 
 } // namespace Toolpath
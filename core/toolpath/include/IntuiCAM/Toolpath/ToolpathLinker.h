@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <IntuiCAM/Toolpath/Types.h>
+
+namespace IntuiCAM {
+namespace Toolpath {
+
+/**
+ * @brief Re-routes the rapid links between cuts of a machining timeline
+ *
+ * Operations retract to their own fixed safe positions (raw diameter plus a
+ * margin, safetyHeight, clearanceDistance) between every pass. The linker
+ * walks the timeline in order while tracking the outer stock envelope left by
+ * the external cuts so far, and replaces each chain of rapids between two
+ * feed moves by the shortest route that stays @c clearance above that
+ * envelope: along the operation's own departure direction up to the
+ * clearance height, one traverse, and down the original arrival direction.
+ * A chain is only replaced when the new route is shorter.
+ *
+ * Rapids before the first and after the last cut of a toolpath are kept,
+ * since every toolpath starts with a tool change. Internal operations are
+ * left untouched and do not change the outer envelope.
+ */
+class ToolpathLinker {
+public:
+    struct Parameters {
+        double stockRadius = 10.0;   // mm - raw stock radius
+        double stockFrontZ = 50.0;   // mm - axial position of the raw stock face
+        double stockBackZ = 0.0;     // mm - axial position at the chuck; never crossed
+        double clearance = 2.0;      // mm - kept above the remaining stock
+        double binWidth = 0.25;      // mm - axial resolution of the stock envelope
+    };
+
+    struct Report {
+        size_t linksRerouted = 0;
+        size_t rapidsRemoved = 0;
+        double timeBefore = 0.0;     // minutes, from Toolpath::estimateMachiningTime
+        double timeAfter = 0.0;
+
+        double timeSaved() const { return timeBefore - timeAfter; }
+    };
+
+    ToolpathLinker() = default;
+    explicit ToolpathLinker(const Parameters& params) : params_(params) {}
+
+    /**
+     * @brief Re-link every toolpath of @p timeline in place
+     *
+     * Toolpaths that change are replaced by rebuilt copies; the order of the
+     * timeline and every cutting move are preserved.
+     */
+    Report link(std::vector<std::unique_ptr<Toolpath>>& timeline) const;
+
+private:
+    /**
+     * Largest remaining stock radius per axial bin, from stockBackZ to
+     * stockFrontZ. Cutting moves only ever lower it.
+     */
+    class StockEnvelope {
+    public:
+        explicit StockEnvelope(const Parameters& params);
+
+        // Highest stock radius over axial range [x0, x1]; infinite behind the stock
+        double maxRadius(double x0, double x1) const;
+
+        void recordCut(const Movement& move);
+
+    private:
+        // Lower every bin lying fully inside [x0, x1] to @p radius
+        void lowerBins(double x0, double x1, double radius);
+
+        Parameters params_;
+        std::vector<double> radius_;
+    };
+
+    std::unique_ptr<Toolpath> linkToolpath(const Toolpath& toolpath, StockEnvelope& envelope,
+                                           Report& report) const;
+
+    Parameters params_;
+};
+
+} // namespace Toolpath
+} // namespace IntuiCAM
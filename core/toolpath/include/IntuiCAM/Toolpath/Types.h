@@ -3,6 +3,10 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
 #include <IntuiCAM/Geometry/Types.h>
 #include <IntuiCAM/Common/Types.h>
 
@@ -86,8 +90,9 @@ public:
     void setLength(double length) { geometry_.length = length; }
 };
 
-// Movement types for toolpath generation
-enum class MovementType {
+// Movement types for toolpath generation (fixed width so the raw type column
+// can be shared with bindings as a plain int32 array)
+enum class MovementType : std::int32_t {
     Rapid,          // G0 - rapid positioning
     Linear,         // G1 - linear interpolation
     CircularCW,     // G2 - circular interpolation clockwise
@@ -96,6 +101,12 @@ enum class MovementType {
     ToolChange      // Tool change operation
 };
 
+// How the feed rate of a move is given
+enum class FeedMode : std::int32_t {
+    PerMinute,      // G94 - mm/min
+    PerRevolution   // G95 - mm per spindle revolution
+};
+
 // Additional enum for display compatibility
 enum class MoveType {
     Rapid,          // G0 - rapid positioning
@@ -115,8 +126,11 @@ struct Movement {
     Geometry::Point3D position;
     Geometry::Point3D startPoint;  // Starting position of movement
     Geometry::Point3D endPoint;    // Ending position of movement
-    double feedRate = 0.0;
-    double spindleSpeed = 0.0;
+    Geometry::Point3D center;      // Arc center (CircularCW/CircularCCW only)
+    double feedRate = 0.0;         // in feedMode units; seconds for Dwell
+    double spindleSpeed = 0.0;     // RPM; the G50 clamp when surfaceSpeed is set
+    double surfaceSpeed = 0.0;     // m/min, > 0 for constant surface speed (G96)
+    FeedMode feedMode = FeedMode::PerMinute;
     std::string comment;
     
     // Operation context for color coding
@@ -134,13 +148,134 @@ struct Movement {
         : type(t), position(end), startPoint(start), endPoint(end), operationType(opType) {}
 };
 
+/**
+ * @brief One move read from a MovementView
+ *
+ * Same fields as Movement, but comment and operationName view the toolpath's
+ * interned strings instead of copying them, so they share the view's lifetime.
+ * Converts to a Movement, copying the strings, where one is needed.
+ */
+struct MovementRecord {
+    MovementType type;
+    Geometry::Point3D position;
+    Geometry::Point3D startPoint;
+    Geometry::Point3D endPoint;
+    Geometry::Point3D center;
+    double feedRate = 0.0;
+    double spindleSpeed = 0.0;
+    double surfaceSpeed = 0.0;
+    FeedMode feedMode = FeedMode::PerMinute;
+    std::string_view comment;
+    OperationType operationType = OperationType::Unknown;
+    std::string_view operationName;
+    int passNumber = 0;
+    
+    operator Movement() const;
+};
+
+/**
+ * @brief Read-only view over the compact movement store of a Toolpath
+ *
+ * Indexing or iterating yields MovementRecord values built on the fly; they
+ * convert to Movement, so code written against std::vector<Movement> keeps
+ * working. Hot loops should prefer the per-field accessors (type(),
+ * position(), feedRate(), ...), which read the underlying arrays directly.
+ * A view is invalidated by any modification of its toolpath.
+ */
+class MovementView {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = MovementRecord;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = MovementRecord;
+
+        const_iterator(const Toolpath* toolpath, size_t index) : toolpath_(toolpath), index_(index) {}
+
+        MovementRecord operator*() const;
+        const_iterator& operator++() { ++index_; return *this; }
+        const_iterator operator++(int) { const_iterator tmp = *this; ++index_; return tmp; }
+        bool operator==(const const_iterator& other) const { return index_ == other.index_ && toolpath_ == other.toolpath_; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+        size_t index() const { return index_; }
+
+    private:
+        const Toolpath* toolpath_;
+        size_t index_;
+    };
+
+    explicit MovementView(const Toolpath* toolpath) : toolpath_(toolpath) {}
+
+    size_t size() const;
+    bool empty() const { return size() == 0; }
+
+    MovementRecord operator[](size_t index) const;
+    MovementRecord front() const { return (*this)[0]; }
+    MovementRecord back() const { return (*this)[size() - 1]; }
+
+    const_iterator begin() const { return const_iterator(toolpath_, 0); }
+    const_iterator end() const { return const_iterator(toolpath_, size()); }
+
+    // Field accessors that avoid materializing a full Movement
+    MovementType type(size_t index) const;
+    Geometry::Point3D position(size_t index) const;
+    Geometry::Point3D startPoint(size_t index) const;
+    Geometry::Point3D arcCenter(size_t index) const;  // end position for non-circular moves
+    double feedRate(size_t index) const;
+    double spindleSpeed(size_t index) const;
+    double surfaceSpeed(size_t index) const;
+    FeedMode feedMode(size_t index) const;
+    OperationType operationType(size_t index) const;
+    const std::string& comment(size_t index) const;
+    const std::string& operationName(size_t index) const;
+
+    // Copy out into a plain vector (e.g. for bindings)
+    std::vector<Movement> toVector() const;
+
+private:
+    const Toolpath* toolpath_;
+};
+
 // Sequence of movements with types and parameters
 class Toolpath {
 private:
-    std::vector<Movement> movements_;
+    // Compact structure-of-arrays movement store. The start point of a move is
+    // implicitly the end point of the previous one; only moves that break this
+    // rule (added through addMovement) keep an explicit start point. Arc centers
+    // are kept the same way, for circular moves only. Comments and operation
+    // names are interned per toolpath, id 0 being the empty string.
+    std::vector<double> posX_;
+    std::vector<double> posY_;
+    std::vector<double> posZ_;
+    std::vector<double> feedRates_;
+    std::vector<double> spindleSpeeds_;
+    std::vector<double> surfaceSpeeds_;
+    std::vector<FeedMode> feedModes_;
+    std::vector<MovementType> types_;
+    std::vector<OperationType> operationTypes_;
+    std::vector<std::int32_t> passNumbers_;
+    std::vector<std::uint32_t> commentIds_;
+    std::vector<std::uint32_t> operationNameIds_;
+    std::vector<std::pair<std::uint32_t, Geometry::Point3D>> explicitStarts_;  // sorted by move index
+    std::vector<std::pair<std::uint32_t, Geometry::Point3D>> arcCenters_;      // sorted by move index
+    std::vector<std::string> strings_{std::string()};
+    std::unordered_map<std::string, std::uint32_t> stringIds_;
+
     std::shared_ptr<Tool> tool_;
     std::string name_;
     OperationType operationType_;
+
+    friend class MovementView;
+
+    std::uint32_t internString(const std::string& value);
+    Geometry::Point3D lastPosition() const;
+    void appendMove(MovementType type, const Geometry::Point3D& position, double feedRate,
+                    OperationType opType, const std::string& opName = "", const std::string& comment = "");
+    void eraseMoves(const std::vector<char>& drop);
+    void removeZeroLengthExcursions();
+    void compressFeedChains(double tolerance);
     
 public:
     Toolpath(const std::string& name, std::shared_ptr<Tool> tool, OperationType opType = OperationType::Unknown);
@@ -160,30 +295,71 @@ public:
     void addCircularMove(const Geometry::Point3D& position, const Geometry::Point3D& center, 
                         bool clockwise, double feedRate, OperationType opType, const std::string& opName = "");
     
+    // Reserve storage for an expected number of movements
+    void reserve(size_t movementCount);
+    
     // Getters
-    const std::vector<Movement>& getMovements() const { return movements_; }
-    const std::vector<Movement>& getMoves() const { return movements_; } // Alias for compatibility
+    MovementView getMovements() const { return MovementView(this); }
+    MovementView getMoves() const { return MovementView(this); } // Alias for compatibility
     std::shared_ptr<Tool> getTool() const { return tool_; }
     const std::string& getName() const { return name_; }
     OperationType getOperationType() const { return operationType_; }
     
+    // Raw movement columns, one entry per move. Contiguous and index-aligned with
+    // getMovements(); invalidated by any modification, like a MovementView.
+    const std::vector<double>& getPositionsX() const { return posX_; }
+    const std::vector<double>& getPositionsY() const { return posY_; }
+    const std::vector<double>& getPositionsZ() const { return posZ_; }
+    const std::vector<double>& getFeedRates() const { return feedRates_; }
+    const std::vector<double>& getSpindleSpeeds() const { return spindleSpeeds_; }
+    const std::vector<double>& getSurfaceSpeeds() const { return surfaceSpeeds_; }
+    const std::vector<FeedMode>& getFeedModes() const { return feedModes_; }
+    const std::vector<MovementType>& getMovementTypes() const { return types_; }
+    const std::vector<std::int32_t>& getPassNumbers() const { return passNumbers_; }
+    
     // Setters
     void setOperationType(OperationType opType) { operationType_ = opType; }
     
+    // Replace the feed and spindle data of one move, e.g. from a feed and speed
+    // planner. @p spindleSpeed is the G50 clamp when @p surfaceSpeed is set.
+    void setCuttingConditions(size_t index, double feedRate, FeedMode feedMode,
+                              double spindleSpeed, double surfaceSpeed = 0.0);
+    
     // Analysis
-    size_t getMovementCount() const { return movements_.size(); }
-    size_t getPointCount() const { return movements_.size(); }
+    size_t getMovementCount() const { return types_.size(); }
+    size_t getPointCount() const { return types_.size(); }
     double estimateMachiningTime() const;
     Geometry::BoundingBox getBoundingBox() const;
     
     // Optimization
-    void optimizeToolpath();
+    // Drops redundant moves and zero-length retract/re-approach loops, then
+    // merges runs of linear feed moves into single lines or arcs that stay
+    // within @p tolerance (mm) of the original chain. Linear in the move count.
+    void optimizeToolpath(double tolerance = 0.002);
     void removeRedundantMoves();
     
     // Apply a 4x4 transform to every movement (e.g., part positioning in world space)
     void applyTransform(const Geometry::Matrix4x4& mat);
 };
 
+inline size_t MovementView::size() const { return toolpath_->types_.size(); }
+inline MovementType MovementView::type(size_t index) const { return toolpath_->types_[index]; }
+inline double MovementView::feedRate(size_t index) const { return toolpath_->feedRates_[index]; }
+inline double MovementView::spindleSpeed(size_t index) const { return toolpath_->spindleSpeeds_[index]; }
+inline double MovementView::surfaceSpeed(size_t index) const { return toolpath_->surfaceSpeeds_[index]; }
+inline FeedMode MovementView::feedMode(size_t index) const { return toolpath_->feedModes_[index]; }
+inline OperationType MovementView::operationType(size_t index) const { return toolpath_->operationTypes_[index]; }
+inline const std::string& MovementView::comment(size_t index) const { return toolpath_->strings_[toolpath_->commentIds_[index]]; }
+inline const std::string& MovementView::operationName(size_t index) const { return toolpath_->strings_[toolpath_->operationNameIds_[index]]; }
+
+inline Geometry::Point3D MovementView::position(size_t index) const {
+    return Geometry::Point3D(toolpath_->posX_[index], toolpath_->posY_[index], toolpath_->posZ_[index]);
+}
+
+inline MovementRecord MovementView::const_iterator::operator*() const {
+    return MovementView(toolpath_)[index_];
+}
+
 // Base class for machining operations
 class Operation {
 public:
@@ -219,6 +395,31 @@ public:
                                                      std::shared_ptr<Tool> tool);
 };
 
+/**
+ * @brief Signed sweep of an arc from @p start to @p end about @p center
+ *
+ * Positions use the toolpath convention (x axial, z radial). Clockwise is as
+ * seen on the usual lathe drawing, axial to the right and radius up, which is
+ * also the sense of G2. The result is negative for clockwise arcs and lies in
+ * (-2*pi, 0] or [0, 2*pi); coincident end points give a full circle.
+ */
+double arcSweepAngle(const Geometry::Point3D& start, const Geometry::Point3D& end,
+                     const Geometry::Point3D& center, bool clockwise);
+
+/**
+ * @brief Path length of move @p index: arc length for circular moves, else the chord
+ */
+double movementLength(const MovementView& moves, size_t index);
+
+/**
+ * @brief Spindle speed in RPM at @p radius (mm) for move @p index
+ *
+ * Constant surface speed moves give 1000 * surfaceSpeed / (2 * pi * radius),
+ * held to their spindleSpeed clamp when one is set; other moves give their
+ * spindleSpeed. Returns 0 when the move carries no spindle information.
+ */
+double spindleSpeedAt(const MovementView& moves, size_t index, double radius);
+
 // Utility functions for operation type mapping
 std::string operationTypeToString(OperationType type);
 OperationType stringToOperationType(const std::string& str);
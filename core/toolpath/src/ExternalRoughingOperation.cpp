@@ -209,11 +209,14 @@ std::unique_ptr<Toolpath> ExternalRoughingOperation::generateProfileFollowingRou
     int passCount = 0;
     bool reverse = false;
     
+    // Index the profile once; each pass then only visits the segments it crosses
+    const ProfileIndex profileIndex(profile);
+    
     while (currentRadius > targetRadius && passCount < 100) { // Safety limit
         double nextRadius = std::max(targetRadius, currentRadius - params_.stepover);
         
         // Generate profile-following pass at current radius
-        generateProfileFollowingPass(toolpath.get(), profile, nextRadius, reverse);
+        generateProfileFollowingPass(toolpath.get(), profileIndex, nextRadius, reverse);
         
         currentRadius = nextRadius;
         passCount++;
@@ -237,35 +240,16 @@ std::unique_ptr<Toolpath> ExternalRoughingOperation::generateProfileFollowingRou
 }
 
 void ExternalRoughingOperation::generateProfileFollowingPass(Toolpath* toolpath, 
-                                                           const LatheProfile::Profile2D& profile, 
+                                                           const ProfileIndex& profileIndex, 
                                                            double targetRadius, 
                                                            bool reverse) {
     
-    // Find profile points/segments at target radius with stock allowance
+    // Find profile crossings at target radius, already sorted by Z
     std::vector<std::pair<double, double>> cuttingPoints; // (z, radius) pairs
-    
-    // Interpolate cutting points from profile segments
-    for (const auto& segment : profile.segments) {
-        // Check if this segment intersects our target radius
-        double segmentMinRadius = std::min(segment.start.x, segment.end.x);
-        double segmentMaxRadius = std::max(segment.start.x, segment.end.x);
-        
-        if (targetRadius >= segmentMinRadius && targetRadius <= segmentMaxRadius) {
-            // Linear interpolation to find Z position at target radius
-            double t = (targetRadius - segment.start.x) / (segment.end.x - segment.start.x);
-            if (std::abs(segment.end.x - segment.start.x) < 1e-6) {
-                t = 0.0; // Vertical segment
-            }
-            t = std::max(0.0, std::min(1.0, t)); // Clamp to [0,1]
-            
-            double z = segment.start.z + t * (segment.end.z - segment.start.z);
-            cuttingPoints.push_back({z, targetRadius});
-        }
+    for (double z : profileIndex.zCrossingsAtRadius(targetRadius)) {
+        cuttingPoints.push_back({z, targetRadius});
     }
     
-    // Sort cutting points by Z coordinate
-    std::sort(cuttingPoints.begin(), cuttingPoints.end());
-    
     if (cuttingPoints.empty()) {
         // No intersection found, use straight cut between start and end Z
         cuttingPoints.push_back({params_.startZ, targetRadius});
@@ -0,0 +1,118 @@
+#include <IntuiCAM/Toolpath/FeedSpeedPlanner.h>
+
+#include <algorithm>
+
+namespace IntuiCAM {
+namespace Toolpath {
+
+namespace {
+
+// Cutting speed and chip load relative to the material's recommendation
+struct Conditions {
+    bool planned = false;
+    double speedFactor = 1.0;
+    double feedFactor = 1.0;
+};
+
+Conditions conditionsFor(OperationType type) {
+    switch (type) {
+        case OperationType::Facing:
+        case OperationType::ExternalRoughing:
+        case OperationType::InternalRoughing:
+        case OperationType::Boring:
+            return {true, 1.0, 1.0};
+        case OperationType::ExternalFinishing:
+        case OperationType::InternalFinishing:
+        case OperationType::Chamfering:
+            // Faster and lighter for surface finish
+            return {true, 1.25, 0.5};
+        case OperationType::ExternalGrooving:
+        case OperationType::InternalGrooving:
+        case OperationType::Parting:
+            // Full-width tools chatter and pack chips
+            return {true, 0.7, 0.4};
+        default:
+            return {};
+    }
+}
+
+bool isFeedMove(MovementType type) {
+    return type == MovementType::Linear || type == MovementType::CircularCW ||
+           type == MovementType::CircularCCW;
+}
+
+} // namespace
+
+FeedSpeedPlanner::Report FeedSpeedPlanner::plan(std::vector<std::unique_ptr<Toolpath>>& timeline) const {
+    Report report;
+    for (auto& toolpath : timeline) {
+        if (!toolpath) {
+            continue;
+        }
+        report.timeBefore += toolpath->estimateMachiningTime();
+        const size_t planned = plan(*toolpath);
+        if (planned > 0) {
+            ++report.toolpathsPlanned;
+            report.movesPlanned += planned;
+        }
+        report.timeAfter += toolpath->estimateMachiningTime();
+    }
+    return report;
+}
+
+size_t FeedSpeedPlanner::plan(Toolpath& toolpath) const {
+    const MovementView moves = toolpath.getMovements();
+    const size_t count = moves.size();
+
+    // The pipeline labels whole toolpaths; operations may leave moves unlabelled
+    auto kindOf = [&](size_t index) {
+        return toolpath.getOperationType() != OperationType::Unknown
+            ? toolpath.getOperationType() : moves.operationType(index);
+    };
+    auto plannable = [&](size_t index) {
+        return conditionsFor(kindOf(index)).planned && moves.surfaceSpeed(index) <= 0.0 &&
+               moves.feedMode(index) == FeedMode::PerMinute;
+    };
+
+    // The operation's nominal feed; slower moves keep their share of it
+    double nominalFeed = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        if (isFeedMove(moves.type(i)) && plannable(i)) {
+            nominalFeed = std::max(nominalFeed, moves.feedRate(i));
+        }
+    }
+    if (nominalFeed <= 0.0) {
+        return 0;
+    }
+
+    const double cuttingSpeed = OperationParameterManager::recommendedCuttingSpeed(params_.material);
+    const double chipLoad = OperationParameterManager::recommendedFeedPerRevolution(params_.material);
+
+    size_t planned = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const MovementType type = moves.type(i);
+        if ((type != MovementType::Rapid && !isFeedMove(type)) || !plannable(i)) {
+            continue;
+        }
+
+        const Conditions conditions = conditionsFor(kindOf(i));
+        const double surfaceSpeed = cuttingSpeed * conditions.speedFactor;
+        if (type == MovementType::Rapid) {
+            // Rapids stay under G96 so the spindle is not switched between passes
+            toolpath.setCuttingConditions(i, moves.feedRate(i), FeedMode::PerMinute,
+                                          params_.maxSpindleSpeed, surfaceSpeed);
+        } else {
+            if (moves.feedRate(i) <= 0.0) {
+                continue;
+            }
+            const double share = std::min(1.0, moves.feedRate(i) / nominalFeed);
+            toolpath.setCuttingConditions(i, chipLoad * conditions.feedFactor * share,
+                                          FeedMode::PerRevolution, params_.maxSpindleSpeed, surfaceSpeed);
+        }
+        ++planned;
+    }
+    return planned;
+}
+
+} // namespace Toolpath
+} // namespace IntuiCAM
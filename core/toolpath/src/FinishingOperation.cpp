@@ -182,8 +182,7 @@ std::unique_ptr<Toolpath> FinishingOperation::generateSinglePassFinishing(const
         double spindleSpeed = calculateSpindleSpeed(point.x * 2.0); // Convert radius to diameter
         
         // Add finishing move with optimized parameters
-        Geometry::Point3D toolpathPoint(point.z, 0.0, point.x);
-        addFinishingMove(toolpath.get(), toolpathPoint, feedRate * 60.0); // Convert mm/rev to mm/min
+        addFinishingMove(toolpath.get(), point, 0.0, feedRate * 60.0); // Convert mm/rev to mm/min
         
         // Add dwell at sharp corners if enabled
         if (params_.enableDwells && i > 0 && i < optimizedProfile.size() - 1) {
@@ -250,18 +249,14 @@ std::unique_ptr<Toolpath> FinishingOperation::generateMultiPassFinishing(const L
         for (size_t i = 0; i < optimizedProfile.size(); ++i) {
             const auto& point = optimizedProfile[i];
             
-            // Offset profile by current stock allowance
-            double finishRadius = point.x - currentStockAllowance;
-            
             // Calculate adaptive feed rate if enabled
             double feedRate = currentFeedRate;
             if (params_.adaptiveFeedRate && i < optimizedProfile.size() - 1) {
                 feedRate = calculateAdaptiveFeedRate(point, optimizedProfile[i + 1]) * (1.0 - passRatio * 0.3);
             }
             
-            // Add finishing move
-            Geometry::Point3D toolpathPoint(point.z, 0.0, finishRadius);
-            addFinishingMove(toolpath.get(), toolpathPoint, feedRate * 60.0);
+            // Add finishing move, offset by current stock allowance
+            addFinishingMove(toolpath.get(), point, currentStockAllowance, feedRate * 60.0);
         }
         
         // Add retract move
@@ -312,12 +307,8 @@ std::unique_ptr<Toolpath> FinishingOperation::generateSpringPassFinishing(const
         // Use spring pass feed rate (typically slower)
         double feedRate = params_.springPassFeedRate;
         
-        // Calculate final radius
-        double finalRadius = point.x - params_.finalStockAllowance;
-        
-        // Add spring pass move
-        Geometry::Point3D toolpathPoint(point.z, 0.0, finalRadius);
-        addFinishingMove(toolpath.get(), toolpathPoint, feedRate * 60.0);
+        // Add spring pass move at final radius
+        addFinishingMove(toolpath.get(), point, params_.finalStockAllowance, feedRate * 60.0);
         
         // Add dwells at critical points for surface finish
         if (params_.enableDwells && i % 10 == 0) { // Every 10th point
@@ -335,11 +326,25 @@ std::unique_ptr<Toolpath> FinishingOperation::generateSpringPassFinishing(const
     return toolpath;
 }
 
-std::vector<IntuiCAM::Geometry::Point2D> FinishingOperation::optimizeProfileForFinishing(const LatheProfile::Profile2D& profile) {
-    std::vector<IntuiCAM::Geometry::Point2D> optimizedProfile;
+std::vector<FinishingOperation::FinishingPoint> FinishingOperation::optimizeProfileForFinishing(const LatheProfile::Profile2D& profile) {
+    std::vector<FinishingPoint> optimizedProfile;
     
     // Convert profile segments to points with high resolution for finishing
     for (const auto& segment : profile.segments) {
+        if (segment.isArc) {
+            // Keep arcs exact, oriented in travel direction (towards -Z)
+            const bool forward = segment.start.z >= segment.end.z;
+            FinishingPoint arcEnd(forward ? segment.end : segment.start);
+            arcEnd.arcFromPrevious = true;
+            arcEnd.arcStart = forward ? segment.start : segment.end;
+            arcEnd.arcCenter = segment.center;
+            arcEnd.arcClockwise = forward ? segment.clockwise : !segment.clockwise;
+            
+            optimizedProfile.push_back(arcEnd.arcStart);
+            optimizedProfile.push_back(arcEnd);
+            continue;
+        }
+        
         optimizedProfile.push_back(segment.start);
         
         // Add intermediate points for curved segments
@@ -358,14 +363,26 @@ std::vector<IntuiCAM::Geometry::Point2D> FinishingOperation::optimizeProfileForF
         optimizedProfile.push_back(segment.end);
     }
     
-    // Remove duplicate points
-    optimizedProfile.erase(std::unique(optimizedProfile.begin(), optimizedProfile.end(),
-        [](const auto& a, const auto& b) {
-            return std::abs(a.x - b.x) < 1e-6 && std::abs(a.z - b.z) < 1e-6;
-        }), optimizedProfile.end());
+    auto samePoint = [](const IntuiCAM::Geometry::Point2D& a, const IntuiCAM::Geometry::Point2D& b) {
+        return std::abs(a.x - b.x) < 1e-6 && std::abs(a.z - b.z) < 1e-6;
+    };
+    
+    // Remove duplicate points, keeping arc data of either copy
+    std::vector<FinishingPoint> merged;
+    merged.reserve(optimizedProfile.size());
+    for (const auto& point : optimizedProfile) {
+        if (!merged.empty() && samePoint(merged.back(), point)) {
+            if (point.arcFromPrevious && !merged.back().arcFromPrevious) {
+                merged.back() = point;
+            }
+            continue;
+        }
+        merged.push_back(point);
+    }
+    optimizedProfile = std::move(merged);
     
     // Sort by Z coordinate
-    std::sort(optimizedProfile.begin(), optimizedProfile.end(),
+    std::stable_sort(optimizedProfile.begin(), optimizedProfile.end(),
         [](const auto& a, const auto& b) {
             return a.z > b.z; // Start from larger Z (towards chuck)
         });
@@ -376,6 +393,14 @@ std::vector<IntuiCAM::Geometry::Point2D> FinishingOperation::optimizeProfileForF
             return point.z > params_.startZ || point.z < params_.endZ;
         }), optimizedProfile.end());
     
+    // An arc is only cut as such when its start still directly precedes it
+    for (size_t i = 0; i < optimizedProfile.size(); ++i) {
+        auto& point = optimizedProfile[i];
+        if (point.arcFromPrevious && (i == 0 || !samePoint(optimizedProfile[i - 1], point.arcStart))) {
+            point.arcFromPrevious = false;
+        }
+    }
+    
     return optimizedProfile;
 }
 
@@ -413,8 +438,17 @@ double FinishingOperation::calculateAdaptiveFeedRate(const IntuiCAM::Geometry::P
     return params_.feedRate * adaptiveFactor;
 }
 
-void FinishingOperation::addFinishingMove(Toolpath* toolpath, const IntuiCAM::Geometry::Point3D& point, double feedRate) {
-    toolpath->addLinearMove(point, feedRate, OperationType::ExternalFinishing, "Finishing cut");
+void FinishingOperation::addFinishingMove(Toolpath* toolpath, const FinishingPoint& point,
+                                          double stockAllowance, double feedRate) {
+    // Stock allowance shifts the profile radially, arcs and their centers alike
+    Geometry::Point3D target(point.z, 0.0, point.x - stockAllowance);
+    if (point.arcFromPrevious) {
+        Geometry::Point3D center(point.arcCenter.z, 0.0, point.arcCenter.x - stockAllowance);
+        toolpath->addCircularMove(target, center, point.arcClockwise, feedRate,
+                                  OperationType::ExternalFinishing, "Finishing cut");
+        return;
+    }
+    toolpath->addLinearMove(target, feedRate, OperationType::ExternalFinishing, "Finishing cut");
 }
 
 void FinishingOperation::addApproachMove(Toolpath* toolpath, const IntuiCAM::Geometry::Point3D& startPoint) {
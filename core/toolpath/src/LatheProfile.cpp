@@ -1,9 +1,14 @@
+#define _USE_MATH_DEFINES
 #include "IntuiCAM/Toolpath/LatheProfile.h"
+#include "IntuiCAM/Toolpath/ProfileCache.h"
+#include <IntuiCAM/Common/Trace.h>
+#include <IntuiCAM/Common/Types.h>
 
 #include <BRepAlgoAPI_Section.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
 #include <BRepAdaptor_Curve.hxx>
+#include <gp_Circ.hxx>
 #include <BRep_Tool.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -18,8 +23,12 @@
 #include <TopTools_ListOfShape.hxx>
 
 #include <algorithm>
-#include <iostream>
 #include <cmath>
+#include <string>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
 
 namespace IntuiCAM {
 namespace Toolpath {
@@ -31,16 +40,22 @@ namespace Toolpath {
 LatheProfile::Profile2D LatheProfile::extractSegmentProfile(const TopoDS_Shape& partGeometry,
                                                            const gp_Ax1& turningAxis,
                                                            double tolerance) {
+    TRACE_SPAN("profile", "LatheProfile::extractSegmentProfile");
     Profile2D profile;
     
+    // Sectioning is expensive; every consumer of the same part and pose shares one result
+    if (ProfileCache::instance().lookup(partGeometry, turningAxis, tolerance, profile)) {
+        return profile;
+    }
+    
     try {
-        std::cout << "LatheProfile: Starting segment-based profile extraction..." << std::endl;
+        LOG_DEBUG("LatheProfile: Starting segment-based profile extraction...");
         
         // Step 1: Create section plane through XZ-plane centered on turning axis
         TopoDS_Shape section = createSectionPlane(partGeometry, turningAxis, tolerance);
         
         if (section.IsNull()) {
-            std::cout << "LatheProfile: Failed to create section plane" << std::endl;
+            LOG_WARNING("LatheProfile: Failed to create section plane");
             return profile;
         }
         
@@ -48,18 +63,23 @@ LatheProfile::Profile2D LatheProfile::extractSegmentProfile(const TopoDS_Shape&
         std::vector<TopoDS_Edge> profileEdges = extractProfileEdges(section, turningAxis);
         
         if (profileEdges.empty()) {
-            std::cout << "LatheProfile: No profile edges found in section" << std::endl;
+            LOG_WARNING("LatheProfile: No profile edges found in section");
             return profile;
         }
         
-        std::cout << "LatheProfile: Found " << profileEdges.size() << " profile edges" << std::endl;
+        LOG_DEBUG("LatheProfile: Found " + std::to_string(profileEdges.size()) + " profile edges");
+        TRACE_COUNTER("profile", "profile edges", profileEdges.size());
         
         // Step 3: Convert edges to profile segments
         std::vector<ProfileSegment> segments;
-        for (const auto& edge : profileEdges) {
-            ProfileSegment segment = convertEdgeToSegment(edge, turningAxis);
-            if (segment.length > tolerance) { // Filter out tiny segments
-                segments.push_back(segment);
+        {
+            TRACE_SPAN("profile", "LatheProfile::convertEdges");
+            segments.reserve(profileEdges.size());
+            for (const auto& edge : profileEdges) {
+                ProfileSegment segment = convertEdgeToSegment(edge, turningAxis);
+                if (segment.length > tolerance) { // Filter out tiny segments
+                    segments.push_back(segment);
+                }
             }
         }
         
@@ -68,11 +88,16 @@ LatheProfile::Profile2D LatheProfile::extractSegmentProfile(const TopoDS_Shape&
         
         profile.segments = std::move(segments);
         
-        std::cout << "LatheProfile: Successfully extracted " << profile.getSegmentCount() 
-                  << " segments with total length " << profile.getTotalLength() << std::endl;
+        // An empty result is a failed extraction; let the next call retry it
+        if (!profile.isEmpty()) {
+            ProfileCache::instance().store(partGeometry, turningAxis, tolerance, profile);
+        }
+        
+        LOG_DEBUG("LatheProfile: Successfully extracted " + std::to_string(profile.getSegmentCount()) +
+                  " segments with total length " + std::to_string(profile.getTotalLength()));
         
     } catch (const std::exception& e) {
-        std::cout << "LatheProfile: Exception during extraction: " << e.what() << std::endl;
+        LOG_ERROR("LatheProfile: Exception during extraction: " + std::string(e.what()));
     }
     
     return profile;
@@ -81,6 +106,7 @@ LatheProfile::Profile2D LatheProfile::extractSegmentProfile(const TopoDS_Shape&
 TopoDS_Shape LatheProfile::createSectionPlane(const TopoDS_Shape& partGeometry,
                                              const gp_Ax1& turningAxis,
                                              double tolerance) {
+    TRACE_SPAN("profile", "LatheProfile::createSectionPlane");
     try {
         // Create XZ-plane passing through the turning axis origin
         // The plane normal should be perpendicular to the XZ-plane (i.e., in Y direction)
@@ -125,26 +151,30 @@ TopoDS_Shape LatheProfile::createSectionPlane(const TopoDS_Shape& partGeometry,
         sectionOp.SetTools(tools);
         sectionOp.SetFuzzyValue(tolerance);
         
-        sectionOp.Build();
+        {
+            TRACE_SPAN("occt", "BRepAlgoAPI_Section::Build");
+            sectionOp.Build();
+        }
         
         if (!sectionOp.IsDone() || sectionOp.HasErrors()) {
-            std::cout << "LatheProfile: Section operation failed" << std::endl;
+            LOG_WARNING("LatheProfile: Section operation failed");
             return TopoDS_Shape();
         }
         
         TopoDS_Shape result = sectionOp.Shape();
-        std::cout << "LatheProfile: Section operation completed successfully" << std::endl;
+        LOG_DEBUG("LatheProfile: Section operation completed successfully");
         
         return result;
         
     } catch (const std::exception& e) {
-        std::cout << "LatheProfile: Exception in createSectionPlane: " << e.what() << std::endl;
+        LOG_ERROR("LatheProfile: Exception in createSectionPlane: " + std::string(e.what()));
         return TopoDS_Shape();
     }
 }
 
 std::vector<TopoDS_Edge> LatheProfile::extractProfileEdges(const TopoDS_Shape& section,
                                                           const gp_Ax1& turningAxis) {
+    TRACE_SPAN("profile", "LatheProfile::extractProfileEdges");
     std::vector<TopoDS_Edge> profileEdges;
     
     try {
@@ -168,10 +198,11 @@ std::vector<TopoDS_Edge> LatheProfile::extractProfileEdges(const TopoDS_Shape& s
             }
         }
         
-        std::cout << "LatheProfile: Extracted " << profileEdges.size() << " profile edges after Z-axis processing" << std::endl;
+        LOG_DEBUG("LatheProfile: Extracted " + std::to_string(profileEdges.size()) +
+                  " profile edges after Z-axis processing");
         
     } catch (const std::exception& e) {
-        std::cout << "LatheProfile: Exception in extractProfileEdges: " << e.what() << std::endl;
+        LOG_ERROR("LatheProfile: Exception in extractProfileEdges: " + std::string(e.what()));
     }
     
     return profileEdges;
@@ -227,16 +258,16 @@ std::vector<TopoDS_Edge> LatheProfile::splitEdgeAtZAxis(const TopoDS_Edge& edge,
         // Case 1: Both endpoints in positive X - keep entire edge
         if (startX > tolerance && endX > tolerance) {
             result.push_back(edge);
-            std::cout << "LatheProfile: Edge entirely in positive X, keeping whole edge" << std::endl;
+            LOG_DEBUG("LatheProfile: Edge entirely in positive X, keeping whole edge");
         }
         // Case 2: Both endpoints in negative X - discard entire edge
         else if (startX < -tolerance && endX < -tolerance) {
-            std::cout << "LatheProfile: Edge entirely in negative X, discarding" << std::endl;
+            LOG_DEBUG("LatheProfile: Edge entirely in negative X, discarding");
             // Don't add anything to result
         }
         // Case 3: Edge crosses Z-axis - need to split
         else {
-            std::cout << "LatheProfile: Edge crosses Z-axis, attempting to split" << std::endl;
+            LOG_DEBUG("LatheProfile: Edge crosses Z-axis, attempting to split");
             
             // Try to find intersection with Z-axis and split the edge
             TopoDS_Edge splitEdge = splitEdgeAtZAxisIntersection(edge, turningAxis, startX, endX);
@@ -246,7 +277,7 @@ std::vector<TopoDS_Edge> LatheProfile::splitEdgeAtZAxis(const TopoDS_Edge& edge,
         }
         
     } catch (const std::exception& e) {
-        std::cout << "LatheProfile: Exception in splitEdgeAtZAxis: " << e.what() << std::endl;
+        LOG_ERROR("LatheProfile: Exception in splitEdgeAtZAxis: " + std::string(e.what()));
     }
     
     return result;
@@ -286,16 +317,16 @@ TopoDS_Edge LatheProfile::splitEdgeAtZAxisIntersection(const TopoDS_Edge& edge,
             
             BRepBuilderAPI_MakeEdge edgeBuilder(trimmedCurve);
             if (edgeBuilder.IsDone()) {
-                std::cout << "LatheProfile: Successfully split edge at Z-axis" << std::endl;
+                LOG_DEBUG("LatheProfile: Successfully split edge at Z-axis");
                 return edgeBuilder.Edge();
             }
         }
         
-        std::cout << "LatheProfile: Could not split edge at Z-axis, keeping as-is" << std::endl;
+        LOG_DEBUG("LatheProfile: Could not split edge at Z-axis, keeping as-is");
         return edge; // Fallback: return original edge
         
     } catch (const std::exception& e) {
-        std::cout << "LatheProfile: Exception in splitEdgeAtZAxisIntersection: " << e.what() << std::endl;
+        LOG_ERROR("LatheProfile: Exception in splitEdgeAtZAxisIntersection: " + std::string(e.what()));
         return edge; // Fallback: return original edge
     }
 }
@@ -393,17 +424,73 @@ LatheProfile::ProfileSegment LatheProfile::convertEdgeToSegment(const TopoDS_Edg
         GeomAbs_CurveType curveType = curve.GetType();
         segment.isLinear = (curveType == GeomAbs_Line);
         
-        std::cout << "LatheProfile: Created segment - Start(" << segment.start.x << ", " << segment.start.z 
-                  << ") End(" << segment.end.x << ", " << segment.end.z << ") Length=" << segment.length 
-                  << " Linear=" << segment.isLinear << std::endl;
+        // Keep exact arc parameters for circles lying in the profile plane
+        // (circle normal perpendicular to the turning axis)
+        if (curveType == GeomAbs_Circle &&
+            std::abs(curve.Circle().Axis().Direction().Dot(axisDirection)) < Precision::Angular()) {
+            // Radial direction of the section half-plane, used to sign the
+            // center's radius when it lies across the axis
+            gp_Vec radial(projectedStart, startPnt3D);
+            if (radial.Magnitude() < Precision::Confusion()) {
+                radial = gp_Vec(projectedEnd, endPnt3D);
+            }
+            
+            if (radial.Magnitude() >= Precision::Confusion()) {
+                radial.Normalize();
+                auto toProfile = [&](const gp_Pnt& point) {
+                    gp_Vec toPoint(axisOrigin, point);
+                    return IntuiCAM::Geometry::Point2D{toPoint.Dot(radial), toPoint.Dot(gp_Vec(axisDirection))};
+                };
+                
+                const IntuiCAM::Geometry::Point2D mid =
+                    toProfile(curve.Value((curve.FirstParameter() + curve.LastParameter()) / 2.0));
+                
+                segment.isArc = true;
+                segment.center = toProfile(curve.Circle().Location());
+                segment.radius = curve.Circle().Radius();
+                
+                // Turn direction of start -> mid -> end with Z right and radius up
+                const double turn = (mid.z - segment.start.z) * (segment.end.x - mid.x) -
+                                    (mid.x - segment.start.x) * (segment.end.z - mid.z);
+                segment.clockwise = turn < 0.0;
+                segment.length = segment.radius * std::abs(segment.sweepAngle());
+            }
+        }
+        
+        LOG_DEBUG("LatheProfile: Created segment - Start(" + std::to_string(segment.start.x) + ", " +
+                  std::to_string(segment.start.z) + ") End(" + std::to_string(segment.end.x) + ", " +
+                  std::to_string(segment.end.z) + ") Length=" + std::to_string(segment.length) +
+                  " Linear=" + std::to_string(segment.isLinear));
         
     } catch (const std::exception& e) {
-        std::cout << "LatheProfile: Exception in convertEdgeToSegment: " << e.what() << std::endl;
+        LOG_ERROR("LatheProfile: Exception in convertEdgeToSegment: " + std::string(e.what()));
     }
     
     return segment;
 }
 
+double LatheProfile::ProfileSegment::sweepAngle() const {
+    if (!isArc) {
+        return 0.0;
+    }
+    
+    constexpr double twoPi = 2.0 * M_PI;
+    
+    // Angles with Z as the horizontal and radius as the vertical axis
+    const double startAngle = std::atan2(start.x - center.x, start.z - center.z);
+    const double endAngle = std::atan2(end.x - center.x, end.z - center.z);
+    double sweep = endAngle - startAngle;
+    
+    if (clockwise) {
+        while (sweep >= 0.0) sweep -= twoPi;
+        while (sweep <= -twoPi) sweep += twoPi;
+    } else {
+        while (sweep <= 0.0) sweep += twoPi;
+        while (sweep >= twoPi) sweep -= twoPi;
+    }
+    return sweep;
+}
+
 void LatheProfile::sortSegmentsByZ(std::vector<ProfileSegment>& segments) {
     // Sort segments by their average Z coordinate
     std::sort(segments.begin(), segments.end(), 
@@ -441,14 +528,19 @@ std::vector<IntuiCAM::Geometry::Point2D> LatheProfile::Profile2D::toPointArray(d
     for (const auto& segment : segments) {
         points.push_back(segment.start);
         
-        // For curved segments, we might want to add intermediate points
-        if (!segment.isLinear && segment.length > tolerance * 2) {
-            // Add midpoint for curved segments
-            IntuiCAM::Geometry::Point2D mid{
-                (segment.start.x + segment.end.x) / 2.0,
-                (segment.start.z + segment.end.z) / 2.0
-            };
-            points.push_back(mid);
+        // Sample arcs so that no chord deviates from the arc by more than tolerance
+        if (segment.isArc && segment.radius > tolerance) {
+            const double sweep = segment.sweepAngle();
+            const double maxStep = 2.0 * std::acos(1.0 - tolerance / segment.radius);
+            const int steps = static_cast<int>(std::ceil(std::abs(sweep) / maxStep));
+            const double startAngle = std::atan2(segment.start.x - segment.center.x,
+                                                 segment.start.z - segment.center.z);
+            for (int i = 1; i < steps; ++i) {
+                const double angle = startAngle + sweep * i / steps;
+                points.push_back(IntuiCAM::Geometry::Point2D{
+                    segment.center.x + segment.radius * std::sin(angle),
+                    segment.center.z + segment.radius * std::cos(angle)});
+            }
         }
         
         points.push_back(segment.end);
@@ -484,7 +576,7 @@ LatheProfile::SimpleProfile2D LatheProfile::extract(const IntuiCAM::Geometry::Pa
         profile.push_back(point);
     }
     
-    std::cout << "LatheProfile: Legacy extraction created " << profile.size() << " points" << std::endl;
+    LOG_DEBUG("LatheProfile: Legacy extraction created " + std::to_string(profile.size()) + " points");
     
     return profile;
 }
@@ -209,6 +209,14 @@ OperationParameterManager::getMaterialProperties(const std::string& materialType
     return s_materialDatabase.at("steel");
 }
 
+double OperationParameterManager::recommendedCuttingSpeed(const MaterialProperties& material) {
+    return 200.0 * material.machinabilityRating; // m/min
+}
+
+double OperationParameterManager::recommendedFeedPerRevolution(const MaterialProperties& material) {
+    return material.recommendedFeedRate * material.machinabilityRating; // mm/rev
+}
+
 OperationParameterManager::OperationConfig 
 OperationParameterManager::createDefaultConfiguration(
     const std::string& operationType,
@@ -233,7 +241,7 @@ OperationParameterManager::calculateOptimalParameters(
     OperationConfig config = createDefaultConfiguration(operationType, material, tool);
     
     // Calculate optimal cutting speed
-    double optimalCuttingSpeed = 200.0 * material.machinabilityRating; // m/min
+    double optimalCuttingSpeed = recommendedCuttingSpeed(material); // m/min
     double optimalSpindleSpeed = (optimalCuttingSpeed * 1000.0) / (M_PI * partDiameter);
     
     // Clamp to reasonable limits
@@ -242,7 +250,7 @@ OperationParameterManager::calculateOptimalParameters(
     config.setNumeric("spindleSpeed", optimalSpindleSpeed);
     
     // Adjust feed rate based on material
-    double optimalFeedRate = material.recommendedFeedRate * material.machinabilityRating;
+    double optimalFeedRate = recommendedFeedPerRevolution(material);
     config.setNumeric("feedRate", optimalFeedRate);
     
     // Adjust depth of cut based on operation and material
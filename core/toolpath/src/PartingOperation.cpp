@@ -143,6 +143,14 @@ std::vector<PartingOperation::PartingPosition> PartingOperation::detectPartingPo
         return positions; // Not enough points for analysis
     }
     
+    // Smallest radius from each point to the end of the part, so the
+    // accessibility check below is a lookup instead of a scan
+    std::vector<double> minRadiusFrom(points.size());
+    minRadiusFrom.back() = points.back().x;
+    for (size_t j = points.size() - 1; j-- > 0;) {
+        minRadiusFrom[j] = std::min(points[j].x, minRadiusFrom[j + 1]);
+    }
+    
     // Analyze profile for potential parting positions
     for (size_t i = 1; i < points.size() - 1; ++i) {
         const auto& prevPoint = points[i-1];
@@ -192,13 +200,7 @@ std::vector<PartingOperation::PartingPosition> PartingOperation::detectPartingPo
         }
         
         // Consider accessibility (avoid internal features)
-        bool isAccessible = true;
-        for (size_t j = i; j < points.size(); ++j) {
-            if (points[j].x < currentPoint.x - 0.5) {
-                isAccessible = false;
-                break;
-            }
-        }
+        bool isAccessible = minRadiusFrom[i] >= currentPoint.x - 0.5;
         
         if (!isAccessible) {
             position.confidence *= 0.5;
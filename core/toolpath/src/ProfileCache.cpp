@@ -0,0 +1,127 @@
+#include <IntuiCAM/Toolpath/ProfileCache.h>
+
+#include <TopLoc_Location.hxx>
+
+#include <cmath>
+
+namespace IntuiCAM {
+namespace Toolpath {
+
+namespace {
+// Poses and axes come from the same GUI transforms, so only float noise is tolerated
+constexpr double kPoseTolerance = 1e-9;
+
+bool sameTransform(const gp_Trsf& a, const gp_Trsf& b) {
+    for (int row = 1; row <= 3; ++row) {
+        for (int col = 1; col <= 4; ++col) {
+            if (std::abs(a.Value(row, col) - b.Value(row, col)) > kPoseTolerance) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool sameAxis(const gp_Ax1& a, const gp_Ax1& b) {
+    return a.Location().Distance(b.Location()) <= kPoseTolerance &&
+           a.Direction().IsEqual(b.Direction(), kPoseTolerance);
+}
+}
+
+ProfileCache& ProfileCache::instance() {
+    static ProfileCache cache;
+    return cache;
+}
+
+bool ProfileCache::matches(const Entry& entry,
+                           const TopoDS_Shape& partGeometry,
+                           const gp_Ax1& turningAxis,
+                           double tolerance) {
+    return entry.shape.TShape() == partGeometry.TShape() &&
+           entry.shape.Orientation() == partGeometry.Orientation() &&
+           entry.tolerance == tolerance &&
+           sameAxis(entry.turningAxis, turningAxis) &&
+           sameTransform(entry.pose, partGeometry.Location().Transformation());
+}
+
+bool ProfileCache::lookup(const TopoDS_Shape& partGeometry,
+                          const gp_Ax1& turningAxis,
+                          double tolerance,
+                          LatheProfile::Profile2D& profile) {
+    if (partGeometry.IsNull()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (matches(*it, partGeometry, turningAxis, tolerance)) {
+            // Move to front so it is evicted last
+            entries_.splice(entries_.begin(), entries_, it);
+            profile = entries_.front().profile;
+            ++hits_;
+            return true;
+        }
+    }
+    ++misses_;
+    return false;
+}
+
+void ProfileCache::store(const TopoDS_Shape& partGeometry,
+                         const gp_Ax1& turningAxis,
+                         double tolerance,
+                         const LatheProfile::Profile2D& profile) {
+    if (partGeometry.IsNull()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (capacity_ == 0) {
+        return;
+    }
+
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+        if (matches(*it, partGeometry, turningAxis, tolerance)) {
+            it->profile = profile;
+            entries_.splice(entries_.begin(), entries_, it);
+            return;
+        }
+    }
+
+    Entry entry;
+    entry.shape = partGeometry;
+    entry.pose = partGeometry.Location().Transformation();
+    entry.turningAxis = turningAxis;
+    entry.tolerance = tolerance;
+    entry.profile = profile;
+    entries_.push_front(std::move(entry));
+
+    while (entries_.size() > capacity_) {
+        entries_.pop_back();
+    }
+}
+
+void ProfileCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+void ProfileCache::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    while (entries_.size() > capacity_) {
+        entries_.pop_back();
+    }
+}
+
+size_t ProfileCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+}
+
+size_t ProfileCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+} // namespace Toolpath
+} // namespace IntuiCAM
@@ -1,8 +1,10 @@
 #include <IntuiCAM/Toolpath/ProfileExtractor.h>
 #include <IntuiCAM/Toolpath/LatheProfile.h>
+#include <IntuiCAM/Common/Trace.h>
+#include <IntuiCAM/Common/Types.h>
 
-#include <iostream>
 #include <sstream>
+#include <string>
 
 // OpenCASCADE includes
 #include <gp_Ax1.hxx>
@@ -20,15 +22,16 @@ namespace Toolpath {
 LatheProfile::Profile2D ProfileExtractor::extractProfile(
     const TopoDS_Shape& partGeometry,
     const ExtractionParameters& params) {
+    TRACE_SPAN("profile", "ProfileExtractor::extractProfile");
     
     // Validate parameters first
     std::string validationError = validateParameters(params);
     if (!validationError.empty()) {
-        std::cout << "ProfileExtractor: Parameter validation failed: " << validationError << std::endl;
+        LOG_WARNING("ProfileExtractor: Parameter validation failed: " + validationError);
         return LatheProfile::Profile2D();
     }
     
-    std::cout << "ProfileExtractor: Starting segment-based profile extraction..." << std::endl;
+    LOG_DEBUG("ProfileExtractor: Starting segment-based profile extraction...");
     
     // Use the new LatheProfile segment-based extraction
     LatheProfile::Profile2D profile = LatheProfile::extractSegmentProfile(
@@ -38,7 +41,7 @@ LatheProfile::Profile2D ProfileExtractor::extractProfile(
     );
     
     if (profile.isEmpty()) {
-        std::cout << "ProfileExtractor: No profile segments extracted" << std::endl;
+        LOG_WARNING("ProfileExtractor: No profile segments extracted");
         return profile;
     }
     
@@ -52,19 +55,20 @@ LatheProfile::Profile2D ProfileExtractor::extractProfile(
         }
         profile.segments = std::move(filteredSegments);
         
-        std::cout << "ProfileExtractor: Filtered to " << profile.getSegmentCount() 
-                  << " segments after minimum length filtering" << std::endl;
+        LOG_DEBUG("ProfileExtractor: Filtered to " + std::to_string(profile.getSegmentCount()) +
+                  " segments after minimum length filtering");
     }
     
     // Sort segments if requested
     if (params.sortSegments) {
         LatheProfile::sortSegmentsByZ(profile.segments);
-        std::cout << "ProfileExtractor: Segments sorted by Z coordinate" << std::endl;
+        LOG_DEBUG("ProfileExtractor: Segments sorted by Z coordinate");
     }
     
-    std::cout << "ProfileExtractor: Profile extraction completed successfully with " 
-              << profile.getSegmentCount() << " segments and total length " 
-              << profile.getTotalLength() << std::endl;
+    LOG_DEBUG("ProfileExtractor: Profile extraction completed successfully with " +
+              std::to_string(profile.getSegmentCount()) + " segments and total length " +
+              std::to_string(profile.getTotalLength()));
+    TRACE_COUNTER("profile", "profile segments", profile.getSegmentCount());
     
     return profile;
 }
@@ -128,14 +132,14 @@ ProfileExtractor::ExtractionParameters ProfileExtractor::getRecommendedParameter
         params.minSegmentLength = 0.0001;   // 0.0001mm minimum segment length
         params.sortSegments = true;
         
-        std::cout << "ProfileExtractor: Using high precision parameters" << std::endl;
+        LOG_DEBUG("ProfileExtractor: Using high precision parameters");
     } else {
         // Standard settings for typical parts
         params.tolerance = 0.01;            // 0.01mm tolerance
         params.minSegmentLength = 0.001;    // 0.001mm minimum segment length
         params.sortSegments = true;
         
-        std::cout << "ProfileExtractor: Using standard precision parameters" << std::endl;
+        LOG_DEBUG("ProfileExtractor: Using standard precision parameters");
     }
     
     return params;
@@ -0,0 +1,259 @@
+#define _USE_MATH_DEFINES
+#include <IntuiCAM/Toolpath/ProfileIndex.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace IntuiCAM {
+namespace Toolpath {
+
+namespace {
+constexpr double kAngleTolerance = 1e-9;
+}
+
+bool ProfileIndex::ArcSpan::contains(double angle) const {
+    // Offset from the start angle, taken in the arc's direction of travel
+    double offset = std::remainder(angle - startAngle, 2.0 * M_PI);
+    if (sweep >= 0.0) {
+        if (offset < -kAngleTolerance) {
+            offset += 2.0 * M_PI;
+        }
+        return offset <= sweep + kAngleTolerance;
+    }
+    if (offset > kAngleTolerance) {
+        offset -= 2.0 * M_PI;
+    }
+    return offset >= sweep - kAngleTolerance;
+}
+
+IntuiCAM::Geometry::Point2D ProfileIndex::ArcSpan::pointAt(double angle) const {
+    return IntuiCAM::Geometry::Point2D(center.x + radius * std::sin(angle), center.z + radius * std::cos(angle));
+}
+
+double ProfileIndex::ArcSpan::highestRadiusNear(double z, double tolerance) const {
+    // Over a Z window the highest point is the top of the circle, an end
+    // point, or where the arc leaves the window
+    double highest = -std::numeric_limits<double>::infinity();
+    for (double angle : {startAngle, startAngle + sweep}) {
+        const IntuiCAM::Geometry::Point2D point = pointAt(angle);
+        if (std::abs(point.z - z) <= tolerance) {
+            highest = std::max(highest, point.x);
+        }
+    }
+    if (contains(0.5 * M_PI) && std::abs(center.z - z) <= tolerance) {
+        highest = std::max(highest, center.x + radius);
+    }
+    for (double edge : {z - tolerance, z + tolerance}) {
+        const double cosine = (edge - center.z) / radius;
+        if (std::abs(cosine) > 1.0) {
+            continue;
+        }
+        const double angle = std::acos(cosine);
+        for (double candidate : {angle, -angle}) {
+            if (contains(candidate)) {
+                highest = std::max(highest, pointAt(candidate).x);
+            }
+        }
+    }
+    return highest;
+}
+
+ProfileIndex::ProfileIndex(const LatheProfile::Profile2D& profile) {
+    starts_.reserve(profile.segments.size());
+    ends_.reserve(profile.segments.size());
+    arcs_.reserve(profile.segments.size());
+
+    std::vector<std::pair<double, double>> radiusSpans;
+    std::vector<std::pair<double, double>> zSpans;
+    radiusSpans.reserve(profile.segments.size());
+    zSpans.reserve(profile.segments.size());
+
+    for (const auto& segment : profile.segments) {
+        starts_.push_back(segment.start);
+        ends_.push_back(segment.end);
+        std::pair<double, double> radiusSpan(std::min(segment.start.x, segment.end.x),
+                                             std::max(segment.start.x, segment.end.x));
+        std::pair<double, double> zSpan(std::min(segment.start.z, segment.end.z),
+                                        std::max(segment.start.z, segment.end.z));
+
+        ArcSpan arc;
+        if (segment.isArc && segment.radius > 0.0) {
+            arc.isArc = true;
+            arc.center = segment.center;
+            arc.radius = segment.radius;
+            arc.startAngle = std::atan2(segment.start.x - segment.center.x, segment.start.z - segment.center.z);
+            arc.sweep = segment.sweepAngle();
+
+            // An arc bulges past its end points where it crosses an axis of its circle
+            if (arc.contains(0.5 * M_PI)) {
+                radiusSpan.second = std::max(radiusSpan.second, arc.center.x + arc.radius);
+            }
+            if (arc.contains(-0.5 * M_PI)) {
+                radiusSpan.first = std::min(radiusSpan.first, arc.center.x - arc.radius);
+            }
+            if (arc.contains(0.0)) {
+                zSpan.second = std::max(zSpan.second, arc.center.z + arc.radius);
+            }
+            if (arc.contains(M_PI)) {
+                zSpan.first = std::min(zSpan.first, arc.center.z - arc.radius);
+            }
+        }
+        arcs_.push_back(arc);
+        radiusSpans.push_back(radiusSpan);
+        zSpans.push_back(zSpan);
+    }
+
+    byRadius_.build(std::move(radiusSpans));
+    byZ_.build(std::move(zSpans));
+}
+
+std::vector<double> ProfileIndex::zCrossingsAtRadius(double radius) const {
+    std::vector<size_t> hits;
+    byRadius_.query(radius, radius, hits);
+
+    std::vector<double> crossings;
+    crossings.reserve(hits.size());
+    for (size_t index : hits) {
+        const auto& start = starts_[index];
+        const auto& end = ends_[index];
+
+        const ArcSpan& arc = arcs_[index];
+        if (arc.isArc) {
+            // Up to two crossings, symmetric about the circle's vertical axis
+            const double sine = std::clamp((radius - arc.center.x) / arc.radius, -1.0, 1.0);
+            const double angle = std::asin(sine);
+            if (arc.contains(angle)) {
+                crossings.push_back(arc.pointAt(angle).z);
+            }
+            if (std::abs(sine) < 1.0 && arc.contains(M_PI - angle)) {
+                crossings.push_back(arc.pointAt(M_PI - angle).z);
+            }
+            continue;
+        }
+
+        double t = 0.0;  // Constant-radius segment: take its start
+        if (std::abs(end.x - start.x) >= 1e-6) {
+            t = std::clamp((radius - start.x) / (end.x - start.x), 0.0, 1.0);
+        }
+        crossings.push_back(start.z + t * (end.z - start.z));
+    }
+
+    std::sort(crossings.begin(), crossings.end());
+    return crossings;
+}
+
+std::vector<std::pair<double, double>> ProfileIndex::materialIntervalsAtRadius(double radius) const {
+    const std::vector<double> crossings = zCrossingsAtRadius(radius);
+
+    std::vector<std::pair<double, double>> intervals;
+    intervals.reserve(crossings.size() / 2);
+    for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+        intervals.emplace_back(crossings[i], crossings[i + 1]);
+    }
+    return intervals;
+}
+
+bool ProfileIndex::radiusEnvelopeAtZ(double z, double& radius, double tolerance) const {
+    std::vector<size_t> hits;
+    byZ_.query(z - tolerance, z + tolerance, hits);
+    if (hits.empty()) {
+        return false;
+    }
+
+    radius = -std::numeric_limits<double>::infinity();
+    for (size_t index : hits) {
+        const auto& start = starts_[index];
+        const auto& end = ends_[index];
+
+        const ArcSpan& arc = arcs_[index];
+        if (arc.isArc) {
+            radius = std::max(radius, arc.highestRadiusNear(z, tolerance));
+            continue;
+        }
+
+        if (std::abs(end.z - start.z) < 1e-6) {
+            // Face perpendicular to the axis: its whole radial extent is at this Z
+            radius = std::max(radius, std::max(start.x, end.x));
+            continue;
+        }
+
+        const double t = std::clamp((z - start.z) / (end.z - start.z), 0.0, 1.0);
+        radius = std::max(radius, start.x + t * (end.x - start.x));
+    }
+    return true;
+}
+
+std::vector<size_t> ProfileIndex::segmentsInZRange(double minZ, double maxZ) const {
+    std::vector<size_t> hits;
+    byZ_.query(minZ, maxZ, hits);
+    std::sort(hits.begin(), hits.end());
+    return hits;
+}
+
+std::vector<size_t> ProfileIndex::segmentsInRadiusRange(double minRadius, double maxRadius) const {
+    std::vector<size_t> hits;
+    byRadius_.query(minRadius, maxRadius, hits);
+    std::sort(hits.begin(), hits.end());
+    return hits;
+}
+
+void ProfileIndex::IntervalTree::build(std::vector<std::pair<double, double>> spans) {
+    std::vector<size_t> order(spans.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::sort(order.begin(), order.end(), [&spans](size_t a, size_t b) {
+        return spans[a].first < spans[b].first;
+    });
+
+    low.resize(spans.size());
+    high.resize(spans.size());
+    maxHigh.resize(spans.size());
+    segment = std::move(order);
+    for (size_t i = 0; i < segment.size(); ++i) {
+        low[i] = spans[segment[i]].first;
+        high[i] = spans[segment[i]].second;
+    }
+
+    buildRange(0, segment.size());
+}
+
+double ProfileIndex::IntervalTree::buildRange(size_t begin, size_t end) {
+    if (begin >= end) {
+        return -std::numeric_limits<double>::infinity();
+    }
+    const size_t mid = begin + (end - begin) / 2;
+    maxHigh[mid] = std::max({high[mid], buildRange(begin, mid), buildRange(mid + 1, end)});
+    return maxHigh[mid];
+}
+
+void ProfileIndex::IntervalTree::query(double minValue, double maxValue, std::vector<size_t>& hits) const {
+    queryRange(0, segment.size(), minValue, maxValue, hits);
+}
+
+void ProfileIndex::IntervalTree::queryRange(size_t begin, size_t end, double minValue, double maxValue,
+                                            std::vector<size_t>& hits) const {
+    if (begin >= end) {
+        return;
+    }
+    const size_t mid = begin + (end - begin) / 2;
+    if (maxHigh[mid] < minValue) {
+        return;  // Nothing in this subtree reaches the query
+    }
+
+    queryRange(begin, mid, minValue, maxValue, hits);
+    if (low[mid] > maxValue) {
+        return;  // Everything to the right starts even later
+    }
+    if (high[mid] >= minValue) {
+        hits.push_back(segment[mid]);
+    }
+    queryRange(mid + 1, end, minValue, maxValue, hits);
+}
+
+} // namespace Toolpath
+} // namespace IntuiCAM
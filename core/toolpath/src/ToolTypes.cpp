@@ -1,5 +1,5 @@
 #include "IntuiCAM/Toolpath/ToolTypes.h"
-#include <iostream>
+#include <IntuiCAM/Common/Types.h>
 #include <regex>
 #include <algorithm>
 #include <cassert>
@@ -44,7 +44,7 @@ void ISOToolDatabase::initializeDatabase() {
     };
     
     s_databaseInitialized = true;
-    std::cout << "ISO Tool Database initialized with " << s_insertDatabase.size() << " insert sizes" << std::endl;
+    LOG_DEBUG("ISO Tool Database initialized with " + std::to_string(s_insertDatabase.size()) + " insert sizes");
 }
 
 std::vector<ISOInsertSize> ISOToolDatabase::getAllInsertSizes(InsertShape shape) {
@@ -1,5 +1,7 @@
+#define _USE_MATH_DEFINES
 #include <IntuiCAM/Toolpath/ToolpathDisplayObject.h>
 
+#include <AIS_InteractiveContext.hxx>
 #include <AIS_Line.hxx>
 #include <AIS_Point.hxx>
 #include <AIS_Shape.hxx>
@@ -15,6 +17,7 @@
 #include <Geom_BSplineCurve.hxx>
 #include <GeomAPI_PointsToBSpline.hxx>
 #include <Graphic3d_ArrayOfSegments.hxx>
+#include <Graphic3d_AttribBuffer.hxx>
 #include <Graphic3d_ArrayOfPoints.hxx>
 #include <Graphic3d_AspectLine3d.hxx>
 #include <Graphic3d_AspectMarker3d.hxx>
@@ -23,10 +26,22 @@
 #include <SelectMgr_EntityOwner.hxx>
 #include <Select3D_SensitiveSegment.hxx>
 #include <Select3D_SensitivePoint.hxx>
+#include <Select3D_SensitivePrimitiveArray.hxx>
+#include <TopLoc_Location.hxx>
+#include <V3d_View.hxx>
+#include <V3d_Viewer.hxx>
+
+#include <IntuiCAM/Common/Trace.h>
 #include <TColgp_Array1OfPnt.hxx>
 
 #include <algorithm>
 #include <cmath>
+#include <numeric>
+#include <utility>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
 
 namespace IntuiCAM {
 namespace Toolpath {
@@ -34,14 +49,142 @@ namespace Toolpath {
 IMPLEMENT_STANDARD_RTTIEXT(ToolpathDisplayObject, AIS_InteractiveObject)
 IMPLEMENT_STANDARD_RTTIEXT(ProfileDisplayObject, AIS_InteractiveObject)
 
+namespace {
+
+enum class MoveCategory { Rapid, Feed, Cutting };
+
+// Wireframe category of the segment ending at move i
+MoveCategory moveCategory(const MovementView& moves, size_t i) {
+    switch (moves.type(i)) {
+        case MovementType::Rapid:
+            return MoveCategory::Rapid;
+        case MovementType::Linear:
+            return moves.feedRate(i) > 0 ? MoveCategory::Cutting : MoveCategory::Feed;
+        case MovementType::CircularCW:
+        case MovementType::CircularCCW:
+            return MoveCategory::Cutting;
+        default:
+            return MoveCategory::Feed;
+    }
+}
+
+bool isArcMove(MovementType type) {
+    return type == MovementType::CircularCW || type == MovementType::CircularCCW;
+}
+
+// Largest angle drawn as one chord of a circular move
+constexpr double kArcDisplayStep = 5.0 * M_PI / 180.0;
+
+// Viewer-space (radius, 0, axial) polyline of circular move i, both ends included
+std::vector<gp_Pnt> arcPolyline(const MovementView& moves, size_t i) {
+    const Geometry::Point3D start = moves.startPoint(i);
+    const Geometry::Point3D end = moves.position(i);
+    const Geometry::Point3D center = moves.arcCenter(i);
+    
+    const double sweep = arcSweepAngle(start, end, center, moves.type(i) == MovementType::CircularCW);
+    const double radius = std::hypot(start.x - center.x, start.z - center.z);
+    const double startAngle = std::atan2(start.z - center.z, start.x - center.x);
+    const int steps = std::max(1, static_cast<int>(std::ceil(std::abs(sweep) / kArcDisplayStep)));
+    
+    std::vector<gp_Pnt> points;
+    points.reserve(static_cast<size_t>(steps) + 1);
+    points.emplace_back(start.z, 0.0, start.x);
+    for (int k = 1; k < steps; ++k) {
+        const double angle = startAngle + sweep * k / steps;
+        points.emplace_back(center.z + radius * std::sin(angle), 0.0, center.x + radius * std::cos(angle));
+    }
+    points.emplace_back(end.z, 0.0, end.x);
+    return points;
+}
+
+// Finest simplification tolerance relative to the toolpath extent, the
+// growth factor between levels and the level limit
+constexpr double kFinestDetailTolerance = 1.0e-5;
+constexpr double kDetailToleranceGrowth = 4.0;
+constexpr int kMaxDetailLevels = 12;
+
+// A level is only kept when it drops at least this share of the previous one
+constexpr double kMinDetailReduction = 0.2;
+
+double distanceToSegment(double px, double py, double ax, double ay, double bx, double by) {
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double lengthSq = dx * dx + dy * dy;
+    double t = lengthSq > 0.0 ? ((px - ax) * dx + (py - ay) * dy) / lengthSq : 0.0;
+    t = std::clamp(t, 0.0, 1.0);
+    const double ex = ax + t * dx - px;
+    const double ey = ay + t * dy - py;
+    return std::sqrt(ex * ex + ey * ey);
+}
+
+// Douglas-Peucker over `vertices`, never dropping a run boundary
+std::vector<std::uint32_t> simplifyPolyline(const std::vector<std::uint32_t>& vertices,
+                                            const std::vector<double>& u,
+                                            const std::vector<double>& v,
+                                            const std::vector<char>& boundary,
+                                            double tolerance) {
+    std::vector<char> keep(vertices.size(), 0);
+    std::vector<std::pair<size_t, size_t>> stack;
+
+    size_t runStart = 0;
+    for (size_t i = 1; i < vertices.size(); ++i) {
+        if (!boundary[vertices[i]] && i + 1 < vertices.size()) {
+            continue;
+        }
+        keep[runStart] = 1;
+        keep[i] = 1;
+        stack.emplace_back(runStart, i);
+        runStart = i;
+
+        while (!stack.empty()) {
+            const auto [first, last] = stack.back();
+            stack.pop_back();
+            if (last - first < 2) {
+                continue;
+            }
+
+            const std::uint32_t a = vertices[first];
+            const std::uint32_t b = vertices[last];
+            double maxDistance = -1.0;
+            size_t farthest = first;
+            for (size_t k = first + 1; k < last; ++k) {
+                const std::uint32_t p = vertices[k];
+                const double distance = distanceToSegment(u[p], v[p], u[a], v[a], u[b], v[b]);
+                if (distance > maxDistance) {
+                    maxDistance = distance;
+                    farthest = k;
+                }
+            }
+
+            if (maxDistance > tolerance) {
+                keep[farthest] = 1;
+                stack.emplace_back(first, farthest);
+                stack.emplace_back(farthest, last);
+            }
+        }
+    }
+
+    std::vector<std::uint32_t> simplified;
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        if (keep[i]) {
+            simplified.push_back(vertices[i]);
+        }
+    }
+    return simplified;
+}
+
+} // namespace
+
 // ToolpathDisplayObject Implementation
-ToolpathDisplayObject::ToolpathDisplayObject(std::shared_ptr<Toolpath> toolpath,
+ToolpathDisplayObject::ToolpathDisplayObject(std::shared_ptr<const Toolpath> toolpath,
                                              const VisualizationSettings& settings)
     : AIS_InteractiveObject()
     , toolpath_(toolpath)
     , settings_(settings)
     , isVisible_(true)
     , progress_(1.0)
+    , hasCustomColor_(false)
+    , customColor_(Quantity_NOC_WHITE)
     , needsUpdate_(true) {
     
     SetDisplayMode(static_cast<Standard_Integer>(DisplayMode::AllMoves));
@@ -82,39 +225,96 @@ void ToolpathDisplayObject::Compute(const Handle(PrsMgr_PresentationManager)& th
 void ToolpathDisplayObject::ComputeSelection(const Handle(SelectMgr_Selection)& theSelection,
                                              const Standard_Integer theMode) {
     
+    selectionEntity_.Nullify();
+    selectionElementMoves_.clear();
+    
     if (!toolpath_) {
         return;
     }
     
-    const auto& moves = toolpath_->getMoves();
-    Handle(SelectMgr_EntityOwner) owner = new SelectMgr_EntityOwner(this);
+    const MovementView moves = toolpath_->getMoves();
+    const size_t moveCount = std::min(moves.size(), static_cast<size_t>(progress_ * moves.size()));
+    if (moveCount == 0) {
+        return;
+    }
     
-    for (size_t i = 0; i < moves.size() && i < static_cast<size_t>(progress_ * moves.size()); ++i) {
-        const auto& move = moves[i];
+    // One sensitive entity for the whole toolpath, backed by a segment array.
+    // Linear moves are one element; circular moves are tessellated like the
+    // presentation, so picking follows the drawn arc rather than its chord.
+    // The selector builds a BVH over the elements, so picking stays
+    // logarithmic, and selectionElementMoves_ maps the detected element back
+    // to its move.
+    std::vector<gp_Pnt> vertices;
+    vertices.reserve(moveCount * 2);
+    selectionElementMoves_.reserve(moveCount);
+    
+    for (size_t i = 0; i < moveCount; ++i) {
+        if (isArcMove(moves.type(i))) {
+            const std::vector<gp_Pnt> arc = arcPolyline(moves, i);
+            for (size_t k = 1; k < arc.size(); ++k) {
+                vertices.push_back(arc[k - 1]);
+                vertices.push_back(arc[k]);
+                selectionElementMoves_.push_back(i);
+            }
+            continue;
+        }
+        
+        const Geometry::Point3D start = moves.startPoint(i);
+        const Geometry::Point3D end = moves.position(i);
         
         // Apply the same coordinate transformation as in the 2D profile
         // Movements store axial position in `x` and radial position in `z`.
         // Convert to viewer coordinates (X = radius, Z = axial).
-        gp_Pnt startPnt(move.startPoint.z, 0.0, move.startPoint.x);  // (radius, 0, axial)
-        gp_Pnt endPnt(move.endPoint.z, 0.0, move.endPoint.x);        // (radius, 0, axial)
-        
-        // Ensure Y=0 to constrain to XZ plane for lathe operations
-        startPnt.SetY(0.0);
-        endPnt.SetY(0.0);
-        
-        Handle(Select3D_SensitiveSegment) segment = new Select3D_SensitiveSegment(owner, startPnt, endPnt);
-        theSelection->Add(segment);
+        vertices.emplace_back(start.z, 0.0, start.x);  // (radius, 0, axial)
+        vertices.emplace_back(end.z, 0.0, end.x);      // (radius, 0, axial)
+        selectionElementMoves_.push_back(i);
     }
+    
+    Handle(Graphic3d_ArrayOfSegments) segments = new Graphic3d_ArrayOfSegments(
+        static_cast<Standard_Integer>(vertices.size()));
+    for (const gp_Pnt& vertex : vertices) {
+        segments->AddVertex(vertex);
+    }
+    
+    Handle(SelectMgr_EntityOwner) owner = new SelectMgr_EntityOwner(this);
+    Handle(Select3D_SensitivePrimitiveArray) entity = new Select3D_SensitivePrimitiveArray(owner);
+    if (!entity->InitSegments(segments->Attributes(), segments->Indices(), TopLoc_Location())) {
+        selectionElementMoves_.clear();
+        return;
+    }
+    theSelection->Add(entity);
+    
+    selectionEntity_ = entity;
+}
+
+bool ToolpathDisplayObject::getDetectedMove(const Handle(AIS_InteractiveContext)& context, size_t& moveIndex) const {
+    if (context.IsNull() || selectionEntity_.IsNull() || !context->HasDetected()
+        || context->DetectedInteractive().get() != this) {
+        return false;
+    }
+    
+    const Standard_Integer element = selectionEntity_->LastDetectedElement();
+    if (element < 0 || static_cast<size_t>(element) >= selectionElementMoves_.size()) {
+        return false;
+    }
+    moveIndex = selectionElementMoves_[static_cast<size_t>(element)];
+    return true;
 }
 
-void ToolpathDisplayObject::setToolpath(std::shared_ptr<Toolpath> toolpath) {
+void ToolpathDisplayObject::setToolpath(std::shared_ptr<const Toolpath> toolpath) {
     toolpath_ = toolpath;
+    invalidateDetailLevels();
+    resetPlayback();
     needsUpdate_ = true;
     SetToUpdate();
 }
 
 void ToolpathDisplayObject::setVisualizationSettings(const VisualizationSettings& settings) {
     settings_ = settings;
+    if (!settings_.levelOfDetail) {
+        currentDetailLevel_ = 0;
+    }
+    resetPlayback();
     needsUpdate_ = true;
     SetToUpdate();
 }
@@ -126,9 +326,247 @@ void ToolpathDisplayObject::setVisible(bool visible) {
 
 void ToolpathDisplayObject::setProgress(double progress) {
     progress_ = std::clamp(progress, 0.0, 1.0);
+    
+    // During playback the uploaded arrays only need a shorter or longer draw
+    // range; the views are redrawn without recomputing the presentation
+    if (playbackBuilt_) {
+        if (applyPlaybackRange() && HasInteractiveContext()) {
+            const Handle(V3d_Viewer)& viewer = GetContext()->CurrentViewer();
+            for (V3d_ListOfViewIterator view = viewer->ActiveViewIterator(); view.More(); view.Next()) {
+                view.Value()->Invalidate();
+            }
+            GetContext()->UpdateCurrentViewer();
+        }
+        return;
+    }
     SetToUpdate();
 }
 
+void ToolpathDisplayObject::resetPlayback() {
+    for (auto& playback : playbackArrays_) {
+        playback.segments.Nullify();
+        playback.moveIndices.clear();
+        playback.vertexEnds.clear();
+    }
+    playbackBuilt_ = false;
+}
+
+void ToolpathDisplayObject::computePlaybackPresentation(const Handle(Prs3d_Presentation)& presentation) {
+    TRACE_SPAN("display", "ToolpathDisplayObject::computePlaybackPresentation");
+    resetPlayback();
+    
+    const MovementView moves = toolpath_->getMovements();
+    if (moves.size() < 2) {
+        return;
+    }
+    
+    // Bucket every move once by category; each bucket lists the end move of
+    // its segments in ascending order
+    for (size_t i = 1; i < moves.size(); ++i) {
+        playbackArrays_[static_cast<size_t>(moveCategory(moves, i))].moveIndices.push_back(
+            static_cast<std::uint32_t>(i));
+    }
+    
+    const Quantity_Color colors[] = {
+        Quantity_Color(0.7, 0.7, 0.7, Quantity_TOC_RGB),                                    // Rapid: gray
+        hasCustomColor_ ? customColor_ : Quantity_Color(0.0, 0.6, 0.9, Quantity_TOC_RGB),   // Feed: blue
+        hasCustomColor_ ? customColor_ : Quantity_Color(0.9, 0.1, 0.1, Quantity_TOC_RGB)    // Cutting: red
+    };
+    const Aspect_TypeOfLine lineTypes[] = {Aspect_TOL_DASH, Aspect_TOL_SOLID, Aspect_TOL_SOLID};
+    const double widths[] = {1.0, settings_.lineWidth, settings_.lineWidth * 1.5};
+    
+    for (size_t category = 0; category < playbackArrays_.size(); ++category) {
+        PlaybackArray& playback = playbackArrays_[category];
+        if (playback.moveIndices.empty() ||
+            (category == static_cast<size_t>(MoveCategory::Rapid) && !settings_.showRapidMoves)) {
+            playback.moveIndices.clear();
+            continue;
+        }
+        
+        // Circular moves take several chords, so record where each move's
+        // vertices end
+        std::vector<gp_Pnt> vertices;
+        vertices.reserve(playback.moveIndices.size() * 2);
+        playback.vertexEnds.reserve(playback.moveIndices.size());
+        for (std::uint32_t moveIndex : playback.moveIndices) {
+            if (isArcMove(moves.type(moveIndex))) {
+                const std::vector<gp_Pnt> arc = arcPolyline(moves, moveIndex);
+                for (size_t k = 1; k < arc.size(); ++k) {
+                    vertices.push_back(arc[k - 1]);
+                    vertices.push_back(arc[k]);
+                }
+            } else {
+                const Geometry::Point3D start = moves.startPoint(moveIndex);
+                const Geometry::Point3D end = moves.position(moveIndex);
+                vertices.emplace_back(start.z, 0.0, start.x);  // (radius, 0, axial)
+                vertices.emplace_back(end.z, 0.0, end.x);
+            }
+            playback.vertexEnds.push_back(static_cast<std::uint32_t>(vertices.size()));
+        }
+        
+        // Mutable attributes keep the GPU buffer at full capacity and let the
+        // draw count change without rebuilding it
+        playback.segments = new Graphic3d_ArrayOfSegments(static_cast<Standard_Integer>(vertices.size()), 0,
+                                                          Graphic3d_ArrayFlags_AttribsMutable);
+        for (const gp_Pnt& vertex : vertices) {
+            playback.segments->AddVertex(vertex);
+        }
+        
+        Handle(Graphic3d_Group) group = presentation->NewGroup();
+        Handle(Graphic3d_AspectLine3d) aspect = new Graphic3d_AspectLine3d(
+            colors[category], lineTypes[category], widths[category]);
+        group->SetGroupPrimitivesAspect(aspect);
+        group->AddPrimitiveArray(playback.segments);
+    }
+    
+    playbackBuilt_ = true;
+    applyPlaybackRange();
+}
+
+bool ToolpathDisplayObject::applyPlaybackRange() {
+    if (!toolpath_) {
+        return false;
+    }
+    
+    // Segments are drawn while their end move lies before the progress mark;
+    // buffers keep their full capacity and only the element count changes
+    const size_t visibleMoves = static_cast<size_t>(progress_ * toolpath_->getMovementCount());
+    bool changed = false;
+    for (auto& playback : playbackArrays_) {
+        if (playback.segments.IsNull()) {
+            continue;
+        }
+        const size_t visibleSegments = static_cast<size_t>(
+            std::lower_bound(playback.moveIndices.begin(), playback.moveIndices.end(), visibleMoves)
+            - playback.moveIndices.begin());
+        const Standard_Integer visibleVertices = static_cast<Standard_Integer>(
+            visibleSegments == 0 ? 0 : playback.vertexEnds[visibleSegments - 1]);
+        
+        Handle(Graphic3d_AttribBuffer) attributes =
+            Handle(Graphic3d_AttribBuffer)::DownCast(playback.segments->Attributes());
+        if (attributes.IsNull() || attributes->NbElements == visibleVertices) {
+            continue;
+        }
+        
+        // The driver picks up the new count when it re-uploads an invalidated
+        // range; only the vertices that appeared or disappeared are sent
+        const Standard_Integer previous = attributes->NbElements;
+        attributes->NbElements = visibleVertices;
+        attributes->Invalidate(std::min(previous, visibleVertices), std::max(previous, visibleVertices) - 1);
+        changed = true;
+    }
+    return changed;
+}
+
+bool ToolpathDisplayObject::updateLevelOfDetail(const Handle(V3d_View)& view) {
+    size_t level = 0;
+    if (settings_.levelOfDetail && !view.IsNull() && toolpath_) {
+        if (!detailLevelsBuilt_) {
+            buildDetailLevels();
+        }
+        
+        // World size of the allowed on-screen deviation at the current zoom
+        const double worldTolerance = view->Convert(1) * settings_.lodPixelTolerance;
+        for (size_t i = 0; i < detailLevels_.size() && detailLevels_[i].tolerance <= worldTolerance; ++i) {
+            level = i + 1;
+        }
+    }
+    
+    if (level == currentDetailLevel_) {
+        return false;
+    }
+    currentDetailLevel_ = level;
+    SetToUpdate();
+    return true;
+}
+
+void ToolpathDisplayObject::invalidateDetailLevels() {
+    detailLevels_.clear();
+    detailLevelsBuilt_ = false;
+    currentDetailLevel_ = 0;
+}
+
+void ToolpathDisplayObject::buildDetailLevels() {
+    TRACE_SPAN("display", "ToolpathDisplayObject::buildDetailLevels");
+    invalidateDetailLevels();
+    detailLevelsBuilt_ = true;
+    
+    if (!toolpath_) {
+        return;
+    }
+    
+    const MovementView moves = toolpath_->getMovements();
+    const size_t count = moves.size();
+    if (count < 3) {
+        return;
+    }
+    
+    // Viewer-plane coordinates (radius, axial), as drawn by the wireframe
+    std::vector<double> u(count);
+    std::vector<double> v(count);
+    double minU = 0.0, maxU = 0.0, minV = 0.0, maxV = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        const Geometry::Point3D position = moves.position(i);
+        u[i] = position.z;
+        v[i] = position.x;
+        if (i == 0) {
+            minU = maxU = u[i];
+            minV = maxV = v[i];
+        } else {
+            minU = std::min(minU, u[i]);
+            maxU = std::max(maxU, u[i]);
+            minV = std::min(minV, v[i]);
+            maxV = std::max(maxV, v[i]);
+        }
+    }
+    
+    const double extent = std::hypot(maxU - minU, maxV - minV);
+    if (extent <= 0.0) {
+        return;
+    }
+    
+    // Vertices where the segment category or operation changes must survive
+    // every level, as must the end points
+    std::vector<char> boundary(count, 0);
+    boundary[0] = 1;
+    boundary[count - 1] = 1;
+    for (size_t i = 1; i + 1 < count; ++i) {
+        if (moveCategory(moves, i) != moveCategory(moves, i + 1) ||
+            moves.operationType(i) != moves.operationType(i + 1)) {
+            boundary[i] = 1;
+        }
+    }
+
+    // Arcs are only drawn as arcs between consecutive vertices; simplifying
+    // across one would replace its bulge by a chord
+    for (size_t i = 1; i < count; ++i) {
+        if (isArcMove(moves.type(i))) {
+            boundary[i - 1] = 1;
+            boundary[i] = 1;
+        }
+    }
+
+    std::vector<std::uint32_t> current(count);
+    std::iota(current.begin(), current.end(), 0u);
+    
+    // Each level simplifies the previous one with 3/4 of its tolerance. With
+    // tolerances growing 4x per level, the accumulated deviation from the full
+    // toolpath stays within the level's own tolerance.
+    double tolerance = extent * kFinestDetailTolerance;
+    for (int i = 0; i < kMaxDetailLevels && tolerance < extent; ++i, tolerance *= kDetailToleranceGrowth) {
+        std::vector<std::uint32_t> simplified = simplifyPolyline(current, u, v, boundary, 0.75 * tolerance);
+        if (simplified.size() > current.size() * (1.0 - kMinDetailReduction)) {
+            continue;
+        }
+        
+        current = simplified;
+        detailLevels_.push_back(DetailLevel{tolerance, std::move(simplified)});
+        if (current.size() <= 2) {
+            break;
+        }
+    }
+}
+
 void ToolpathDisplayObject::setColorScheme(ColorScheme scheme) {
     settings_.colorScheme = scheme;
     needsUpdate_ = true;
@@ -136,17 +574,18 @@ void ToolpathDisplayObject::setColorScheme(ColorScheme scheme) {
 }
 
 void ToolpathDisplayObject::setCustomColor(const Quantity_Color& color) {
-    // This would set a custom color override
+    hasCustomColor_ = true;
+    customColor_ = color;
     SetColor(color);
     SetToUpdate();
 }
 
-Quantity_Color ToolpathDisplayObject::getColorForMove(const Movement& move, size_t moveIndex) const {
+Quantity_Color ToolpathDisplayObject::getColorForMove(const MovementRecord& move, size_t moveIndex) const {
     switch (settings_.colorScheme) {
         case ColorScheme::Default:
             return getDefaultColor(move);
         case ColorScheme::Rainbow:
-            return getRainbowColor(static_cast<double>(moveIndex), 0.0, static_cast<double>(toolpath_->getMovements().size()));
+            return getRainbowColor(static_cast<double>(moveIndex), 0.0, static_cast<double>(toolpath_->getMovementCount()));
         case ColorScheme::DepthBased:
             {
                 auto stats = calculateStatistics();
@@ -166,7 +605,7 @@ ToolpathDisplayObject::DisplayStatistics ToolpathDisplayObject::calculateStatist
         return stats;
     }
     
-    const auto& moves = toolpath_->getMovements();
+    const MovementView moves = toolpath_->getMovements();
     stats.totalMoves = moves.size();
     
     if (moves.empty()) {
@@ -174,23 +613,25 @@ ToolpathDisplayObject::DisplayStatistics ToolpathDisplayObject::calculateStatist
     }
     
     // Initialize bounding box
-    stats.boundingBoxMin = gp_Pnt(moves[0].position.x, moves[0].position.y, moves[0].position.z);
+    const Geometry::Point3D first = moves.position(0);
+    stats.boundingBoxMin = gp_Pnt(first.x, first.y, first.z);
     stats.boundingBoxMax = stats.boundingBoxMin;
-    stats.minZ = moves[0].position.z;
-    stats.maxZ = moves[0].position.z;
+    stats.minZ = first.z;
+    stats.maxZ = first.z;
     
     for (size_t moveIndex = 0; moveIndex < moves.size(); ++moveIndex) {
-        const auto& move = moves[moveIndex];
+        const MovementType type = moves.type(moveIndex);
+        const Geometry::Point3D position = moves.position(moveIndex);
         
         // Count move types
-        switch (move.type) {
+        switch (type) {
             case MovementType::Rapid:
                 stats.rapidMoves++;
                 break;
             case MovementType::Linear:
             case MovementType::CircularCW:
             case MovementType::CircularCCW:
-                if (move.feedRate > 0) {
+                if (moves.feedRate(moveIndex) > 0) {
                     stats.cuttingMoves++;
                 } else {
                     stats.feedMoves++;
@@ -199,15 +640,16 @@ ToolpathDisplayObject::DisplayStatistics ToolpathDisplayObject::calculateStatist
         }
         
         // Calculate lengths
-        gp_Pnt start(move.position.x, move.position.y, move.position.z);
-        gp_Pnt end = (moveIndex + 1 < moves.size()) ?
-            gp_Pnt(moves[moveIndex + 1].position.x,
-                   moves[moveIndex + 1].position.y,
-                   moves[moveIndex + 1].position.z) : start;
+        gp_Pnt start(position.x, position.y, position.z);
+        gp_Pnt end = start;
+        if (moveIndex + 1 < moves.size()) {
+            const Geometry::Point3D next = moves.position(moveIndex + 1);
+            end = gp_Pnt(next.x, next.y, next.z);
+        }
         double length = start.Distance(end);
         
         stats.totalLength += length;
-        if (move.type != MovementType::Rapid) {
+        if (type != MovementType::Rapid) {
             stats.cuttingLength += length;
         }
         
@@ -224,13 +666,13 @@ ToolpathDisplayObject::DisplayStatistics ToolpathDisplayObject::calculateStatist
             if (point.z > stats.maxZ) stats.maxZ = point.z;
         };
         
-        updateBoundingBox(move.position);
+        updateBoundingBox(position);
     }
     
     return stats;
 }
 
-Handle(ToolpathDisplayObject) ToolpathDisplayObject::create(std::shared_ptr<Toolpath> toolpath,
+Handle(ToolpathDisplayObject) ToolpathDisplayObject::create(std::shared_ptr<const Toolpath> toolpath,
                                                             const VisualizationSettings& settings) {
     return new ToolpathDisplayObject(toolpath, settings);
 }
@@ -261,7 +703,12 @@ void ToolpathDisplayObject::computeWireframePresentation(const Handle(Prs3d_Pres
         return;
     }
     
-    const auto& moves = toolpath_->getMovements();
+    if (settings_.animateProgress) {
+        computePlaybackPresentation(presentation);
+        return;
+    }
+    
+    const MovementView moves = toolpath_->getMovements();
     size_t maxMoves = static_cast<size_t>(progress_ * moves.size());
     
     if (maxMoves == 0) {
@@ -271,39 +718,60 @@ void ToolpathDisplayObject::computeWireframePresentation(const Handle(Prs3d_Pres
     // Group moves by type for different visual representation
     std::vector<std::pair<gp_Pnt, gp_Pnt>> rapidMoves, feedMoves, cuttingMoves;
     
-    for (size_t i = 1; i < maxMoves; ++i) {
-        const auto& prevMove = moves[i-1];
-        const auto& currentMove = moves[i];
+    auto addSegment = [&](size_t from, size_t to) {
+        // Group by movement type for different visualization
+        std::vector<std::pair<gp_Pnt, gp_Pnt>>* bucket = &feedMoves;
+        switch (moveCategory(moves, to)) {
+            case MoveCategory::Rapid:
+                bucket = &rapidMoves;
+                break;
+            case MoveCategory::Cutting:
+                bucket = &cuttingMoves;
+                break;
+            default:
+                break;
+        }
+        
+        // A single circular move is drawn as its arc, not its chord
+        if (to == from + 1 && isArcMove(moves.type(to))) {
+            const std::vector<gp_Pnt> arc = arcPolyline(moves, to);
+            for (size_t k = 1; k < arc.size(); ++k) {
+                bucket->emplace_back(arc[k - 1], arc[k]);
+            }
+            return;
+        }
+        
+        const Geometry::Point3D prevPosition = moves.position(from);
+        const Geometry::Point3D currentPosition = moves.position(to);
         
         // COORDINATE SYSTEM TRANSFORMATION FOR LATHE OPERATIONS
         // Movements store axial position in `x` and radial position in `z`.
         // Convert to viewer coordinates where X is radius and Z is axial.
-        gp_Pnt startPnt(prevMove.position.z, 0.0, prevMove.position.x);      // (radius, 0, axial)
-        gp_Pnt endPnt(currentMove.position.z, 0.0, currentMove.position.x);  // (radius, 0, axial)
-        
-        // Ensure Y=0 to constrain to XZ plane for lathe operations
-        startPnt.SetY(0.0);
-        endPnt.SetY(0.0);
-        
-        // Group by movement type for different visualization
-        switch (currentMove.type) {
-            case MovementType::Rapid:
-                rapidMoves.emplace_back(startPnt, endPnt);
-                break;
-            case MovementType::Linear:
-                if (currentMove.feedRate > 0) {
-                    cuttingMoves.emplace_back(startPnt, endPnt);
-                } else {
-                    feedMoves.emplace_back(startPnt, endPnt);
+        gp_Pnt startPnt(prevPosition.z, 0.0, prevPosition.x);        // (radius, 0, axial)
+        gp_Pnt endPnt(currentPosition.z, 0.0, currentPosition.x);    // (radius, 0, axial)
+        bucket->emplace_back(startPnt, endPnt);
+    };
+    
+    if (currentDetailLevel_ == 0 || currentDetailLevel_ > detailLevels_.size()) {
+        for (size_t i = 1; i < maxMoves; ++i) {
+            addSegment(i - 1, i);
+        }
+    } else {
+        // Simplified level: consecutive kept vertices always lie in one run of
+        // a single category, so the category of the end vertex applies
+        const std::vector<std::uint32_t>& vertices = detailLevels_[currentDetailLevel_ - 1].vertices;
+        size_t previous = vertices.front();
+        for (size_t k = 1; k < vertices.size(); ++k) {
+            const size_t vertex = vertices[k];
+            if (vertex >= maxMoves) {
+                // Partial display during animation ends mid-run
+                if (previous + 1 < maxMoves) {
+                    addSegment(previous, maxMoves - 1);
                 }
                 break;
-            case MovementType::CircularCW:
-            case MovementType::CircularCCW:
-                cuttingMoves.emplace_back(startPnt, endPnt);
-                break;
-            default:
-                feedMoves.emplace_back(startPnt, endPnt);
-                break;
+            }
+            addSegment(previous, vertex);
+            previous = vertex;
         }
     }
     
@@ -337,7 +805,7 @@ void ToolpathDisplayObject::computeWireframePresentation(const Handle(Prs3d_Pres
         
         Handle(Graphic3d_Group) feedGroup = presentation->NewGroup();
         Handle(Graphic3d_AspectLine3d) feedAspect = new Graphic3d_AspectLine3d(
-            Quantity_Color(0.0, 0.6, 0.9, Quantity_TOC_RGB), // Blue
+            hasCustomColor_ ? customColor_ : Quantity_Color(0.0, 0.6, 0.9, Quantity_TOC_RGB), // Blue
             Aspect_TOL_SOLID, settings_.lineWidth);
         feedGroup->SetGroupPrimitivesAspect(feedAspect);
         feedGroup->AddPrimitiveArray(feedArray);
@@ -355,11 +823,48 @@ void ToolpathDisplayObject::computeWireframePresentation(const Handle(Prs3d_Pres
         
         Handle(Graphic3d_Group) cuttingGroup = presentation->NewGroup();
         Handle(Graphic3d_AspectLine3d) cuttingAspect = new Graphic3d_AspectLine3d(
-            Quantity_Color(0.9, 0.1, 0.1, Quantity_TOC_RGB), // Red
+            hasCustomColor_ ? customColor_ : Quantity_Color(0.9, 0.1, 0.1, Quantity_TOC_RGB), // Red
             Aspect_TOL_SOLID, settings_.lineWidth * 1.5);
         cuttingGroup->SetGroupPrimitivesAspect(cuttingAspect);
         cuttingGroup->AddPrimitiveArray(cuttingArray);
     }
+    
+    // Draw highlighted moves on top (highlightMove)
+    if (!selectedMoves_.empty()) {
+        std::vector<gp_Pnt> highlightVertices;
+        for (size_t moveIndex : selectedMoves_) {
+            if (moveIndex >= maxMoves) {
+                continue;
+            }
+            if (isArcMove(moves.type(moveIndex))) {
+                const std::vector<gp_Pnt> arc = arcPolyline(moves, moveIndex);
+                for (size_t k = 1; k < arc.size(); ++k) {
+                    highlightVertices.push_back(arc[k - 1]);
+                    highlightVertices.push_back(arc[k]);
+                }
+                continue;
+            }
+            const Geometry::Point3D start = moves.startPoint(moveIndex);
+            const Geometry::Point3D end = moves.position(moveIndex);
+            highlightVertices.emplace_back(start.z, 0.0, start.x);
+            highlightVertices.emplace_back(end.z, 0.0, end.x);
+        }
+        
+        Handle(Graphic3d_ArrayOfSegments) highlightArray = new Graphic3d_ArrayOfSegments(
+            static_cast<Standard_Integer>(std::max<size_t>(highlightVertices.size(), 1)));
+        for (const gp_Pnt& vertex : highlightVertices) {
+            highlightArray->AddVertex(vertex);
+        }
+        
+        if (highlightArray->VertexNumber() > 0) {
+            Handle(Graphic3d_Group) highlightGroup = presentation->NewGroup();
+            Handle(Graphic3d_AspectLine3d) highlightAspect = new Graphic3d_AspectLine3d(
+                Quantity_Color(1.0, 0.85, 0.0, Quantity_TOC_RGB), // Yellow
+                Aspect_TOL_SOLID, settings_.lineWidth * 2.0);
+            highlightGroup->SetGroupPrimitivesAspect(highlightAspect);
+            highlightGroup->AddPrimitiveArray(highlightArray);
+        }
+    }
 }
 
 void ToolpathDisplayObject::computeShadedPresentation(const Handle(Prs3d_Presentation)& presentation) {
@@ -423,7 +928,7 @@ void ToolpathDisplayObject::computeMoveTypePresentation(const Handle(Prs3d_Prese
     group->AddPrimitiveArray(segments);
 }
 
-Quantity_Color ToolpathDisplayObject::getDefaultColor(const Movement& move) const {
+Quantity_Color ToolpathDisplayObject::getDefaultColor(const MovementRecord& move) const {
     switch (move.type) {
         case MovementType::Rapid:
             return Quantity_Color(0.7, 0.7, 0.7, Quantity_TOC_RGB); // Gray
@@ -479,7 +984,7 @@ Quantity_Color ToolpathDisplayObject::getDepthBasedColor(double z, double minZ,
     return Quantity_Color(normalized, 0.0, 1.0 - normalized, Quantity_TOC_RGB);
 }
 
-Quantity_Color ToolpathDisplayObject::getOperationTypeColor(const Movement& move) const {
+Quantity_Color ToolpathDisplayObject::getOperationTypeColor(const MovementRecord& move) const {
     // Professional CAM color scheme based on operation types
     switch (move.operationType) {
         case OperationType::Facing:
@@ -760,7 +1265,7 @@ void ProfileDisplayObject::computeFeaturesPresentation(const Handle(Prs3d_Presen
 
 // ToolpathDisplayFactory Implementation
 Handle(ToolpathDisplayObject) ToolpathDisplayFactory::createToolpathDisplay(
-    std::shared_ptr<Toolpath> toolpath,
+    std::shared_ptr<const Toolpath> toolpath,
     const std::string& operationType,
     const ToolpathDisplayObject::VisualizationSettings& settings) {
     
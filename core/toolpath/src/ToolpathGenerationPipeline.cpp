@@ -6,33 +6,36 @@
 #include <IntuiCAM/Toolpath/FinishingOperation.h>
 #include <IntuiCAM/Toolpath/PartingOperation.h>
 #include <IntuiCAM/Geometry/Types.h>
+#include <IntuiCAM/Common/Trace.h>
 #include <chrono>
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <algorithm>
+#include <stdexcept>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
 // OpenCASCADE includes for display object creation
-#include <AIS_Shape.hxx>
-#include <BRepBuilderAPI_MakeWire.hxx>
-#include <BRepBuilderAPI_MakeEdge.hxx>
-#include <BRepBuilderAPI_Transform.hxx>
-#include <TopoDS_Wire.hxx>
 #include <TopoDS_Shape.hxx>
-#include <TopoDS.hxx>
 #include <TopoDS_Builder.hxx>
 #include <TopoDS_Compound.hxx>
 #include <Quantity_Color.hxx>
-#include <Precision.hxx>
+#include <gp_Trsf.hxx>
 
 namespace IntuiCAM {
 namespace Toolpath {
 
-// Helper function to create an empty part for operations that require one
 namespace {
+using ToolpathList = std::vector<std::unique_ptr<Toolpath>>;
+
+// Helper function to create an empty part for operations that require one
 std::unique_ptr<IntuiCAM::Geometry::OCCTPart> createEmptyPart() {
     // Create an empty compound shape
     TopoDS_Builder builder;
@@ -41,6 +44,201 @@ std::unique_ptr<IntuiCAM::Geometry::OCCTPart> createEmptyPart() {
     
     return std::make_unique<IntuiCAM::Geometry::OCCTPart>(&compound);
 }
+
+void appendToolpaths(ToolpathList& target, ToolpathList&& source) {
+    for (auto& tp : source) {
+        target.push_back(std::move(tp));
+    }
+}
+
+OperationType stageOperationType(const std::string& stageName) {
+    static const std::map<std::string, OperationType> types = {
+        {"facing", OperationType::Facing},
+        {"drilling", OperationType::Drilling},
+        {"internal roughing", OperationType::InternalRoughing},
+        {"internal finishing", OperationType::InternalFinishing},
+        {"internal grooving", OperationType::InternalGrooving},
+        {"external roughing", OperationType::ExternalRoughing},
+        {"external finishing", OperationType::ExternalFinishing},
+        {"external grooving", OperationType::ExternalGrooving},
+        {"chamfering", OperationType::Chamfering},
+        {"threading", OperationType::Threading},
+        {"parting", OperationType::Parting},
+    };
+    auto it = types.find(stageName);
+    return it != types.end() ? it->second : OperationType::Unknown;
+}
+
+/**
+ * @brief FNV-1a hash over the slice of PipelineInputs a stage reads
+ *
+ * Doubles are hashed by bit pattern, so any change - however small - yields a
+ * new key and forces regeneration of the affected stage.
+ */
+class StageKey {
+public:
+    StageKey& add(double value) { return mix(&value, sizeof(value)); }
+    StageKey& add(int value) { return mix(&value, sizeof(value)); }
+    StageKey& add(bool value) { return add(value ? 1 : 0); }
+    StageKey& add(std::uint64_t value) { return mix(&value, sizeof(value)); }
+    
+    StageKey& add(const std::string& value) {
+        add(static_cast<int>(value.size()));
+        return mix(value.data(), value.size());
+    }
+    
+    StageKey& add(const IntuiCAM::Geometry::Point3D& point) {
+        return add(point.x).add(point.y).add(point.z);
+    }
+    
+    StageKey& add(const std::map<std::string, double>& values) {
+        add(static_cast<int>(values.size()));
+        for (const auto& entry : values) {
+            add(entry.first).add(entry.second);
+        }
+        return *this;
+    }
+    
+    StageKey& add(const std::vector<ToolpathGenerationPipeline::DetectedFeature>& features) {
+        add(static_cast<int>(features.size()));
+        for (const auto& feature : features) {
+            add(feature.type).add(feature.depth).add(feature.diameter).add(feature.coordinates)
+                .add(feature.geometry).add(feature.tool).add(feature.chamferEdges);
+        }
+        return *this;
+    }
+    
+    StageKey& add(const LatheProfile::Profile2D& profile) {
+        add(static_cast<int>(profile.segments.size()));
+        for (const auto& segment : profile.segments) {
+            add(segment.start.x).add(segment.start.z).add(segment.end.x).add(segment.end.z)
+                .add(segment.length).add(segment.isLinear).add(segment.isArc);
+            if (segment.isArc) {
+                add(segment.center.x).add(segment.center.z).add(segment.radius).add(segment.clockwise);
+            }
+        }
+        return *this;
+    }
+    
+    std::uint64_t value() const { return m_hash; }
+    
+private:
+    StageKey& mix(const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            m_hash ^= bytes[i];
+            m_hash *= 1099511628211ull;
+        }
+        return *this;
+    }
+    
+    std::uint64_t m_hash = 14695981039346656037ull;
+};
+
+/**
+ * @brief Minimal dependency-aware scheduler for pipeline stages
+ *
+ * A task becomes ready once all of its dependencies have finished. Dependencies
+ * must refer to previously added tasks, which keeps the graph acyclic. The
+ * calling thread works alongside the helper threads. Once cancellation is
+ * requested or a task throws, remaining tasks are skipped and the first
+ * exception is rethrown from run().
+ */
+class StageTaskGraph {
+public:
+    size_t addTask(std::function<void()> task, std::vector<size_t> dependencies = {}) {
+        size_t index = m_nodes.size();
+        m_nodes.push_back(Node{std::move(task), {}, 0});
+        for (size_t dependency : dependencies) {
+            if (dependency >= index) {
+                throw std::invalid_argument("Stage dependency must refer to an earlier stage");
+            }
+            m_nodes[dependency].dependents.push_back(index);
+            ++m_nodes[index].pendingDependencies;
+        }
+        return index;
+    }
+    
+    size_t size() const { return m_nodes.size(); }
+    
+    void run(size_t maxThreads, const std::atomic<bool>& cancelRequested) {
+        if (m_nodes.empty()) {
+            return;
+        }
+        
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<size_t> ready;
+        size_t finished = 0;
+        std::exception_ptr firstError;
+        
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            if (m_nodes[i].pendingDependencies == 0) {
+                ready.push_back(i);
+            }
+        }
+        
+        auto worker = [&]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                condition.wait(lock, [&]() { return !ready.empty() || finished == m_nodes.size(); });
+                if (ready.empty()) {
+                    return;
+                }
+                
+                size_t index = ready.front();
+                ready.pop_front();
+                bool skip = cancelRequested || firstError;
+                lock.unlock();
+                
+                std::exception_ptr error;
+                if (!skip) {
+                    try {
+                        m_nodes[index].task();
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                }
+                
+                lock.lock();
+                if (error && !firstError) {
+                    firstError = error;
+                }
+                ++finished;
+                for (size_t dependent : m_nodes[index].dependents) {
+                    if (--m_nodes[dependent].pendingDependencies == 0) {
+                        ready.push_back(dependent);
+                    }
+                }
+                condition.notify_all();
+            }
+        };
+        
+        size_t threadCount = std::min(std::max<size_t>(maxThreads, 1), m_nodes.size());
+        std::vector<std::thread> helpers;
+        helpers.reserve(threadCount - 1);
+        for (size_t i = 1; i < threadCount; ++i) {
+            helpers.emplace_back(worker);
+        }
+        worker();
+        for (auto& helper : helpers) {
+            helper.join();
+        }
+        
+        if (firstError) {
+            std::rethrow_exception(firstError);
+        }
+    }
+    
+private:
+    struct Node {
+        std::function<void()> task;
+        std::vector<size_t> dependents;
+        size_t pendingDependencies = 0;
+    };
+    
+    std::vector<Node> m_nodes;
+};
 }
 
 ToolpathGenerationPipeline::ToolpathGenerationPipeline() {
@@ -49,14 +247,26 @@ ToolpathGenerationPipeline::ToolpathGenerationPipeline() {
 
 ToolpathGenerationPipeline::PipelineResult 
 ToolpathGenerationPipeline::executePipeline(const PipelineInputs& inputs) {
+    return executePipeline(inputs, nullptr);
+}
+
+ToolpathGenerationPipeline::PipelineResult 
+ToolpathGenerationPipeline::executePipeline(const PipelineInputs& inputs,
+                                            std::function<void(double, const std::string&)> progressCallback) {
+    TRACE_SPAN("pipeline", "ToolpathGenerationPipeline::executePipeline");
     auto startTime = std::chrono::high_resolution_clock::now();
     
     PipelineResult result;
     result.success = false;
+    result.progressCallback = std::move(progressCallback);
     
     // Mark as generating
     m_isGenerating = true;
     m_cancelRequested = false;
+    if (m_externalCancel && *m_externalCancel) {
+        // The owning job was cancelled before the run started
+        m_cancelRequested = true;
+    }
     
     try {
         reportProgress(0.0, "Starting toolpath generation pipeline...", result);
@@ -64,246 +274,308 @@ ToolpathGenerationPipeline::executePipeline(const PipelineInputs& inputs) {
         // Initialize timeline (empty list that will store generated operations)
         result.timeline.clear();
         
+        // Every stage writes into its own slot; the timeline is assembled from the
+        // slots in chronological order, so scheduling never affects the result.
+        StageTaskGraph graph;
+        std::vector<ToolpathList> stageOutputs;
+        std::vector<std::string> stageNames;
+        stageOutputs.reserve(11);
+        stageNames.reserve(11);
+        
+        std::mutex progressMutex;
+        size_t completedStages = 0;
+        
+        // Stages whose input slice hashes to the cached key are reused verbatim
+        std::shared_ptr<PipelineStageCache> stageCache = m_stageCache;
+        
+        auto addStage = [&](const std::string& name,
+                            std::uint64_t key,
+                            std::function<ToolpathList()> generate,
+                            std::vector<size_t> dependencies = {}) {
+            size_t slot = stageOutputs.size();
+            stageOutputs.emplace_back();
+            stageNames.push_back(name);
+            // Cached outputs are stored compressed
+            key = StageKey().add(key).add(inputs.compressionTolerance).value();
+            return graph.addTask([&, slot, key, generate = std::move(generate)]() {
+                TRACE_SPAN("pipeline", "stage: " + stageNames[slot]);
+                if (!stageCache || !stageCache->lookup(stageNames[slot], key, stageOutputs[slot])) {
+                    stageOutputs[slot] = generate();
+                    for (auto& toolpath : stageOutputs[slot]) {
+                        if (toolpath && inputs.compressionTolerance > 0.0) {
+                            toolpath->optimizeToolpath(inputs.compressionTolerance);
+                        }
+                    }
+                    // A cancelled stage may be incomplete and must not be memoized
+                    if (stageCache && !m_cancelRequested) {
+                        stageCache->store(stageNames[slot], key, stageOutputs[slot]);
+                    }
+                }
+                
+                std::lock_guard<std::mutex> lock(progressMutex);
+                ++completedStages;
+                double progress = 0.05 + 0.9 * static_cast<double>(completedStages) / graph.size();
+                reportProgress(progress, "Generated " + stageNames[slot] + " toolpaths", result);
+            }, std::move(dependencies));
+        };
+        
         // -----------------------------------------------------------------------
         // 3.1  Facing – always FIRST: establish reference surface at Z-max
         // -----------------------------------------------------------------------
         if (inputs.facing) {
-            reportProgress(0.1, "Generating facing toolpaths...", result);
-            
-            double depthOfCut = 1.0; // mm - placeholder
-            int passes = static_cast<int>(std::floor(inputs.facingAllowance / depthOfCut));
-            
-            for (int i = 0; i < passes; ++i) {
-                if (m_cancelRequested) {
-                    result.errorMessage = "Generation cancelled by user";
-                    m_isGenerating = false;
-                    return result;
+            std::uint64_t key = StageKey().add(inputs.z0).add(inputs.rawMaterialDiameter)
+                    .add(inputs.facingAllowance).add(inputs.facingTool).value();
+            addStage("facing", key, [this, &inputs]() {
+                ToolpathList toolpaths;
+                double depthOfCut = 1.0; // mm - placeholder
+                int passes = static_cast<int>(std::floor(inputs.facingAllowance / depthOfCut));
+                
+                for (int i = 0; i < passes; ++i) {
+                    if (m_cancelRequested) {
+                        return toolpaths;
+                    }
+                    
+                    // LATHE COORDINATE SYSTEM: X=axial, Y=0 (constrained), Z=radius
+                    IntuiCAM::Geometry::Point3D coordinates(
+                        inputs.z0 - i * depthOfCut,  // X = axial position (was Z coordinate)
+                        0.0,                         // Y = 0 (constrained to XZ plane)
+                        inputs.rawMaterialDiameter / 2.0 + 5  // Z = radius (was X coordinate)
+                    );
+                    IntuiCAM::Geometry::Point3D startPos(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0 + 5);
+                    IntuiCAM::Geometry::Point3D endPos(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0 + 5);
+                    
+                    appendToolpaths(toolpaths, facingToolpath(coordinates, startPos, endPos, inputs.facingTool));
                 }
                 
-                // LATHE COORDINATE SYSTEM: X=axial, Y=0 (constrained), Z=radius
-                IntuiCAM::Geometry::Point3D coordinates(
-                    inputs.z0 - i * depthOfCut,  // X = axial position (was Z coordinate)
-                    0.0,                         // Y = 0 (constrained to XZ plane)
-                    inputs.rawMaterialDiameter / 2.0 + 5  // Z = radius (was X coordinate)
-                );
+                // One final facing pass to finish to dimension
+                IntuiCAM::Geometry::Point3D finalCoord(
+                    inputs.z0 - inputs.facingAllowance, 0.0, inputs.rawMaterialDiameter / 2.0 + 5);
                 IntuiCAM::Geometry::Point3D startPos(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0 + 5);
                 IntuiCAM::Geometry::Point3D endPos(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0 + 5);
-                
-                auto facingPasses = facingToolpath(coordinates, startPos, endPos, inputs.facingTool);
-                for (auto& tp : facingPasses) {
-                    result.timeline.push_back(std::move(tp));
-                }
-            }
-            
-            // One final facing pass to finish to dimension
-            IntuiCAM::Geometry::Point3D finalCoord(
-                inputs.z0 - inputs.facingAllowance, 0.0, inputs.rawMaterialDiameter / 2.0 + 5);
-            IntuiCAM::Geometry::Point3D startPos(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0 + 5);
-            IntuiCAM::Geometry::Point3D endPos(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0 + 5);
-            auto finalFacing = facingToolpath(finalCoord, startPos, endPos, inputs.facingTool);
-            for (auto& tp : finalFacing) {
-                result.timeline.push_back(std::move(tp));
-            }
+                appendToolpaths(toolpaths, facingToolpath(finalCoord, startPos, endPos, inputs.facingTool));
+                return toolpaths;
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.2  Drilling and Boring (Internal Features)
         // -----------------------------------------------------------------------
         if (inputs.drilling && inputs.machineInternalFeatures) {
-            reportProgress(0.2, "Generating drilling toolpaths...", result);
-            
-            std::vector<double> diameters = {6.0, 8.0, 10.0, 12.0}; // Example diameters
-            for (double d : diameters) {
-                if (d > inputs.largestDrillSize) {
-                    // Boring operation - placeholder
-                    continue;
-                }
-                
-                for (const auto& feature : inputs.featuresToBeDrilled) {
-                    if (m_cancelRequested) {
-                        result.errorMessage = "Generation cancelled by user";
-                        m_isGenerating = false;
-                        return result;
+            std::uint64_t key = StageKey().add(inputs.largestDrillSize).add(inputs.featuresToBeDrilled).value();
+            addStage("drilling", key, [this, &inputs]() {
+                ToolpathList toolpaths;
+                std::vector<double> diameters = {6.0, 8.0, 10.0, 12.0}; // Example diameters
+                for (double d : diameters) {
+                    if (d > inputs.largestDrillSize) {
+                        // Boring operation - placeholder
+                        continue;
                     }
                     
-                    auto drillingPaths = drillingToolpath(feature.depth, feature.tool);
-                    for (auto& tp : drillingPaths) {
-                        result.timeline.push_back(std::move(tp));
+                    for (const auto& feature : inputs.featuresToBeDrilled) {
+                        if (m_cancelRequested) {
+                            return toolpaths;
+                        }
+                        appendToolpaths(toolpaths, drillingToolpath(feature.depth, feature.tool));
                     }
                 }
-            }
+                return toolpaths;
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.3  Internal Roughing
         // -----------------------------------------------------------------------
         if (inputs.internalRoughing && inputs.machineInternalFeatures) {
-            reportProgress(0.3, "Generating internal roughing toolpaths...", result);
-            
-            IntuiCAM::Geometry::Point3D coordinates(inputs.z0, 0.0, 0.0);
-            auto internalRoughingPaths = internalRoughingToolpath(
-                coordinates, inputs.internalRoughingTool, inputs.profile2D);
-            for (auto& tp : internalRoughingPaths) {
-                result.timeline.push_back(std::move(tp));
-            }
+            std::uint64_t key = StageKey().add(inputs.z0).add(inputs.internalRoughingTool).add(inputs.profile2D).value();
+            addStage("internal roughing", key, [this, &inputs]() {
+                IntuiCAM::Geometry::Point3D coordinates(inputs.z0, 0.0, 0.0);
+                return internalRoughingToolpath(coordinates, inputs.internalRoughingTool, inputs.profile2D);
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.4  Internal Finishing
         // -----------------------------------------------------------------------
         if (inputs.internalFinishing && inputs.machineInternalFeatures) {
-            reportProgress(0.4, "Generating internal finishing toolpaths...", result);
-            
-            for (int pass = 0; pass < inputs.internalFinishingPasses; ++pass) {
-                if (m_cancelRequested) {
-                    result.errorMessage = "Generation cancelled by user";
-                    m_isGenerating = false;
-                    return result;
-                }
-                
-                IntuiCAM::Geometry::Point3D coordinates(inputs.z0, 0.0, 0.0);
-                auto internalFinishingPaths = internalFinishingToolpath(
-                    coordinates, inputs.internalFinishingTool, inputs.profile2D);
-                for (auto& tp : internalFinishingPaths) {
-                    result.timeline.push_back(std::move(tp));
+            std::uint64_t key = StageKey().add(inputs.z0).add(inputs.internalFinishingPasses)
+                    .add(inputs.internalFinishingTool).add(inputs.profile2D).value();
+            addStage("internal finishing", key, [this, &inputs]() {
+                ToolpathList toolpaths;
+                for (int pass = 0; pass < inputs.internalFinishingPasses; ++pass) {
+                    if (m_cancelRequested) {
+                        return toolpaths;
+                    }
+                    
+                    IntuiCAM::Geometry::Point3D coordinates(inputs.z0, 0.0, 0.0);
+                    appendToolpaths(toolpaths, internalFinishingToolpath(
+                        coordinates, inputs.internalFinishingTool, inputs.profile2D));
                 }
-            }
+                return toolpaths;
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.5  Internal Grooving
         // -----------------------------------------------------------------------
         if (inputs.internalGrooving && inputs.machineInternalFeatures) {
-            reportProgress(0.5, "Generating internal grooving toolpaths...", result);
-            
-            for (const auto& groove : inputs.internalFeaturesToBeGrooved) {
-                if (m_cancelRequested) {
-                    result.errorMessage = "Generation cancelled by user";
-                    m_isGenerating = false;
-                    return result;
-                }
-                
-                auto groovingPaths = internalGroovingToolpath(
-                    groove.coordinates, groove.geometry, groove.tool, groove.chamferEdges);
-                for (auto& tp : groovingPaths) {
-                    result.timeline.push_back(std::move(tp));
+            std::uint64_t key = StageKey().add(inputs.internalFeaturesToBeGrooved).value();
+            addStage("internal grooving", key, [this, &inputs]() {
+                ToolpathList toolpaths;
+                for (const auto& groove : inputs.internalFeaturesToBeGrooved) {
+                    if (m_cancelRequested) {
+                        return toolpaths;
+                    }
+                    appendToolpaths(toolpaths, internalGroovingToolpath(
+                        groove.coordinates, groove.geometry, groove.tool, groove.chamferEdges));
                 }
-            }
+                return toolpaths;
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.6  External Roughing
         // -----------------------------------------------------------------------
         if (inputs.externalRoughing) {
-            reportProgress(0.6, "Generating external roughing toolpaths...", result);
-            
-            IntuiCAM::Geometry::Point3D coordinates(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0);
-            auto roughingPaths = externalRoughingToolpath(
-                coordinates, inputs.externalRoughingTool, inputs.profile2D
-            );
-            for (auto& tp : roughingPaths) {
-                result.timeline.push_back(std::move(tp));
-            }
+            std::uint64_t key = StageKey().add(inputs.z0).add(inputs.rawMaterialDiameter)
+                    .add(inputs.externalRoughingTool).add(inputs.profile2D).value();
+            addStage("external roughing", key, [this, &inputs]() {
+                IntuiCAM::Geometry::Point3D coordinates(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0);
+                return externalRoughingToolpath(coordinates, inputs.externalRoughingTool, inputs.profile2D);
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.7  External Finishing
         // -----------------------------------------------------------------------
         if (inputs.externalFinishing) {
-            reportProgress(0.7, "Generating external finishing toolpaths...", result);
-            
-            for (int pass = 0; pass < inputs.externalFinishingPasses; ++pass) {
-                if (m_cancelRequested) {
-                    result.errorMessage = "Generation cancelled by user";
-                    m_isGenerating = false;
-                    return result;
-                }
-                
-                IntuiCAM::Geometry::Point3D coordinates(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0);
-                auto finishingPaths = externalFinishingToolpath(
-                    coordinates, inputs.externalFinishingTool, inputs.profile2D
-                );
-                for (auto& tp : finishingPaths) {
-                    result.timeline.push_back(std::move(tp));
+            std::uint64_t key = StageKey().add(inputs.z0).add(inputs.rawMaterialDiameter).add(inputs.externalFinishingPasses)
+                    .add(inputs.externalFinishingTool).add(inputs.profile2D).value();
+            addStage("external finishing", key, [this, &inputs]() {
+                ToolpathList toolpaths;
+                for (int pass = 0; pass < inputs.externalFinishingPasses; ++pass) {
+                    if (m_cancelRequested) {
+                        return toolpaths;
+                    }
+                    
+                    IntuiCAM::Geometry::Point3D coordinates(inputs.z0, 0.0, inputs.rawMaterialDiameter / 2.0);
+                    appendToolpaths(toolpaths, externalFinishingToolpath(
+                        coordinates, inputs.externalFinishingTool, inputs.profile2D));
                 }
-            }
+                return toolpaths;
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.8  External Grooving
         // -----------------------------------------------------------------------
         if (inputs.externalGrooving) {
-            reportProgress(0.75, "Generating external grooving toolpaths...", result);
-            
-            for (const auto& groove : inputs.externalFeaturesToBeGrooved) {
-                if (m_cancelRequested) {
-                    result.errorMessage = "Generation cancelled by user";
-                    m_isGenerating = false;
-                    return result;
-                }
-                
-                auto groovingPaths = externalGroovingToolpath(
-                    groove.coordinates, groove.geometry, groove.tool, groove.chamferEdges);
-                for (auto& tp : groovingPaths) {
-                    result.timeline.push_back(std::move(tp));
+            std::uint64_t key = StageKey().add(inputs.externalFeaturesToBeGrooved).value();
+            addStage("external grooving", key, [this, &inputs]() {
+                ToolpathList toolpaths;
+                for (const auto& groove : inputs.externalFeaturesToBeGrooved) {
+                    if (m_cancelRequested) {
+                        return toolpaths;
+                    }
+                    appendToolpaths(toolpaths, externalGroovingToolpath(
+                        groove.coordinates, groove.geometry, groove.tool, groove.chamferEdges));
                 }
-            }
+                return toolpaths;
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.9  Chamfering
         // -----------------------------------------------------------------------
         if (inputs.chamfering) {
-            reportProgress(0.8, "Generating chamfering toolpaths...", result);
-            
-            for (const auto& chamfer : inputs.featuresToBeChamfered) {
-                if (m_cancelRequested) {
-                    result.errorMessage = "Generation cancelled by user";
-                    m_isGenerating = false;
-                    return result;
-                }
-                
-                auto chamferPaths = chamferingToolpath(
-                    chamfer.coordinates, chamfer.geometry, chamfer.tool);
-                for (auto& tp : chamferPaths) {
-                    result.timeline.push_back(std::move(tp));
+            std::uint64_t key = StageKey().add(inputs.featuresToBeChamfered).value();
+            addStage("chamfering", key, [this, &inputs]() {
+                ToolpathList toolpaths;
+                for (const auto& chamfer : inputs.featuresToBeChamfered) {
+                    if (m_cancelRequested) {
+                        return toolpaths;
+                    }
+                    appendToolpaths(toolpaths, chamferingToolpath(
+                        chamfer.coordinates, chamfer.geometry, chamfer.tool));
                 }
-            }
+                return toolpaths;
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.10 Threading
         // -----------------------------------------------------------------------
         if (inputs.threading) {
-            reportProgress(0.8, "Generating threading toolpaths...", result);
-            for (const auto& thread : inputs.featuresToBeThreaded) {
-                if (m_cancelRequested) {
-                    result.errorMessage = "Generation cancelled by user";
-                    m_isGenerating = false;
-                    return result;
-                }
-                
-                auto threadPaths = threadingToolpath(
-                    thread.coordinates, thread.geometry, thread.tool
-                );
-                for (auto& tp : threadPaths) {
-                    result.timeline.push_back(std::move(tp));
+            std::uint64_t key = StageKey().add(inputs.featuresToBeThreaded).value();
+            addStage("threading", key, [this, &inputs]() {
+                ToolpathList toolpaths;
+                for (const auto& thread : inputs.featuresToBeThreaded) {
+                    if (m_cancelRequested) {
+                        return toolpaths;
+                    }
+                    appendToolpaths(toolpaths, threadingToolpath(
+                        thread.coordinates, thread.geometry, thread.tool));
                 }
-            }
+                return toolpaths;
+            });
         }
 
         // -----------------------------------------------------------------------
         // 3.11 Parting – always LAST
         // -----------------------------------------------------------------------
         if (inputs.parting) {
-            reportProgress(0.9, "Generating parting toolpaths...", result);
-            
-            IntuiCAM::Geometry::Point3D partingCoordinates(
-                inputs.z0 - inputs.partLength - inputs.partingAllowance, 0.0, 0.0);
-            auto partingPaths = partingToolpath(partingCoordinates, inputs.partingTool, false);
-            for (auto& tp : partingPaths) {
-                result.timeline.push_back(std::move(tp));
+            std::uint64_t key = StageKey().add(inputs.z0).add(inputs.partLength)
+                    .add(inputs.partingAllowance).add(inputs.partingTool).value();
+            addStage("parting", key, [this, &inputs]() {
+                IntuiCAM::Geometry::Point3D partingCoordinates(
+                    inputs.z0 - inputs.partLength - inputs.partingAllowance, 0.0, 0.0);
+                return partingToolpath(partingCoordinates, inputs.partingTool, false);
+            });
+        }
+
+        // Every stage above reads only PipelineInputs and the shared profile, so
+        // none declares dependencies and all of them may run concurrently.
+        size_t workerCount = inputs.maxParallelStages > 0
+            ? static_cast<size_t>(inputs.maxParallelStages)
+            : std::max(1u, std::thread::hardware_concurrency());
+        reportProgress(0.05, "Generating toolpaths for " + std::to_string(graph.size()) + " stages...", result);
+        graph.run(workerCount, m_cancelRequested);
+        
+        if (checkCancelled(result)) {
+            return result;
+        }
+        
+        for (size_t slot = 0; slot < stageOutputs.size(); ++slot) {
+            // Operations leave most moves unlabelled; the linker needs to know
+            // which toolpaths cut the outside of the stock
+            for (auto& toolpath : stageOutputs[slot]) {
+                if (toolpath) {
+                    toolpath->setOperationType(stageOperationType(stageNames[slot]));
+                }
             }
+            appendToolpaths(result.timeline, std::move(stageOutputs[slot]));
+        }
+        TRACE_COUNTER("pipeline", "timeline toolpaths", result.timeline.size());
+        
+        if (inputs.linkRapids) {
+            TRACE_SPAN("pipeline", "ToolpathLinker::link");
+            ToolpathLinker::Parameters linkParams;
+            linkParams.stockRadius = inputs.rawMaterialDiameter / 2.0;
+            linkParams.stockFrontZ = inputs.z0;
+            linkParams.stockBackZ = inputs.z0 - inputs.rawMaterialLength;
+            linkParams.clearance = inputs.linkClearance;
+            result.linking = ToolpathLinker(linkParams).link(result.timeline);
+            reportProgress(0.97, "Linked " + std::to_string(result.linking.linksRerouted) +
+                           " rapid moves between passes", result);
+        }
+        
+        if (inputs.constantSurfaceSpeed) {
+            TRACE_SPAN("pipeline", "FeedSpeedPlanner::plan");
+            FeedSpeedPlanner::Parameters planParams;
+            planParams.material = OperationParameterManager::getMaterialProperties(inputs.materialType);
+            planParams.maxSpindleSpeed = inputs.maxSpindleSpeed;
+            result.feedSpeedPlan = FeedSpeedPlanner(planParams).plan(result.timeline);
+            reportProgress(0.98, "Planned surface speed and feed for " +
+                           std::to_string(result.feedSpeedPlan.movesPlanned) + " moves", result);
         }
 
         // Finalize result
@@ -373,6 +645,19 @@ void ToolpathGenerationPipeline::cancelGeneration() {
     m_cancelRequested = true;
 }
 
+std::shared_ptr<PipelineJob> ToolpathGenerationPipeline::executePipelineAsync(
+    const PipelineInputs& inputs,
+    std::function<void(double, const std::string&)> progressCallback,
+    std::function<void(const std::shared_ptr<PipelineJob>&)> completionCallback,
+    std::shared_ptr<PipelineStageCache> stageCache) {
+    
+    std::shared_ptr<PipelineJob> job(
+        new PipelineJob(inputs, std::move(progressCallback), std::move(completionCallback)));
+    job->m_pipeline.setStageCache(std::move(stageCache));
+    job->start();
+    return job;
+}
+
 // Real implementations for toolpath generation functions using actual operation classes
 std::vector<std::unique_ptr<Toolpath>> ToolpathGenerationPipeline::facingToolpath(
     const IntuiCAM::Geometry::Point3D& coordinates,
@@ -1048,80 +1333,56 @@ std::vector<std::unique_ptr<Toolpath>> ToolpathGenerationPipeline::partingToolpa
 }
 
 std::vector<Handle(AIS_InteractiveObject)> ToolpathGenerationPipeline::createToolpathDisplayObjects(
-    const std::vector<std::unique_ptr<Toolpath>>& toolpaths,
+    std::vector<std::unique_ptr<Toolpath>> toolpaths,
     const gp_Trsf& workpieceTransform) {
+    TRACE_SPAN("display", "ToolpathGenerationPipeline::createToolpathDisplayObjects");
     
     std::vector<Handle(AIS_InteractiveObject)> displayObjects;
+    displayObjects.reserve(toolpaths.size());
     
-    // Create display objects for each toolpath
-    for (const auto& toolpath : toolpaths) {
+    // Create display objects for each toolpath. Each object takes over its
+    // toolpath instead of copying the moves, which it uploads as primitive
+    // arrays; the workpiece pose is applied as a presentation transform
+    // instead of rebuilding any topology.
+    for (auto& toolpath : toolpaths) {
         if (!toolpath || toolpath->getMovements().empty()) {
             continue;
         }
         
         try {
-            // Create wire from toolpath movements
-            BRepBuilderAPI_MakeWire wireBuilder;
-            const auto& movements = toolpath->getMovements();
+            std::shared_ptr<const Toolpath> sharedToolpath = std::move(toolpath);
+            Handle(ToolpathDisplayObject) displayObject = ToolpathDisplayObject::create(sharedToolpath);
             
-            for (size_t i = 0; i < movements.size() - 1; ++i) {
-                const auto& currentMove = movements[i];
-                const auto& nextMove = movements[i + 1];
-                
-                // Movements are stored with axial position in the X component
-                // and radial position in the Z component.  Convert them to the
-                // standard lathe viewer coordinates where X is radius and Z is
-                // axial.
-                gp_Pnt start(currentMove.position.z, currentMove.position.y, currentMove.position.x);
-                gp_Pnt end(nextMove.position.z, nextMove.position.y, nextMove.position.x);
-                
-                if (start.Distance(end) > Precision::Confusion()) {
-                    BRepBuilderAPI_MakeEdge edgeBuilder(start, end);
-                    if (edgeBuilder.IsDone()) {
-                        wireBuilder.Add(edgeBuilder.Edge());
-                    }
-                }
+            // Set color based on operation type
+            Quantity_Color color;
+            switch (sharedToolpath->getOperationType()) {
+                case OperationType::Facing:
+                    color = Quantity_Color(0.0, 1.0, 0.0, Quantity_TOC_RGB); // Green
+                    break;
+                case OperationType::ExternalRoughing:
+                case OperationType::InternalRoughing:
+                    color = Quantity_Color(1.0, 0.0, 0.0, Quantity_TOC_RGB); // Red
+                    break;
+                case OperationType::ExternalFinishing:
+                case OperationType::InternalFinishing:
+                    color = Quantity_Color(0.0, 0.0, 1.0, Quantity_TOC_RGB); // Blue
+                    break;
+                case OperationType::Parting:
+                    color = Quantity_Color(1.0, 1.0, 0.0, Quantity_TOC_RGB); // Yellow
+                    break;
+                default:
+                    color = Quantity_Color(0.5, 0.5, 0.5, Quantity_TOC_RGB); // Gray
+                    break;
             }
+            displayObject->setCustomColor(color);
             
-            if (wireBuilder.IsDone()) {
-                TopoDS_Wire wire = wireBuilder.Wire();
-                
-                // Apply workpiece transform if provided
-                if (workpieceTransform.Form() != gp_Identity) {
-                    BRepBuilderAPI_Transform transformer(wire, workpieceTransform);
-                    if (transformer.IsDone()) {
-                        wire = TopoDS::Wire(transformer.Shape());
-                    }
-                }
-                
-                Handle(AIS_Shape) aisShape = new AIS_Shape(wire);
-                
-                // Set color based on operation type
-                Quantity_Color color;
-                switch (toolpath->getOperationType()) {
-                    case OperationType::Facing:
-                        color = Quantity_Color(0.0, 1.0, 0.0, Quantity_TOC_RGB); // Green
-                        break;
-                    case OperationType::ExternalRoughing:
-                    case OperationType::InternalRoughing:
-                        color = Quantity_Color(1.0, 0.0, 0.0, Quantity_TOC_RGB); // Red
-                        break;
-                    case OperationType::ExternalFinishing:
-                    case OperationType::InternalFinishing:
-                        color = Quantity_Color(0.0, 0.0, 1.0, Quantity_TOC_RGB); // Blue
-                        break;
-                    case OperationType::Parting:
-                        color = Quantity_Color(1.0, 1.0, 0.0, Quantity_TOC_RGB); // Yellow
-                        break;
-                    default:
-                        color = Quantity_Color(0.5, 0.5, 0.5, Quantity_TOC_RGB); // Gray
-                        break;
-                }
-                
-                aisShape->SetColor(color);
-                displayObjects.push_back(aisShape);
+            // Apply workpiece transform if provided
+            if (workpieceTransform.Form() != gp_Identity) {
+                displayObject->SetLocalTransformation(workpieceTransform);
             }
             
+            displayObjects.push_back(displayObject);
+            
         } catch (const std::exception& e) {
             // Log error but continue with other toolpaths
             continue;
@@ -1137,5 +1398,164 @@ void ToolpathGenerationPipeline::reportProgress(double progress, const std::stri
     }
 }
 
+bool ToolpathGenerationPipeline::checkCancelled(PipelineResult& result) {
+    if (!m_cancelRequested) {
+        return false;
+    }
+    result.success = false;
+    result.errorMessage = "Generation cancelled by user";
+    m_isGenerating = false;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// PipelineStageCache
+// ---------------------------------------------------------------------------
+
+bool PipelineStageCache::lookup(const std::string& stage, std::uint64_t key,
+                                std::vector<std::unique_ptr<Toolpath>>& toolpaths) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(stage);
+    if (it == m_entries.end() || it->second.key != key) {
+        ++m_misses;
+        return false;
+    }
+    
+    toolpaths.clear();
+    toolpaths.reserve(it->second.toolpaths.size());
+    for (const auto& tp : it->second.toolpaths) {
+        toolpaths.push_back(std::make_unique<Toolpath>(*tp));
+    }
+    ++m_hits;
+    return true;
+}
+
+void PipelineStageCache::store(const std::string& stage, std::uint64_t key,
+                               const std::vector<std::unique_ptr<Toolpath>>& toolpaths) {
+    Entry entry;
+    entry.key = key;
+    entry.toolpaths.reserve(toolpaths.size());
+    for (const auto& tp : toolpaths) {
+        if (tp) {
+            entry.toolpaths.push_back(std::make_unique<Toolpath>(*tp));
+        }
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[stage] = std::move(entry);
+}
+
+void PipelineStageCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+// ---------------------------------------------------------------------------
+// PipelineJob
+// ---------------------------------------------------------------------------
+
+namespace {
+std::atomic<std::uint64_t> g_nextPipelineJobId{1};
+}
+
+PipelineJob::PipelineJob(const ToolpathGenerationPipeline::PipelineInputs& inputs,
+                         ProgressCallback progressCallback,
+                         CompletionCallback completionCallback)
+    : m_id(g_nextPipelineJobId++)
+    , m_inputs(inputs)
+    , m_progressCallback(std::move(progressCallback))
+    , m_completionCallback(std::move(completionCallback)) {
+    m_pipeline.m_externalCancel = &m_cancelRequested;
+}
+
+void PipelineJob::start() {
+    // The worker holds a strong reference so the job outlives a dropped handle
+    std::thread([self = shared_from_this()]() {
+        self->run();
+    }).detach();
+}
+
+void PipelineJob::run() {
+    ToolpathGenerationPipeline::PipelineResult result;
+    
+    if (!m_cancelRequested) {
+        result = m_pipeline.executePipeline(m_inputs,
+            [this](double progress, const std::string& status) {
+                m_progress = progress;
+                if (m_cancelRequested) {
+                    // executePipeline() clears the pipeline flag on entry; re-arm it
+                    m_pipeline.cancelGeneration();
+                    return;
+                }
+                if (m_progressCallback) {
+                    m_progressCallback(progress, status);
+                }
+            });
+    } else {
+        result.errorMessage = "Generation cancelled by user";
+    }
+    result.progressCallback = nullptr;
+    
+    State finalState = State::Completed;
+    if (m_cancelRequested) {
+        finalState = State::Cancelled;
+    } else if (!result.success) {
+        finalState = State::Failed;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_result = std::move(result);
+        m_state = finalState;
+    }
+    
+    // Run and release the callbacks before waiters are woken, so a caller that
+    // cancels and waits may destroy whatever the callbacks captured
+    CompletionCallback completion = std::move(m_completionCallback);
+    m_completionCallback = nullptr;
+    m_progressCallback = nullptr;
+    if (completion) {
+        completion(shared_from_this());
+        completion = nullptr;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished = true;
+    }
+    m_finishedCondition.notify_all();
+}
+
+void PipelineJob::cancel() {
+    m_cancelRequested = true;
+    m_pipeline.cancelGeneration();
+}
+
+bool PipelineJob::isFinished() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_finished;
+}
+
+void PipelineJob::wait() const {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finishedCondition.wait(lock, [this]() { return m_finished; });
+}
+
+bool PipelineJob::waitFor(std::chrono::milliseconds timeout) const {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_finishedCondition.wait_for(lock, timeout, [this]() { return m_finished; });
+}
+
+ToolpathGenerationPipeline::PipelineResult PipelineJob::takeResult() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_state == State::Running || m_resultTaken) {
+        ToolpathGenerationPipeline::PipelineResult empty;
+        empty.errorMessage = m_resultTaken ? "Result already taken" : "Generation still running";
+        return empty;
+    }
+    m_resultTaken = true;
+    return std::move(m_result);
+}
+
 } // namespace Toolpath
 } // namespace IntuiCAM
@@ -0,0 +1,284 @@
+#include <IntuiCAM/Toolpath/ToolpathLinker.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace IntuiCAM {
+namespace Toolpath {
+
+namespace {
+
+bool isCut(MovementType type) {
+    return type == MovementType::Linear || type == MovementType::CircularCW ||
+           type == MovementType::CircularCCW;
+}
+
+// Operations that cut the outside of the stock from outside; only these may
+// lower the outer envelope
+bool cutsOuterEnvelope(OperationType type) {
+    return type == OperationType::Facing || type == OperationType::ExternalRoughing ||
+           type == OperationType::ExternalFinishing;
+}
+
+double distance(const Geometry::Point3D& a, const Geometry::Point3D& b) {
+    return std::sqrt((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y) + (b.z - a.z) * (b.z - a.z));
+}
+
+double pathLength(const Geometry::Point3D& start, const std::vector<Geometry::Point3D>& points) {
+    double length = 0.0;
+    const Geometry::Point3D* previous = &start;
+    for (const auto& point : points) {
+        length += distance(*previous, point);
+        previous = &point;
+    }
+    return length;
+}
+
+// Point where segment a-b reaches radius @p radius; a.z < radius <= b.z
+Geometry::Point3D pointAtRadius(const Geometry::Point3D& a, const Geometry::Point3D& b, double radius) {
+    const double t = (radius - a.z) / (b.z - a.z);
+    return Geometry::Point3D(a.x + t * (b.x - a.x), a.y + t * (b.y - a.y), radius);
+}
+
+// Drop repeated points and interior points of straight runs
+void mergeCollinear(const Geometry::Point3D& start, std::vector<Geometry::Point3D>& points) {
+    std::vector<Geometry::Point3D> merged;
+    merged.reserve(points.size());
+    for (const auto& point : points) {
+        const Geometry::Point3D& previous = merged.empty() ? start : merged.back();
+        if (distance(previous, point) < 1e-9) {
+            continue;
+        }
+        if (!merged.empty()) {
+            const Geometry::Point3D& before = merged.size() > 1 ? merged[merged.size() - 2] : start;
+            const double ux = previous.x - before.x;
+            const double uz = previous.z - before.z;
+            const double vx = point.x - previous.x;
+            const double vz = point.z - previous.z;
+            if (std::abs(ux * vz - uz * vx) < 1e-9 * (std::hypot(ux, uz) * std::hypot(vx, vz) + 1e-12) &&
+                ux * vx + uz * vz > 0.0) {
+                merged.back() = point;
+                continue;
+            }
+        }
+        merged.push_back(point);
+    }
+    points = std::move(merged);
+}
+
+} // namespace
+
+ToolpathLinker::StockEnvelope::StockEnvelope(const Parameters& params)
+    : params_(params) {
+    const double length = std::max(0.0, params.stockFrontZ - params.stockBackZ);
+    const size_t bins = static_cast<size_t>(std::ceil(length / params.binWidth));
+    radius_.assign(std::max<size_t>(bins, 1), params.stockRadius);
+}
+
+double ToolpathLinker::StockEnvelope::maxRadius(double x0, double x1) const {
+    if (x0 > x1) {
+        std::swap(x0, x1);
+    }
+    if (x0 < params_.stockBackZ) {
+        return std::numeric_limits<double>::infinity();  // Chuck side
+    }
+    if (x0 > params_.stockFrontZ) {
+        return 0.0;  // In front of the stock
+    }
+
+    const auto first = static_cast<size_t>((x0 - params_.stockBackZ) / params_.binWidth);
+    const auto last = static_cast<size_t>(
+        std::max(0.0, (std::min(x1, params_.stockFrontZ) - params_.stockBackZ) / params_.binWidth));
+    double highest = 0.0;
+    for (size_t i = first; i <= last && i < radius_.size(); ++i) {
+        highest = std::max(highest, radius_[i]);
+    }
+    return highest;
+}
+
+void ToolpathLinker::StockEnvelope::recordCut(const Movement& move) {
+    const Geometry::Point3D& start = move.startPoint;
+    const Geometry::Point3D& end = move.position;
+
+    if (std::abs(end.x - start.x) < 1e-6) {
+        // A facing cut at a constant axial position clears everything in front
+        // of it that lies within the radial range it swept
+        if (move.operationType != OperationType::Facing) {
+            return;
+        }
+        const double top = std::max(start.z, end.z);
+        const double bottom = std::min(start.z, end.z);
+        const double first = std::ceil((end.x - params_.stockBackZ) / params_.binWidth - 1e-9);
+        for (size_t i = static_cast<size_t>(std::max(0.0, first)); i < radius_.size(); ++i) {
+            if (radius_[i] <= top) {
+                radius_[i] = std::min(radius_[i], bottom);
+            }
+        }
+        return;
+    }
+
+    // The tool came in from outside, so nothing is left above its path.
+    // Arcs may bulge above their end points.
+    double highest = std::max(start.z, end.z);
+    if (move.type != MovementType::Linear) {
+        const double arcRadius = std::hypot(start.x - move.center.x, start.z - move.center.z);
+        if (move.center.x > std::min(start.x, end.x) && move.center.x < std::max(start.x, end.x)) {
+            highest = std::max(highest, move.center.z + arcRadius);
+        }
+    }
+    lowerBins(start.x, end.x, highest);
+}
+
+void ToolpathLinker::StockEnvelope::lowerBins(double x0, double x1, double radius) {
+    if (x0 > x1) {
+        std::swap(x0, x1);
+    }
+    const double first = std::max(0.0, std::ceil((x0 - params_.stockBackZ) / params_.binWidth - 1e-9));
+    const double end = std::min(static_cast<double>(radius_.size()),
+                                std::floor((x1 - params_.stockBackZ) / params_.binWidth + 1e-9));
+    for (size_t i = static_cast<size_t>(first); static_cast<double>(i) < end; ++i) {
+        radius_[i] = std::min(radius_[i], radius);
+    }
+}
+
+ToolpathLinker::Report ToolpathLinker::link(std::vector<std::unique_ptr<Toolpath>>& timeline) const {
+    Report report;
+    StockEnvelope envelope(params_);
+
+    for (auto& toolpath : timeline) {
+        if (!toolpath) {
+            continue;
+        }
+        report.timeBefore += toolpath->estimateMachiningTime();
+        if (auto linked = linkToolpath(*toolpath, envelope, report)) {
+            toolpath = std::move(linked);
+        }
+        report.timeAfter += toolpath->estimateMachiningTime();
+    }
+    return report;
+}
+
+std::unique_ptr<Toolpath> ToolpathLinker::linkToolpath(const Toolpath& toolpath, StockEnvelope& envelope,
+                                                       Report& report) const {
+    const MovementView moves = toolpath.getMovements();
+    const size_t count = moves.size();
+
+    auto linked = std::make_unique<Toolpath>(toolpath.getName(), toolpath.getTool(), toolpath.getOperationType());
+    linked->reserve(count);
+    bool changed = false;
+
+    size_t i = 0;
+    while (i < count) {
+        if (moves.type(i) != MovementType::Rapid) {
+            const Movement move = moves[i];
+            // The pipeline labels whole toolpaths; operations may leave moves unlabelled
+            const OperationType kind = toolpath.getOperationType() != OperationType::Unknown
+                ? toolpath.getOperationType() : move.operationType;
+            if (isCut(move.type) && cutsOuterEnvelope(kind)) {
+                envelope.recordCut(move);
+            }
+            linked->addMovement(move);
+            ++i;
+            continue;
+        }
+
+        // Rapid chain [i, end) between two cuts
+        size_t end = i;
+        bool plain = true;
+        while (end < count && moves.type(end) == MovementType::Rapid) {
+            const Geometry::Point3D start = moves.startPoint(end);
+            const Geometry::Point3D implied = moves.position(end == 0 ? 0 : end - 1);
+            plain = plain && start.x == implied.x && start.y == implied.y && start.z == implied.z;
+            ++end;
+        }
+
+        std::vector<Geometry::Point3D> route;
+        const bool linkable = plain && i > 0 && end < count && end - i >= 2 &&
+                              isCut(moves.type(i - 1)) && isCut(moves.type(end));
+        if (linkable) {
+            const Geometry::Point3D from = moves.position(i - 1);
+            const Geometry::Point3D departure = moves.position(i);
+            const Geometry::Point3D arrivalStart = moves.position(end - 2);
+            const Geometry::Point3D to = moves.position(end - 1);
+
+            const double minX = std::min({from.x, departure.x, arrivalStart.x, to.x});
+            const double maxX = std::max({from.x, departure.x, arrivalStart.x, to.x});
+            const double height = envelope.maxRadius(minX, maxX) + params_.clearance;
+
+            // Leave along the operation's own departure move until clear of the
+            // stock; a departure that never gets there is kept whole and
+            // followed by a radial lift, if nothing is left above it
+            Geometry::Point3D leave = from;
+            bool feasible = true;
+            if (from.z < height) {
+                if (departure.z >= height) {
+                    leave = pointAtRadius(from, departure, height);
+                } else {
+                    leave = departure;
+                    feasible = envelope.maxRadius(departure.x, departure.x) <= departure.z;
+                }
+            }
+
+            // Mirror image for the arrival
+            Geometry::Point3D enter = to;
+            if (feasible && to.z < height) {
+                if (arrivalStart.z >= height) {
+                    enter = pointAtRadius(to, arrivalStart, height);
+                } else {
+                    enter = arrivalStart;
+                    feasible = envelope.maxRadius(arrivalStart.x, arrivalStart.x) <= arrivalStart.z;
+                }
+            }
+
+            if (feasible && std::isfinite(height)) {
+                route.push_back(leave);
+                route.emplace_back(leave.x, leave.y, std::max(leave.z, height));
+                route.emplace_back(enter.x, enter.y, std::max(enter.z, height));
+                route.push_back(enter);
+                route.push_back(to);
+                mergeCollinear(from, route);
+
+                std::vector<Geometry::Point3D> original;
+                for (size_t k = i; k < end; ++k) {
+                    original.push_back(moves.position(k));
+                }
+                const double before = pathLength(from, original);
+                const double after = pathLength(from, route);
+                const bool shorter = after < before - 1e-6;
+                const bool fewer = after <= before + 1e-9 && route.size() < original.size();
+                if (!shorter && !fewer) {
+                    route.clear();
+                }
+            }
+        }
+
+        if (route.empty()) {
+            for (size_t k = i; k < end; ++k) {
+                linked->addMovement(moves[k]);
+            }
+        } else {
+            const Movement first = moves[i];
+            Geometry::Point3D previous = moves.position(i - 1);
+            for (const auto& point : route) {
+                Movement rapid(MovementType::Rapid, previous, point, first.operationType);
+                rapid.operationName = first.operationName;
+                rapid.passNumber = first.passNumber;
+                linked->addMovement(rapid);
+                previous = point;
+            }
+            ++report.linksRerouted;
+            report.rapidsRemoved += (end - i) - std::min(end - i, route.size());
+            changed = true;
+        }
+        i = end;
+    }
+
+    if (!changed) {
+        return nullptr;
+    }
+    return linked;
+}
+
+} // namespace Toolpath
+} // namespace IntuiCAM
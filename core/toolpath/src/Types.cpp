@@ -1,7 +1,12 @@
+#define _USE_MATH_DEFINES
 #include <IntuiCAM/Toolpath/Types.h>
 #include <cmath>
 #include <algorithm>
 
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
 namespace IntuiCAM {
 namespace Toolpath {
 
@@ -48,183 +53,726 @@ Tool::Tool(Type type, const std::string& name)
     }
 }
 
+namespace {
+
+using SparsePoints = std::vector<std::pair<std::uint32_t, Geometry::Point3D>>;
+
+// Entry for move @p index in a table sorted by move index, or nullptr
+const Geometry::Point3D* findSparsePoint(const SparsePoints& table, size_t index) {
+    auto it = std::lower_bound(table.begin(), table.end(), index,
+        [](const std::pair<std::uint32_t, Geometry::Point3D>& entry, size_t value) {
+            return entry.first < value;
+        });
+    if (it != table.end() && it->first == index) {
+        return &it->second;
+    }
+    return nullptr;
+}
+
+bool isCircular(MovementType type) {
+    return type == MovementType::CircularCW || type == MovementType::CircularCCW;
+}
+
+// Positions closer than this are treated as the same point
+constexpr double kPointTolerance = 0.001; // 1 micron
+
+// Limits for fitting arcs to linear chains
+constexpr size_t kMaxArcWindow = 64;     // moves examined per arc fit
+constexpr double kMaxArcRadius = 5000.0; // mm - flatter chains are left to line fitting
+
+// Per-move flags for the entries of a sparse table
+std::vector<char> flagMoves(const SparsePoints& table, size_t count) {
+    std::vector<char> flags(count, 0);
+    for (const auto& entry : table) {
+        flags[entry.first] = 1;
+    }
+    return flags;
+}
+
+// Circle through three points of the (axial, radial) plane; false when collinear
+bool circleThrough(double ax, double az, double bx, double bz, double cx, double cz,
+                   double& centerX, double& centerZ, double& radius) {
+    // Work relative to the first point to keep precision at large coordinates
+    bx -= ax; bz -= az;
+    cx -= ax; cz -= az;
+    const double d = 2.0 * (bx * cz - bz * cx);
+    if (std::abs(d) < 1e-12) {
+        return false;
+    }
+    const double b2 = bx * bx + bz * bz;
+    const double c2 = cx * cx + cz * cz;
+    const double ux = (cz * b2 - bz * c2) / d;
+    const double uz = (bx * c2 - cx * b2) / d;
+    centerX = ax + ux;
+    centerZ = az + uz;
+    radius = std::hypot(ux, uz);
+    return true;
+}
+
+/**
+ * Last point of the chain from..last that a single segment starting at
+ * @p from can replace. Every point is kept within @p tolerance of the
+ * segment by narrowing a cone of admissible directions, so each point is
+ * looked at once.
+ */
+size_t longestLineFit(const std::vector<double>& xs, const std::vector<double>& zs,
+                      size_t from, size_t last, double tolerance) {
+    const double ax = xs[from];
+    const double az = zs[from];
+    double refX = 0.0;
+    double refZ = 0.0;
+    bool haveReference = false;
+    double low = -M_PI;
+    double high = M_PI;
+    double maxDistance = 0.0;
+    
+    size_t best = from + 1;
+    for (size_t j = from + 1; j <= last; ++j) {
+        const double dx = xs[j] - ax;
+        const double dz = zs[j] - az;
+        const double distance = std::hypot(dx, dz);
+        if (distance < maxDistance) {
+            break;  // Chain turns back towards the anchor
+        }
+        
+        double angle = 0.0;
+        if (haveReference) {
+            angle = std::atan2(refX * dz - refZ * dx, refX * dx + refZ * dz);
+            if (angle < low || angle > high) {
+                break;
+            }
+        } else if (distance > tolerance) {
+            haveReference = true;
+            refX = dx / distance;
+            refZ = dz / distance;
+        }
+        best = j;
+        
+        if (distance > tolerance) {
+            const double spread = std::asin(tolerance / distance);
+            low = std::max(low, angle - spread);
+            high = std::min(high, angle + spread);
+        }
+        maxDistance = distance;
+    }
+    return best;
+}
+
+struct ArcFit {
+    size_t end = 0;
+    double centerX = 0.0;
+    double centerZ = 0.0;
+    bool clockwise = false;
+};
+
+// True when points from..to and the chords between them lie within
+// @p tolerance of the arc, sweeping monotonically less than a full turn
+bool arcCoversChain(const std::vector<double>& xs, const std::vector<double>& zs,
+                    size_t from, size_t to, double centerX, double centerZ,
+                    double radius, bool clockwise, double tolerance) {
+    double sweep = 0.0;
+    for (size_t k = from + 1; k <= to; ++k) {
+        const double px = xs[k - 1] - centerX;
+        const double pz = zs[k - 1] - centerZ;
+        const double qx = xs[k] - centerX;
+        const double qz = zs[k] - centerZ;
+        if (std::abs(std::hypot(qx, qz) - radius) > tolerance ||
+            std::abs(std::hypot(0.5 * (px + qx), 0.5 * (pz + qz)) - radius) > tolerance) {
+            return false;
+        }
+        
+        double step = std::atan2(px * qz - pz * qx, px * qx + pz * qz);
+        if (clockwise) {
+            step = -step;
+        }
+        if (step <= 0.0) {
+            return false;
+        }
+        sweep += step;
+    }
+    return sweep < 2.0 * M_PI - 1e-6;
+}
+
+/**
+ * Longest arc from @p from through at least three chords of the chain,
+ * searched over a bounded window so the cost per point stays constant.
+ * Returns end == from when no arc fits.
+ */
+ArcFit longestArcFit(const std::vector<double>& xs, const std::vector<double>& zs,
+                     size_t from, size_t last, double tolerance) {
+    ArcFit best;
+    best.end = from;
+    
+    const size_t limit = std::min(last, from + kMaxArcWindow);
+    for (size_t j = from + 3; j <= limit; ++j) {
+        const size_t mid = from + (j - from) / 2;
+        double centerX = 0.0;
+        double centerZ = 0.0;
+        double radius = 0.0;
+        if (!circleThrough(xs[from], zs[from], xs[mid], zs[mid], xs[j], zs[j],
+                           centerX, centerZ, radius) ||
+            radius <= tolerance || radius > kMaxArcRadius) {
+            break;
+        }
+        
+        // Turning direction in the (axial right, radius up) view
+        const double turn = (xs[mid] - xs[from]) * (zs[j] - zs[mid]) -
+                            (zs[mid] - zs[from]) * (xs[j] - xs[mid]);
+        const bool clockwise = turn < 0.0;
+        if (!arcCoversChain(xs, zs, from, j, centerX, centerZ, radius, clockwise, tolerance)) {
+            break;
+        }
+        best.end = j;
+        best.centerX = centerX;
+        best.centerZ = centerZ;
+        best.clockwise = clockwise;
+    }
+    return best;
+}
+
+} // namespace
+
+double arcSweepAngle(const Geometry::Point3D& start, const Geometry::Point3D& end,
+                     const Geometry::Point3D& center, bool clockwise) {
+    constexpr double twoPi = 2.0 * M_PI;
+    
+    // Angles in the (axial, radial) drawing plane
+    const double startAngle = std::atan2(start.z - center.z, start.x - center.x);
+    const double endAngle = std::atan2(end.z - center.z, end.x - center.x);
+    double sweep = endAngle - startAngle;
+    
+    if (clockwise) {
+        while (sweep >= 0.0) sweep -= twoPi;
+        while (sweep <= -twoPi) sweep += twoPi;
+    } else {
+        while (sweep <= 0.0) sweep += twoPi;
+        while (sweep >= twoPi) sweep -= twoPi;
+    }
+    
+    // Start and end coincide: full circle
+    if (std::abs(sweep) < 1e-12) {
+        sweep = clockwise ? -twoPi : twoPi;
+    }
+    return sweep;
+}
+
+double movementLength(const MovementView& moves, size_t index) {
+    const Geometry::Point3D start = moves.startPoint(index);
+    const Geometry::Point3D end = moves.position(index);
+    const MovementType type = moves.type(index);
+    if (isCircular(type)) {
+        const Geometry::Point3D center = moves.arcCenter(index);
+        const double radius = std::hypot(start.x - center.x, start.z - center.z);
+        return radius * std::abs(arcSweepAngle(start, end, center, type == MovementType::CircularCW));
+    }
+    return std::sqrt(
+        std::pow(end.x - start.x, 2) +
+        std::pow(end.y - start.y, 2) +
+        std::pow(end.z - start.z, 2)
+    );
+}
+
+double spindleSpeedAt(const MovementView& moves, size_t index, double radius) {
+    const double clamp = moves.spindleSpeed(index);
+    const double surfaceSpeed = moves.surfaceSpeed(index);
+    if (surfaceSpeed <= 0.0) {
+        return clamp;
+    }
+    
+    // Stay finite on the axis; the clamp normally takes over long before
+    const double rpm = 1000.0 * surfaceSpeed / (2.0 * M_PI * std::max(std::abs(radius), 0.1));
+    return clamp > 0.0 ? std::min(rpm, clamp) : rpm;
+}
+
+// MovementView Implementation
+Geometry::Point3D MovementView::startPoint(size_t index) const {
+    if (const Geometry::Point3D* start = findSparsePoint(toolpath_->explicitStarts_, index)) {
+        return *start;
+    }
+    return position(index == 0 ? 0 : index - 1);
+}
+
+Geometry::Point3D MovementView::arcCenter(size_t index) const {
+    if (const Geometry::Point3D* center = findSparsePoint(toolpath_->arcCenters_, index)) {
+        return *center;
+    }
+    return position(index);
+}
+
+MovementRecord MovementView::operator[](size_t index) const {
+    MovementRecord move;
+    move.type = type(index);
+    move.startPoint = startPoint(index);
+    move.position = position(index);
+    move.endPoint = move.position;
+    move.feedRate = feedRate(index);
+    move.spindleSpeed = spindleSpeed(index);
+    move.surfaceSpeed = surfaceSpeed(index);
+    move.feedMode = feedMode(index);
+    move.comment = comment(index);
+    move.operationType = operationType(index);
+    move.operationName = operationName(index);
+    move.passNumber = toolpath_->passNumbers_[index];
+    if (isCircular(move.type)) {
+        move.center = arcCenter(index);
+    }
+    return move;
+}
+
+MovementRecord::operator Movement() const {
+    Movement move(type, startPoint, position, operationType);
+    move.center = center;
+    move.feedRate = feedRate;
+    move.spindleSpeed = spindleSpeed;
+    move.surfaceSpeed = surfaceSpeed;
+    move.feedMode = feedMode;
+    move.comment = std::string(comment);
+    move.operationName = std::string(operationName);
+    move.passNumber = passNumber;
+    return move;
+}
+
+std::vector<Movement> MovementView::toVector() const {
+    std::vector<Movement> movements;
+    movements.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        movements.push_back((*this)[i]);
+    }
+    return movements;
+}
+
 // Toolpath Implementation
 Toolpath::Toolpath(const std::string& name, std::shared_ptr<Tool> tool, OperationType opType) 
-    : name_(name), tool_(tool), operationType_(opType) {}
+    : tool_(tool), name_(name), operationType_(opType) {}
+
+std::uint32_t Toolpath::internString(const std::string& value) {
+    if (value.empty()) {
+        return 0;
+    }
+    auto it = stringIds_.find(value);
+    if (it != stringIds_.end()) {
+        return it->second;
+    }
+    auto id = static_cast<std::uint32_t>(strings_.size());
+    strings_.push_back(value);
+    stringIds_.emplace(value, id);
+    return id;
+}
+
+Geometry::Point3D Toolpath::lastPosition() const {
+    if (types_.empty()) {
+        return Geometry::Point3D(0, 0, 0);
+    }
+    return Geometry::Point3D(posX_.back(), posY_.back(), posZ_.back());
+}
+
+void Toolpath::appendMove(MovementType type, const Geometry::Point3D& position, double feedRate,
+                          OperationType opType, const std::string& opName, const std::string& comment) {
+    posX_.push_back(position.x);
+    posY_.push_back(position.y);
+    posZ_.push_back(position.z);
+    feedRates_.push_back(feedRate);
+    spindleSpeeds_.push_back(0.0);
+    surfaceSpeeds_.push_back(0.0);
+    feedModes_.push_back(FeedMode::PerMinute);
+    types_.push_back(type);
+    operationTypes_.push_back(opType);
+    passNumbers_.push_back(0);
+    commentIds_.push_back(internString(comment));
+    operationNameIds_.push_back(internString(opName));
+}
+
+void Toolpath::setCuttingConditions(size_t index, double feedRate, FeedMode feedMode,
+                                    double spindleSpeed, double surfaceSpeed) {
+    feedRates_[index] = feedRate;
+    feedModes_[index] = feedMode;
+    spindleSpeeds_[index] = spindleSpeed;
+    surfaceSpeeds_[index] = surfaceSpeed;
+}
+
+void Toolpath::reserve(size_t movementCount) {
+    posX_.reserve(movementCount);
+    posY_.reserve(movementCount);
+    posZ_.reserve(movementCount);
+    feedRates_.reserve(movementCount);
+    spindleSpeeds_.reserve(movementCount);
+    surfaceSpeeds_.reserve(movementCount);
+    feedModes_.reserve(movementCount);
+    types_.reserve(movementCount);
+    operationTypes_.reserve(movementCount);
+    passNumbers_.reserve(movementCount);
+    commentIds_.reserve(movementCount);
+    operationNameIds_.reserve(movementCount);
+}
 
 void Toolpath::addMovement(const Movement& movement) {
-    movements_.push_back(movement);
+    // Only keep the start point when it is not implied by the previous move
+    Geometry::Point3D impliedStart = types_.empty() ? movement.position : lastPosition();
+    auto index = static_cast<std::uint32_t>(types_.size());
+    
+    appendMove(movement.type, movement.position, movement.feedRate,
+               movement.operationType, movement.operationName, movement.comment);
+    spindleSpeeds_.back() = movement.spindleSpeed;
+    surfaceSpeeds_.back() = movement.surfaceSpeed;
+    feedModes_.back() = movement.feedMode;
+    passNumbers_.back() = movement.passNumber;
+    
+    if (movement.startPoint.x != impliedStart.x ||
+        movement.startPoint.y != impliedStart.y ||
+        movement.startPoint.z != impliedStart.z) {
+        explicitStarts_.emplace_back(index, movement.startPoint);
+    }
+    if (isCircular(movement.type)) {
+        arcCenters_.emplace_back(index, movement.center);
+    }
 }
 
 void Toolpath::addRapidMove(const Geometry::Point3D& position) {
-    Movement move(MovementType::Rapid, movements_.empty() ? position : movements_.back().position, position);
-    move.operationType = operationType_;
-    movements_.push_back(move);
+    appendMove(MovementType::Rapid, position, 0.0, operationType_);
 }
 
 void Toolpath::addLinearMove(const Geometry::Point3D& position, double feedRate) {
-    Movement move(MovementType::Linear, movements_.empty() ? position : movements_.back().position, position);
-    move.feedRate = feedRate;
-    move.operationType = operationType_;
-    movements_.push_back(move);
+    appendMove(MovementType::Linear, position, feedRate, operationType_);
 }
 
 void Toolpath::addCircularMove(const Geometry::Point3D& position, const Geometry::Point3D& center, 
                                bool clockwise, double feedRate) {
-    MovementType type = clockwise ? MovementType::CircularCW : MovementType::CircularCCW;
-    Movement move(type, movements_.empty() ? position : movements_.back().position, position);
-    move.feedRate = feedRate;
-    move.operationType = operationType_;
-    movements_.push_back(move);
+    addCircularMove(position, center, clockwise, feedRate, operationType_);
 }
 
 void Toolpath::addThreadingMove(const Geometry::Point3D& position, double feedRate, double pitch) {
-    Movement move(MovementType::Linear, movements_.empty() ? position : movements_.back().position, position);
-    move.feedRate = feedRate;
-    move.operationType = OperationType::Threading;
-    move.comment = "Threading pitch: " + std::to_string(pitch);
-    movements_.push_back(move);
+    appendMove(MovementType::Linear, position, feedRate, OperationType::Threading,
+               "", "Threading pitch: " + std::to_string(pitch));
 }
 
 void Toolpath::addDwell(double seconds) {
-    Movement move(MovementType::Dwell, movements_.empty() ? Geometry::Point3D(0,0,0) : movements_.back().position);
-    move.operationType = operationType_;
-    move.comment = "Dwell " + std::to_string(seconds) + "s";
-    movements_.push_back(move);
+    appendMove(MovementType::Dwell, lastPosition(), seconds, operationType_,
+               "", "Dwell " + std::to_string(seconds) + "s");
 }
 
 // Movement operations with operation context
 void Toolpath::addRapidMove(const Geometry::Point3D& position, OperationType opType, const std::string& opName) {
-    Movement move(MovementType::Rapid, movements_.empty() ? position : movements_.back().position, position);
-    move.operationType = opType;
-    move.operationName = opName;
-    movements_.push_back(move);
+    appendMove(MovementType::Rapid, position, 0.0, opType, opName);
 }
 
 void Toolpath::addLinearMove(const Geometry::Point3D& position, double feedRate, OperationType opType, const std::string& opName) {
-    Movement move(MovementType::Linear, movements_.empty() ? position : movements_.back().position, position);
-    move.feedRate = feedRate;
-    move.operationType = opType;
-    move.operationName = opName;
-    movements_.push_back(move);
+    appendMove(MovementType::Linear, position, feedRate, opType, opName);
 }
 
 void Toolpath::addCircularMove(const Geometry::Point3D& position, const Geometry::Point3D& center, 
                               bool clockwise, double feedRate, OperationType opType, const std::string& opName) {
     MovementType type = clockwise ? MovementType::CircularCW : MovementType::CircularCCW;
-    Movement move(type, movements_.empty() ? position : movements_.back().position, position);
-    move.feedRate = feedRate;
-    move.operationType = opType;
-    move.operationName = opName;
-    movements_.push_back(move);
+    arcCenters_.emplace_back(static_cast<std::uint32_t>(types_.size()), center);
+    appendMove(type, position, feedRate, opType, opName);
 }
 
 double Toolpath::estimateMachiningTime() const {
     double totalTime = 0.0;
+    MovementView moves = getMovements();
+    double rapidFeedRate = tool_ ? tool_->getCuttingParameters().rapidFeedRate : 5000.0;
+    double toolSpindleSpeed = tool_ ? tool_->getCuttingParameters().spindleSpeed : 0.0;
     
-    for (const auto& movement : movements_) {
-        if (movement.type == MovementType::Rapid) {
+    for (size_t i = 0; i < moves.size(); ++i) {
+        MovementType type = moves.type(i);
+        double feedRate = moves.feedRate(i);
+        if (type == MovementType::Dwell) {
+            totalTime += feedRate / 60.0;  // Dwell keeps its seconds in the feed column
+            continue;
+        }
+        if (type != MovementType::Rapid && feedRate <= 0.0) {
+            continue;
+        }
+        
+        double distance = movementLength(moves, i);
+        
+        if (type == MovementType::Rapid) {
             // Rapid moves are fast
-            double distance = std::sqrt(
-                std::pow(movement.endPoint.x - movement.startPoint.x, 2) +
-                std::pow(movement.endPoint.y - movement.startPoint.y, 2) +
-                std::pow(movement.endPoint.z - movement.startPoint.z, 2)
-            );
-            totalTime += distance / (tool_ ? tool_->getCuttingParameters().rapidFeedRate : 5000.0);
-        } else if (movement.feedRate > 0.0) {
-            // Calculate based on feed rate
-            double distance = std::sqrt(
-                std::pow(movement.endPoint.x - movement.startPoint.x, 2) +
-                std::pow(movement.endPoint.y - movement.startPoint.y, 2) +
-                std::pow(movement.endPoint.z - movement.startPoint.z, 2)
-            );
-            totalTime += distance / movement.feedRate;
+            totalTime += distance / rapidFeedRate;
+            continue;
+        }
+        
+        if (moves.feedMode(i) == FeedMode::PerRevolution) {
+            // Spindle speed at the middle of the move, falling back to the tool's
+            const double midRadius = 0.5 * (moves.startPoint(i).z + posZ_[i]);
+            double rpm = spindleSpeedAt(moves, i, midRadius);
+            if (rpm <= 0.0) {
+                rpm = toolSpindleSpeed;
+            }
+            if (rpm <= 0.0) {
+                continue;
+            }
+            feedRate *= rpm;
         }
+        
+        // Calculate based on feed rate
+        totalTime += distance / feedRate;
     }
     
     return totalTime;
 }
 
 Geometry::BoundingBox Toolpath::getBoundingBox() const {
-    if (movements_.empty()) {
+    if (types_.empty()) {
         return Geometry::BoundingBox();
     }
     
-    double minX = movements_[0].position.x, maxX = movements_[0].position.x;
-    double minY = movements_[0].position.y, maxY = movements_[0].position.y;
-    double minZ = movements_[0].position.z, maxZ = movements_[0].position.z;
-    
-    for (const auto& movement : movements_) {
-        minX = std::min(minX, movement.position.x);
-        maxX = std::max(maxX, movement.position.x);
-        minY = std::min(minY, movement.position.y);
-        maxY = std::max(maxY, movement.position.y);
-        minZ = std::min(minZ, movement.position.z);
-        maxZ = std::max(maxZ, movement.position.z);
-    }
+    auto [minX, maxX] = std::minmax_element(posX_.begin(), posX_.end());
+    auto [minY, maxY] = std::minmax_element(posY_.begin(), posY_.end());
+    auto [minZ, maxZ] = std::minmax_element(posZ_.begin(), posZ_.end());
     
     return Geometry::BoundingBox(
-        Geometry::Point3D(minX, minY, minZ),
-        Geometry::Point3D(maxX, maxY, maxZ)
+        Geometry::Point3D(*minX, *minY, *minZ),
+        Geometry::Point3D(*maxX, *maxY, *maxZ)
     );
 }
 
-void Toolpath::optimizeToolpath() {
-    // Remove redundant movements (same position)
+void Toolpath::optimizeToolpath(double tolerance) {
     removeRedundantMoves();
+    removeZeroLengthExcursions();
     
-    // Additional optimization could be added here
+    if (tolerance > 0.0) {
+        compressFeedChains(tolerance);
+    }
 }
 
 void Toolpath::removeRedundantMoves() {
-    if (movements_.size() < 2) return;
+    if (types_.size() < 2) return;
     
-    std::vector<Movement> optimized;
-    optimized.reserve(movements_.size());
-    optimized.push_back(movements_[0]);
-    
-    for (size_t i = 1; i < movements_.size(); ++i) {
-        const auto& current = movements_[i];
-        const auto& previous = optimized.back();
-        
+    const MovementView moves = getMoves();
+    const std::vector<char> explicitStart = flagMoves(explicitStarts_, types_.size());
+    std::vector<char> drop(types_.size(), 0);
+    size_t lastKept = 0;
+    for (size_t i = 1; i < types_.size(); ++i) {
         // Check if positions are significantly different
         double distance = std::sqrt(
-            std::pow(current.position.x - previous.position.x, 2) +
-            std::pow(current.position.y - previous.position.y, 2) +
-            std::pow(current.position.z - previous.position.z, 2)
+            std::pow(posX_[i] - posX_[lastKept], 2) +
+            std::pow(posY_[i] - posY_[lastKept], 2) +
+            std::pow(posZ_[i] - posZ_[lastKept], 2)
         );
         
-        // Only add if distance is above tolerance
-        if (distance > 0.001) { // 1 micron tolerance
-            optimized.push_back(current);
+        // Dwells and tool changes do not move the tool but still take time
+        bool keep = distance > kPointTolerance ||
+                    types_[i] == MovementType::Dwell || types_[i] == MovementType::ToolChange;
+        
+        // Full circles end where they start but still sweep the tool around
+        if (!keep && isCircular(types_[i])) {
+            keep = movementLength(moves, i) > kPointTolerance;
+        }
+        
+        // A move with its own start point travels from there, not from lastKept
+        if (!keep && explicitStart[i]) {
+            const Geometry::Point3D start = moves.startPoint(i);
+            keep = std::sqrt(
+                std::pow(start.x - posX_[lastKept], 2) +
+                std::pow(start.y - posY_[lastKept], 2) +
+                std::pow(start.z - posZ_[lastKept], 2)
+            ) > kPointTolerance;
+        }
+        
+        if (keep) {
+            lastKept = i;
+        } else {
+            drop[i] = 1;
         }
     }
     
-    movements_ = std::move(optimized);
+    eraseMoves(drop);
 }
 
-void Toolpath::applyTransform(const Geometry::Matrix4x4& mat) {
-    for (auto& movement : movements_) {
-        // Manual matrix multiplication since transformPoint doesn't exist yet
-        // [x' y' z' 1] = [x y z 1] * [4x4 matrix]
+void Toolpath::removeZeroLengthExcursions() {
+    const size_t count = types_.size();
+    if (count < 3) return;
+    
+    const std::vector<char> explicitStart = flagMoves(explicitStarts_, count);
+    auto returnsTo = [this](size_t index, size_t anchor) {
+        return std::abs(posX_[index] - posX_[anchor]) <= kPointTolerance &&
+               std::abs(posY_[index] - posY_[anchor]) <= kPointTolerance &&
+               std::abs(posZ_[index] - posZ_[anchor]) <= kPointTolerance;
+    };
+    
+    std::vector<char> drop(count, 0);
+    bool dropped = false;
+    size_t i = 1;
+    while (i < count) {
+        // Peck drilling retracts to clear chips on purpose
+        if (types_[i] != MovementType::Rapid || explicitStart[i] ||
+            operationTypes_[i] == OperationType::Drilling) {
+            ++i;
+            continue;
+        }
         
-        // Transform position
-        double x = movement.position.x * mat.data[0] + movement.position.y * mat.data[4] + movement.position.z * mat.data[8] + mat.data[12];
-        double y = movement.position.x * mat.data[1] + movement.position.y * mat.data[5] + movement.position.z * mat.data[9] + mat.data[13];
-        double z = movement.position.x * mat.data[2] + movement.position.y * mat.data[6] + movement.position.z * mat.data[10] + mat.data[14];
-        movement.position = Geometry::Point3D(x, y, z);
+        // Rapid chain [i, end) leaving the end point of move i - 1
+        const size_t anchor = i - 1;
+        size_t end = i + 1;
+        while (end < count && types_[end] == MovementType::Rapid && !explicitStart[end]) {
+            ++end;
+        }
         
-        // Transform start point
-        x = movement.startPoint.x * mat.data[0] + movement.startPoint.y * mat.data[4] + movement.startPoint.z * mat.data[8] + mat.data[12];
-        y = movement.startPoint.x * mat.data[1] + movement.startPoint.y * mat.data[5] + movement.startPoint.z * mat.data[9] + mat.data[13];
-        z = movement.startPoint.x * mat.data[2] + movement.startPoint.y * mat.data[6] + movement.startPoint.z * mat.data[10] + mat.data[14];
-        movement.startPoint = Geometry::Point3D(x, y, z);
+        // Drop up to the last move that comes back, including a feed re-approach
+        size_t last = anchor;
+        if (end < count && types_[end] == MovementType::Linear && !explicitStart[end] &&
+            returnsTo(end, anchor)) {
+            last = end;
+        } else {
+            for (size_t j = end; j-- > i;) {
+                if (returnsTo(j, anchor)) {
+                    last = j;
+                    break;
+                }
+            }
+        }
+        for (size_t j = i; j <= last; ++j) {
+            drop[j] = 1;
+            dropped = true;
+        }
+        i = std::max(end, last + 1);
+    }
+    
+    if (dropped) {
+        eraseMoves(drop);
+    }
+}
+
+void Toolpath::compressFeedChains(double tolerance) {
+    const size_t count = types_.size();
+    if (count < 3) return;
+    
+    const std::vector<char> explicitStart = flagMoves(explicitStarts_, count);
+    // Move i can extend a chain of linear moves ending with move i - 1
+    auto continuesChain = [&](size_t i) {
+        return types_[i] == MovementType::Linear && !explicitStart[i] &&
+               feedRates_[i] == feedRates_[i - 1] &&
+               spindleSpeeds_[i] == spindleSpeeds_[i - 1] &&
+               surfaceSpeeds_[i] == surfaceSpeeds_[i - 1] &&
+               feedModes_[i] == feedModes_[i - 1] &&
+               operationTypes_[i] == operationTypes_[i - 1] &&
+               passNumbers_[i] == passNumbers_[i - 1] &&
+               commentIds_[i] == commentIds_[i - 1] &&
+               operationNameIds_[i] == operationNameIds_[i - 1] &&
+               posY_[i] == posY_[i - 1];
+    };
+    
+    std::vector<char> drop(count, 0);
+    SparsePoints newCenters;
+    size_t begin = 1;
+    while (begin < count) {
+        if (types_[begin] != MovementType::Linear || explicitStart[begin] ||
+            posY_[begin] != posY_[begin - 1]) {
+            ++begin;
+            continue;
+        }
+        size_t end = begin + 1;
+        while (end < count && continuesChain(end)) {
+            ++end;
+        }
         
-        // Transform end point
-        x = movement.endPoint.x * mat.data[0] + movement.endPoint.y * mat.data[4] + movement.endPoint.z * mat.data[8] + mat.data[12];
-        y = movement.endPoint.x * mat.data[1] + movement.endPoint.y * mat.data[5] + movement.endPoint.z * mat.data[9] + mat.data[13];
-        z = movement.endPoint.x * mat.data[2] + movement.endPoint.y * mat.data[6] + movement.endPoint.z * mat.data[10] + mat.data[14];
-        movement.endPoint = Geometry::Point3D(x, y, z);
+        // Points begin - 1 .. end - 1 form the chain. Threads must stay G1.
+        const bool allowArcs = operationTypes_[begin] != OperationType::Threading;
+        size_t from = begin - 1;
+        while (from < end - 1) {
+            size_t to = longestLineFit(posX_, posZ_, from, end - 1, tolerance);
+            if (allowArcs) {
+                const ArcFit arc = longestArcFit(posX_, posZ_, from, end - 1, tolerance);
+                if (arc.end > to) {
+                    to = arc.end;
+                    types_[to] = arc.clockwise ? MovementType::CircularCW : MovementType::CircularCCW;
+                    newCenters.emplace_back(static_cast<std::uint32_t>(to),
+                                            Geometry::Point3D(arc.centerX, posY_[to], arc.centerZ));
+                }
+            }
+            for (size_t k = from + 1; k < to; ++k) {
+                drop[k] = 1;
+            }
+            from = to;
+        }
+        begin = end;
+    }
+    
+    if (!newCenters.empty()) {
+        const auto middle = arcCenters_.insert(arcCenters_.end(), newCenters.begin(), newCenters.end());
+        std::inplace_merge(arcCenters_.begin(), middle, arcCenters_.end(),
+            [](const std::pair<std::uint32_t, Geometry::Point3D>& a,
+               const std::pair<std::uint32_t, Geometry::Point3D>& b) {
+                return a.first < b.first;
+            });
+    }
+    eraseMoves(drop);
+}
+
+void Toolpath::eraseMoves(const std::vector<char>& drop) {
+    // Compact all columns in place; `kept` is the write cursor
+    std::vector<std::uint32_t> newIndex(types_.size());
+    size_t kept = 0;
+    for (size_t i = 0; i < types_.size(); ++i) {
+        newIndex[i] = static_cast<std::uint32_t>(kept);
+        if (drop[i]) {
+            continue;
+        }
+        posX_[kept] = posX_[i];
+        posY_[kept] = posY_[i];
+        posZ_[kept] = posZ_[i];
+        feedRates_[kept] = feedRates_[i];
+        spindleSpeeds_[kept] = spindleSpeeds_[i];
+        surfaceSpeeds_[kept] = surfaceSpeeds_[i];
+        feedModes_[kept] = feedModes_[i];
+        types_[kept] = types_[i];
+        operationTypes_[kept] = operationTypes_[i];
+        passNumbers_[kept] = passNumbers_[i];
+        commentIds_[kept] = commentIds_[i];
+        operationNameIds_[kept] = operationNameIds_[i];
+        ++kept;
+    }
+    
+    // Sparse tables follow their moves; entries of dropped moves go away
+    auto remap = [&drop, &newIndex](SparsePoints& table) {
+        size_t out = 0;
+        for (const auto& entry : table) {
+            if (!drop[entry.first]) {
+                table[out++] = std::make_pair(newIndex[entry.first], entry.second);
+            }
+        }
+        table.resize(out);
+    };
+    remap(explicitStarts_);
+    remap(arcCenters_);
+    
+    posX_.resize(kept);
+    posY_.resize(kept);
+    posZ_.resize(kept);
+    feedRates_.resize(kept);
+    spindleSpeeds_.resize(kept);
+    surfaceSpeeds_.resize(kept);
+    feedModes_.resize(kept);
+    types_.resize(kept);
+    operationTypes_.resize(kept);
+    passNumbers_.resize(kept);
+    commentIds_.resize(kept);
+    operationNameIds_.resize(kept);
+}
+
+void Toolpath::applyTransform(const Geometry::Matrix4x4& mat) {
+    // Manual matrix multiplication since transformPoint doesn't exist yet
+    // [x' y' z' 1] = [x y z 1] * [4x4 matrix]
+    auto transform = [&mat](double& x, double& y, double& z) {
+        double tx = x * mat.data[0] + y * mat.data[4] + z * mat.data[8] + mat.data[12];
+        double ty = x * mat.data[1] + y * mat.data[5] + z * mat.data[9] + mat.data[13];
+        double tz = x * mat.data[2] + y * mat.data[6] + z * mat.data[10] + mat.data[14];
+        x = tx;
+        y = ty;
+        z = tz;
+    };
+    
+    // Transform positions (implied start points follow automatically)
+    for (size_t i = 0; i < types_.size(); ++i) {
+        transform(posX_[i], posY_[i], posZ_[i]);
+    }
+    
+    // Transform explicit start points and arc centers
+    for (auto& entry : explicitStarts_) {
+        transform(entry.second.x, entry.second.y, entry.second.z);
+    }
+    for (auto& entry : arcCenters_) {
+        transform(entry.second.x, entry.second.y, entry.second.z);
     }
 }
 
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/Toolpath/FeedSpeedPlanner.h>
+
+using namespace IntuiCAM::Toolpath;
+using IntuiCAM::Geometry::Point3D;
+
+namespace {
+
+FeedSpeedPlanner::Parameters steelParameters() {
+    FeedSpeedPlanner::Parameters params;
+    params.material = OperationParameterManager::getMaterialProperties("steel");
+    params.maxSpindleSpeed = 3000.0;
+    return params;
+}
+
+} // namespace
+
+TEST(FeedSpeedPlannerTest, PlansFacingAtConstantSurfaceSpeed) {
+    std::vector<std::unique_ptr<Toolpath>> timeline;
+    auto facing = std::make_unique<Toolpath>("facing", std::make_shared<Tool>(Tool::Type::Facing, "T1"),
+                                             OperationType::Facing);
+    facing->addRapidMove(Point3D(51.0, 0.0, 12.0));
+    facing->addLinearMove(Point3D(50.0, 0.0, 12.0), 50.0);   // Entry at half feed
+    facing->addLinearMove(Point3D(50.0, 0.0, 0.0), 100.0);   // Towards the center
+    facing->addRapidMove(Point3D(52.0, 0.0, 2.0));
+    timeline.push_back(std::move(facing));
+
+    const FeedSpeedPlanner::Parameters params = steelParameters();
+    const FeedSpeedPlanner::Report report = FeedSpeedPlanner(params).plan(timeline);
+
+    EXPECT_EQ(report.toolpathsPlanned, 1u);
+    EXPECT_EQ(report.movesPlanned, 4u);
+    EXPECT_GT(report.timeSaved(), 0.0);
+
+    const double surfaceSpeed = OperationParameterManager::recommendedCuttingSpeed(params.material);
+    const double chipLoad = OperationParameterManager::recommendedFeedPerRevolution(params.material);
+    const MovementView moves = timeline.front()->getMovements();
+
+    EXPECT_EQ(moves.feedMode(0), FeedMode::PerMinute);
+    EXPECT_DOUBLE_EQ(moves.surfaceSpeed(0), surfaceSpeed);
+
+    EXPECT_EQ(moves.feedMode(1), FeedMode::PerRevolution);
+    EXPECT_DOUBLE_EQ(moves.feedRate(1), 0.5 * chipLoad);
+    EXPECT_DOUBLE_EQ(moves.feedRate(2), chipLoad);
+    EXPECT_DOUBLE_EQ(moves.surfaceSpeed(2), surfaceSpeed);
+    EXPECT_DOUBLE_EQ(moves.spindleSpeed(2), params.maxSpindleSpeed);
+
+    // The spindle speeds up towards the center until the clamp
+    EXPECT_LT(spindleSpeedAt(moves, 2, 12.0), spindleSpeedAt(moves, 2, 3.0));
+    EXPECT_DOUBLE_EQ(spindleSpeedAt(moves, 2, 0.5), params.maxSpindleSpeed);
+}
+
+TEST(FeedSpeedPlannerTest, FinishingRunsFasterWithLighterChipLoad) {
+    auto roughing = std::make_unique<Toolpath>("roughing", std::make_shared<Tool>(Tool::Type::Turning, "T1"),
+                                               OperationType::ExternalRoughing);
+    roughing->addLinearMove(Point3D(20.0, 0.0, 8.0), 200.0);
+    auto finishing = std::make_unique<Toolpath>("finishing", std::make_shared<Tool>(Tool::Type::Turning, "T2"),
+                                                OperationType::ExternalFinishing);
+    finishing->addLinearMove(Point3D(20.0, 0.0, 8.0), 200.0);
+
+    const FeedSpeedPlanner planner(steelParameters());
+    ASSERT_EQ(planner.plan(*roughing), 1u);
+    ASSERT_EQ(planner.plan(*finishing), 1u);
+
+    EXPECT_GT(finishing->getMovements().surfaceSpeed(0), roughing->getMovements().surfaceSpeed(0));
+    EXPECT_LT(finishing->getMovements().feedRate(0), roughing->getMovements().feedRate(0));
+}
+
+TEST(FeedSpeedPlannerTest, LeavesThreadingAndPlannedMovesAlone) {
+    Toolpath threading("threading", std::make_shared<Tool>(Tool::Type::Threading, "T3"), OperationType::Threading);
+    threading.addRapidMove(Point3D(30.0, 0.0, 6.0));
+    threading.addThreadingMove(Point3D(10.0, 0.0, 6.0), 1.5, 1.5);
+
+    const FeedSpeedPlanner planner(steelParameters());
+    EXPECT_EQ(planner.plan(threading), 0u);
+    EXPECT_EQ(threading.getMovements().feedMode(1), FeedMode::PerMinute);
+    EXPECT_DOUBLE_EQ(threading.getMovements().surfaceSpeed(1), 0.0);
+
+    // An explicit per-revolution feed is kept
+    Toolpath grooving("grooving", std::make_shared<Tool>(Tool::Type::Grooving, "T4"),
+                      OperationType::ExternalGrooving);
+    Movement plunge(MovementType::Linear, Point3D(30.0, 0.0, 10.0), Point3D(30.0, 0.0, 7.0));
+    plunge.feedRate = 0.03;
+    plunge.feedMode = FeedMode::PerRevolution;
+    grooving.addMovement(plunge);
+
+    EXPECT_EQ(planner.plan(grooving), 0u);
+    EXPECT_DOUBLE_EQ(grooving.getMovements().feedRate(0), 0.03);
+}
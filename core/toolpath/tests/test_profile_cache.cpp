@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/Toolpath/ProfileCache.h>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <TopLoc_Location.hxx>
+#include <gp_Ax2.hxx>
+
+#include <vector>
+
+using namespace IntuiCAM::Toolpath;
+using IntuiCAM::Geometry::Point2D;
+
+namespace {
+
+const gp_Ax1 kTurningAxis(gp_Pnt(0, 0, 0), gp_Dir(0, 0, 1));
+
+LatheProfile::Profile2D makeProfile(double radius) {
+    LatheProfile::ProfileSegment segment;
+    segment.start = Point2D(radius, 0.0);
+    segment.end = Point2D(radius, 40.0);
+    LatheProfile::Profile2D profile;
+    profile.segments.push_back(segment);
+    return profile;
+}
+
+class ProfileCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        cache().clear();
+        cache().setCapacity(16);
+    }
+    void TearDown() override {
+        cache().clear();
+        cache().setCapacity(16);
+    }
+    static ProfileCache& cache() { return ProfileCache::instance(); }
+};
+
+} // namespace
+
+TEST_F(ProfileCacheTest, HitsForSameShapePoseAndTolerance) {
+    const TopoDS_Shape shaft = BRepPrimAPI_MakeCylinder(10.0, 40.0).Shape();
+    cache().store(shaft, kTurningAxis, 0.01, makeProfile(10.0));
+
+    const size_t hitsBefore = cache().getHitCount();
+    LatheProfile::Profile2D profile;
+    ASSERT_TRUE(cache().lookup(shaft, kTurningAxis, 0.01, profile));
+    EXPECT_EQ(cache().getHitCount(), hitsBefore + 1);
+    ASSERT_EQ(profile.getSegmentCount(), 1u);
+    EXPECT_DOUBLE_EQ(profile.segments[0].start.x, 10.0);
+
+    // A copy of the handle shares the TShape and location
+    const TopoDS_Shape copy = shaft;
+    EXPECT_TRUE(cache().lookup(copy, kTurningAxis, 0.01, profile));
+
+    EXPECT_FALSE(cache().lookup(shaft, kTurningAxis, 0.02, profile));
+}
+
+TEST_F(ProfileCacheTest, MissesWhenOnlyTheLocationChanges) {
+    const TopoDS_Shape shaft = BRepPrimAPI_MakeCylinder(10.0, 40.0).Shape();
+    cache().store(shaft, kTurningAxis, 0.01, makeProfile(10.0));
+
+    gp_Trsf shift;
+    shift.SetTranslation(gp_Vec(0.0, 0.0, 5.0));
+    const TopoDS_Shape moved = shaft.Moved(TopLoc_Location(shift));
+
+    const size_t missesBefore = cache().getMissCount();
+    LatheProfile::Profile2D profile;
+    EXPECT_FALSE(cache().lookup(moved, kTurningAxis, 0.01, profile));
+    EXPECT_EQ(cache().getMissCount(), missesBefore + 1);
+
+    // Moving it back to the cached pose hits again
+    const TopoDS_Shape restored = moved.Moved(TopLoc_Location(shift.Inverted()));
+    EXPECT_TRUE(cache().lookup(restored, kTurningAxis, 0.01, profile));
+}
+
+TEST_F(ProfileCacheTest, EvictsLeastRecentlyUsedPastCapacity) {
+    ASSERT_EQ(cache().getCapacity(), 16u);
+
+    std::vector<TopoDS_Shape> shapes;
+    for (int i = 0; i < 17; ++i) {
+        shapes.push_back(BRepPrimAPI_MakeCylinder(5.0 + i, 40.0).Shape());
+    }
+    for (int i = 0; i < 16; ++i) {
+        cache().store(shapes[i], kTurningAxis, 0.01, makeProfile(5.0 + i));
+    }
+    EXPECT_EQ(cache().size(), 16u);
+
+    // Touch the oldest entry, so the second oldest is evicted instead
+    LatheProfile::Profile2D profile;
+    ASSERT_TRUE(cache().lookup(shapes[0], kTurningAxis, 0.01, profile));
+    cache().store(shapes[16], kTurningAxis, 0.01, makeProfile(21.0));
+
+    EXPECT_EQ(cache().size(), 16u);
+    EXPECT_TRUE(cache().lookup(shapes[0], kTurningAxis, 0.01, profile));
+    EXPECT_FALSE(cache().lookup(shapes[1], kTurningAxis, 0.01, profile));
+    EXPECT_TRUE(cache().lookup(shapes[16], kTurningAxis, 0.01, profile));
+}
+
+TEST_F(ProfileCacheTest, DoesNotStoreFailedExtractions) {
+    // Entirely off the XZ section plane, so sectioning finds no profile
+    const TopoDS_Shape offPlane = BRepPrimAPI_MakeBox(gp_Pnt(0, 50, 0), 10.0, 10.0, 10.0).Shape();
+
+    const LatheProfile::Profile2D profile =
+        LatheProfile::extractSegmentProfile(offPlane, kTurningAxis, 0.01);
+    EXPECT_TRUE(profile.isEmpty());
+    EXPECT_EQ(cache().size(), 0u);
+
+    // A null shape is never stored either
+    cache().store(TopoDS_Shape(), kTurningAxis, 0.01, makeProfile(10.0));
+    EXPECT_EQ(cache().size(), 0u);
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/Toolpath/ProfileIndex.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace IntuiCAM::Toolpath;
+using IntuiCAM::Geometry::Point2D;
+
+namespace {
+
+LatheProfile::ProfileSegment makeSegment(double startRadius, double startZ, double endRadius, double endZ) {
+    LatheProfile::ProfileSegment segment;
+    segment.start = Point2D(startRadius, startZ);
+    segment.end = Point2D(endRadius, endZ);
+    return segment;
+}
+
+// Stepped shaft half-section, (radius, z):
+// (0,0) -> (10,0) -> (10,20) -> (6,20) -> (6,40) -> (0,40)
+LatheProfile::Profile2D makeSteppedShaft() {
+    LatheProfile::Profile2D profile;
+    profile.segments.push_back(makeSegment(0.0, 0.0, 10.0, 0.0));
+    profile.segments.push_back(makeSegment(10.0, 0.0, 10.0, 20.0));
+    profile.segments.push_back(makeSegment(10.0, 20.0, 6.0, 20.0));
+    profile.segments.push_back(makeSegment(6.0, 20.0, 6.0, 40.0));
+    profile.segments.push_back(makeSegment(6.0, 40.0, 0.0, 40.0));
+    return profile;
+}
+
+// Arc from (10,0) to (10,20) around (5,10), bulging out to 5 + sqrt(125) at Z=10
+LatheProfile::Profile2D makeBulgingShaft() {
+    LatheProfile::Profile2D profile;
+    profile.segments.push_back(makeSegment(0.0, 0.0, 10.0, 0.0));
+    LatheProfile::ProfileSegment arc = makeSegment(10.0, 0.0, 10.0, 20.0);
+    arc.isArc = true;
+    arc.center = Point2D(5.0, 10.0);
+    arc.radius = std::sqrt(125.0);
+    arc.clockwise = true;
+    profile.segments.push_back(arc);
+    profile.segments.push_back(makeSegment(10.0, 20.0, 0.0, 20.0));
+    return profile;
+}
+
+} // namespace
+
+TEST(ProfileIndexTest, CrossingsAtRadiusAreSortedByZ) {
+    ProfileIndex index(makeSteppedShaft());
+    ASSERT_EQ(index.getSegmentCount(), 5u);
+
+    const auto crossings = index.zCrossingsAtRadius(8.0);
+    ASSERT_EQ(crossings.size(), 2u);
+    EXPECT_DOUBLE_EQ(crossings[0], 0.0);
+    EXPECT_DOUBLE_EQ(crossings[1], 20.0);
+
+    const auto intervals = index.materialIntervalsAtRadius(3.0);
+    ASSERT_EQ(intervals.size(), 1u);
+    EXPECT_DOUBLE_EQ(intervals[0].first, 0.0);
+    EXPECT_DOUBLE_EQ(intervals[0].second, 40.0);
+
+    EXPECT_TRUE(index.zCrossingsAtRadius(12.0).empty());
+}
+
+TEST(ProfileIndexTest, RadiusEnvelopeAtZ) {
+    ProfileIndex index(makeSteppedShaft());
+
+    double radius = 0.0;
+    ASSERT_TRUE(index.radiusEnvelopeAtZ(10.0, radius));
+    EXPECT_DOUBLE_EQ(radius, 10.0);
+
+    ASSERT_TRUE(index.radiusEnvelopeAtZ(30.0, radius));
+    EXPECT_DOUBLE_EQ(radius, 6.0);
+
+    // The shoulder face at Z=20 carries the full step
+    ASSERT_TRUE(index.radiusEnvelopeAtZ(20.0, radius));
+    EXPECT_DOUBLE_EQ(radius, 10.0);
+
+    EXPECT_FALSE(index.radiusEnvelopeAtZ(50.0, radius));
+    EXPECT_TRUE(index.radiusEnvelopeAtZ(40.5, radius, 1.0));
+}
+
+TEST(ProfileIndexTest, RangeQueriesMatchLinearScan) {
+    // Sawtooth with many overlapping radius spans
+    LatheProfile::Profile2D profile;
+    for (int i = 0; i < 200; ++i) {
+        const double z = i * 0.5;
+        profile.segments.push_back(makeSegment(5.0 + (i % 7), z, 5.0 + ((i * 3) % 11), z + 0.5));
+    }
+    ProfileIndex index(profile);
+
+    for (double r = 4.0; r <= 17.0; r += 0.25) {
+        std::vector<size_t> expected;
+        for (size_t i = 0; i < profile.segments.size(); ++i) {
+            const auto& segment = profile.segments[i];
+            if (r >= std::min(segment.start.x, segment.end.x) &&
+                r <= std::max(segment.start.x, segment.end.x)) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(index.segmentsInRadiusRange(r, r), expected) << "radius " << r;
+        EXPECT_EQ(index.zCrossingsAtRadius(r).size(), expected.size());
+    }
+
+    const auto hits = index.segmentsInZRange(10.1, 11.9);
+    ASSERT_EQ(hits.size(), 4u);
+    EXPECT_EQ(hits.front(), 20u);
+    EXPECT_EQ(hits.back(), 23u);
+}
+
+TEST(ProfileIndexTest, EmptyProfile) {
+    ProfileIndex index{LatheProfile::Profile2D()};
+    EXPECT_TRUE(index.isEmpty());
+    EXPECT_TRUE(index.zCrossingsAtRadius(1.0).empty());
+
+    double radius = 0.0;
+    EXPECT_FALSE(index.radiusEnvelopeAtZ(0.0, radius));
+}
+
+TEST(ProfileIndexTest, ArcsAreIndexedByTheirBulge) {
+    ProfileIndex index(makeBulgingShaft());
+    const double top = 5.0 + std::sqrt(125.0);
+
+    // The chord stays at radius 10; the arc reaches past it
+    EXPECT_EQ(index.segmentsInRadiusRange(15.0, 15.0), std::vector<size_t>{1u});
+    EXPECT_TRUE(index.segmentsInRadiusRange(top + 0.01, 20.0).empty());
+
+    const auto crossings = index.zCrossingsAtRadius(15.0);
+    ASSERT_EQ(crossings.size(), 2u);
+    EXPECT_NEAR(crossings[0], 5.0, 1e-9);
+    EXPECT_NEAR(crossings[1], 15.0, 1e-9);
+
+    // Below the end points the arc is not crossed
+    const auto below = index.zCrossingsAtRadius(8.0);
+    ASSERT_EQ(below.size(), 2u);
+    EXPECT_DOUBLE_EQ(below[0], 0.0);
+    EXPECT_DOUBLE_EQ(below[1], 20.0);
+
+    double radius = 0.0;
+    ASSERT_TRUE(index.radiusEnvelopeAtZ(10.0, radius));
+    EXPECT_NEAR(radius, top, 1e-9);
+    ASSERT_TRUE(index.radiusEnvelopeAtZ(5.0, radius));
+    EXPECT_NEAR(radius, 15.0, 1e-9);
+    ASSERT_TRUE(index.radiusEnvelopeAtZ(2.0, radius, 3.0));
+    EXPECT_NEAR(radius, 15.0, 1e-9);
+}
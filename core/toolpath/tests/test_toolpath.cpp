@@ -2,6 +2,8 @@
 #include <IntuiCAM/Toolpath/Types.h>
 #include <IntuiCAM/Geometry/Types.h>
 
+#include <cmath>
+
 using namespace IntuiCAM::Toolpath;
 using namespace IntuiCAM::Geometry;
 
@@ -34,6 +36,29 @@ TEST_F(ToolpathCoreTest, AddMovementsIncreaseCountAndPreserveOrder) {
     EXPECT_DOUBLE_EQ(moves[1].feedRate, 100.0);
 }
 
+// Indexing views the interned strings; converting to Movement copies them out
+TEST_F(ToolpathCoreTest, MovementRecordViewsStringsAndConvertsToMovement) {
+    Toolpath tp("Records", tool);
+    tp.addRapidMove(Point3D(0, 0, 5), OperationType::Facing, "Face front");
+    Movement dwell(MovementType::Dwell, Point3D(0, 0, 5));
+    dwell.feedRate = 0.5;
+    dwell.comment = "Chip break";
+    dwell.operationName = "Face front";
+    tp.addMovement(dwell);
+
+    const MovementView moves = tp.getMovements();
+    const MovementRecord record = moves[1];
+    EXPECT_EQ(record.comment, "Chip break");
+    EXPECT_EQ(record.operationName, "Face front");
+    EXPECT_EQ(record.operationName.data(), moves[0].operationName.data());  // Interned once
+
+    const Movement copy = moves[1];
+    EXPECT_EQ(copy.type, MovementType::Dwell);
+    EXPECT_DOUBLE_EQ(copy.feedRate, 0.5);
+    EXPECT_EQ(copy.comment, "Chip break");
+    EXPECT_EQ(copy.operationName, "Face front");
+}
+
 // -----------------------------------------------------------------------------
 // Bounding-box computation
 // -----------------------------------------------------------------------------
@@ -82,4 +107,159 @@ TEST_F(ToolpathCoreTest, OptimizeToolpathRemovesRedundantMoves) {
     EXPECT_EQ(tp.getMovementCount(), 2u);
     EXPECT_EQ(tp.getMovements()[0].position.x, 0);
     EXPECT_EQ(tp.getMovements()[1].position.x, 5);
-} 
\ No newline at end of file
+} 
+// -----------------------------------------------------------------------------
+// Circular moves keep their centers through optimisation and time estimates
+// -----------------------------------------------------------------------------
+TEST_F(ToolpathCoreTest, CircularMovesKeepCenters) {
+    Toolpath tp("ArcTest", tool);
+    tp.addRapidMove(Point3D(10, 0, 5));
+    tp.addRapidMove(Point3D(10, 0, 5));                               // Redundant
+    tp.addCircularMove(Point3D(5, 0, 10), Point3D(5, 0, 5), false, 100.0);  // Quarter circle, r = 5
+    tp.addLinearMove(Point3D(0, 0, 10), 100.0);
+
+    tp.optimizeToolpath();
+
+    ASSERT_EQ(tp.getMovementCount(), 3u);
+    const auto moves = tp.getMovements();
+    EXPECT_EQ(moves.type(1), MovementType::CircularCCW);
+    EXPECT_DOUBLE_EQ(moves.arcCenter(1).x, 5.0);
+    EXPECT_DOUBLE_EQ(moves.arcCenter(1).z, 5.0);
+    EXPECT_DOUBLE_EQ(moves[1].center.x, 5.0);
+
+    // Arc length 2.5*pi plus 5 mm of line at 100 mm/min
+    EXPECT_NEAR(tp.estimateMachiningTime(), (2.5 * 3.14159265358979 + 5.0) / 100.0, 1e-6);
+}
+
+TEST_F(ToolpathCoreTest, OptimizeToolpathKeepsFullCirclesAndExplicitStarts) {
+    Toolpath tp("FullCircle", tool);
+    tp.addRapidMove(Point3D(10, 0, 5));
+    tp.addCircularMove(Point3D(10, 0, 5), Point3D(5, 0, 5), false, 100.0);  // Full circle, r = 5
+
+    // Ends where the circle ended, but starts 5 mm away
+    Movement jump(MovementType::Linear, Point3D(10, 0, 10), Point3D(10, 0, 5));
+    jump.feedRate = 100.0;
+    tp.addMovement(jump);
+    tp.addLinearMove(Point3D(10, 0, 5), 100.0);                              // Redundant
+
+    tp.optimizeToolpath();
+
+    ASSERT_EQ(tp.getMovementCount(), 3u);
+    const auto moves = tp.getMovements();
+    EXPECT_EQ(moves.type(1), MovementType::CircularCCW);
+    EXPECT_DOUBLE_EQ(moves.startPoint(2).z, 10.0);
+
+    // Circle of 10*pi plus the 5 mm explicit move at 100 mm/min
+    EXPECT_NEAR(tp.estimateMachiningTime(), (10.0 * 3.14159265358979 + 5.0) / 100.0, 1e-6);
+}
+
+TEST(ArcSweepAngleTest, DirectionAndMajorArcs) {
+    const Point3D center(0, 0, 0);
+    const Point3D start(1, 0, 0);   // axial +1
+    const Point3D top(0, 0, 1);     // radius +1
+
+    EXPECT_NEAR(arcSweepAngle(start, top, center, false), 3.14159265358979 / 2.0, 1e-12);
+    EXPECT_NEAR(arcSweepAngle(start, top, center, true), -3.0 * 3.14159265358979 / 2.0, 1e-12);
+    EXPECT_NEAR(std::abs(arcSweepAngle(start, start, center, true)), 2.0 * 3.14159265358979, 1e-12);
+}
+
+// -----------------------------------------------------------------------------
+// Compression merges collinear feed runs and fits arcs within tolerance
+// -----------------------------------------------------------------------------
+TEST_F(ToolpathCoreTest, OptimizeToolpathMergesCollinearRuns) {
+    Toolpath tp("LineTest", tool);
+    tp.addRapidMove(Point3D(0, 0, 10));
+    for (int i = 1; i <= 100; ++i) {
+        // Sub-tolerance wobble on a straight taper
+        const double wobble = (i % 2 == 0) ? 0.0005 : -0.0005;
+        tp.addLinearMove(Point3D(-0.5 * i, 0, 10 + 0.05 * i + wobble), 150.0);
+    }
+    tp.addRapidMove(Point3D(5, 0, 20));
+
+    tp.optimizeToolpath(0.002);
+
+    ASSERT_EQ(tp.getMovementCount(), 3u);
+    const auto moves = tp.getMovements();
+    EXPECT_EQ(moves.type(1), MovementType::Linear);
+    EXPECT_DOUBLE_EQ(moves.position(1).x, -50.0);
+    EXPECT_DOUBLE_EQ(moves.startPoint(1).z, 10.0);
+}
+
+TEST_F(ToolpathCoreTest, OptimizeToolpathFitsArcsToChains) {
+    const double pi = 3.14159265358979;
+    Toolpath tp("ArcFitTest", tool);
+    tp.addRapidMove(Point3D(10, 0, 0));
+    for (int i = 1; i <= 90; ++i) {
+        // Quarter circle, r = 10, swept counter-clockwise in 1 degree chords
+        const double angle = i * pi / 180.0;
+        tp.addLinearMove(Point3D(10 * std::cos(angle), 0, 10 * std::sin(angle)), 100.0);
+    }
+
+    tp.optimizeToolpath(0.01);
+
+    const auto moves = tp.getMovements();
+    ASSERT_GE(moves.size(), 2u);
+    EXPECT_LE(moves.size(), 4u);
+    for (size_t i = 1; i < moves.size(); ++i) {
+        EXPECT_EQ(moves.type(i), MovementType::CircularCCW);
+        EXPECT_NEAR(moves.arcCenter(i).x, 0.0, 0.01);
+        EXPECT_NEAR(moves.arcCenter(i).z, 0.0, 0.01);
+    }
+    EXPECT_NEAR(moves.position(moves.size() - 1).z, 10.0, 1e-9);
+    EXPECT_NEAR(tp.estimateMachiningTime(), 5.0 * pi / 100.0, 1e-3);
+}
+
+TEST_F(ToolpathCoreTest, OptimizeToolpathDropsZeroLengthExcursions) {
+    Toolpath tp("ExcursionTest", tool);
+    tp.addRapidMove(Point3D(0, 0, 10));
+    tp.addLinearMove(Point3D(0, 0, 8), 100.0);
+    tp.addRapidMove(Point3D(0, 0, 12));      // Retract...
+    tp.addRapidMove(Point3D(0, 0, 8));       // ...and straight back
+    tp.addLinearMove(Point3D(-10, 0, 8), 100.0);
+
+    tp.optimizeToolpath(0.0);
+
+    ASSERT_EQ(tp.getMovementCount(), 3u);
+    EXPECT_EQ(tp.getMovements().type(2), MovementType::Linear);
+    EXPECT_DOUBLE_EQ(tp.getMovements().startPoint(2).z, 8.0);
+}
+
+TEST_F(ToolpathCoreTest, OptimizeToolpathKeepsThreadingMovesLinear) {
+    Toolpath tp("ThreadTest", tool);
+    tp.addRapidMove(Point3D(10, 0, 0));
+    for (int i = 1; i <= 30; ++i) {
+        const double angle = i * 3.14159265358979 / 60.0;
+        tp.addThreadingMove(Point3D(10 * std::cos(angle), 0, 10 * std::sin(angle)), 1.5, 1.5);
+    }
+
+    tp.optimizeToolpath(0.01);
+
+    const auto moves = tp.getMovements();
+    for (size_t i = 0; i < moves.size(); ++i) {
+        EXPECT_FALSE(moves.type(i) == MovementType::CircularCW || moves.type(i) == MovementType::CircularCCW);
+    }
+}
+
+TEST_F(ToolpathCoreTest, EstimateMachiningTimeResolvesFeedPerRevAndDwell) {
+    Toolpath tp("FeedModeTest", tool);
+    tp.addRapidMove(Point3D(0, 0, 10));
+
+    // 0.2 mm/rev at 500 RPM is 100 mm/min
+    Movement cut(MovementType::Linear, Point3D(0, 0, 10), Point3D(-10, 0, 10));
+    cut.feedRate = 0.2;
+    cut.feedMode = FeedMode::PerRevolution;
+    cut.spindleSpeed = 500.0;
+    tp.addMovement(cut);
+    tp.addDwell(3.0);
+
+    const double rapid = tp.estimateMachiningTime() - 10.0 / 100.0 - 3.0 / 60.0;
+    EXPECT_GE(rapid, 0.0);
+    EXPECT_LT(rapid, 1e-2);
+
+    // Constant surface speed: 31.4 m/min at r = 10 mm is 500 RPM
+    Toolpath css("CssTest", tool);
+    cut.spindleSpeed = 0.0;
+    cut.surfaceSpeed = 2.0 * 3.14159265358979 * 10.0 * 500.0 / 1000.0;
+    css.addMovement(cut);
+    EXPECT_NEAR(css.estimateMachiningTime(), 10.0 / 100.0, 1e-6);
+}
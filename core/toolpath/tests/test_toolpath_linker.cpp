@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/Toolpath/ToolpathLinker.h>
+
+#include <algorithm>
+
+using namespace IntuiCAM::Toolpath;
+using IntuiCAM::Geometry::Point3D;
+
+namespace {
+
+ToolpathLinker::Parameters stockParameters() {
+    ToolpathLinker::Parameters params;
+    params.stockRadius = 10.0;
+    params.stockFrontZ = 50.0;
+    params.stockBackZ = 0.0;
+    params.clearance = 2.0;
+    return params;
+}
+
+// Axial passes from the front towards the chuck, retracting to raw radius + 5
+// and returning to the front between passes
+std::unique_ptr<Toolpath> makeRoughingPasses(const std::vector<double>& radii, double endX) {
+    auto toolpath = std::make_unique<Toolpath>("roughing", std::make_shared<Tool>(Tool::Type::Turning, "T1"),
+                                               OperationType::ExternalRoughing);
+    toolpath->addRapidMove(Point3D(51.0, 0.0, 15.0));
+    for (double radius : radii) {
+        toolpath->addRapidMove(Point3D(51.0, 0.0, radius));
+        toolpath->addLinearMove(Point3D(endX, 0.0, radius), 200.0);
+        toolpath->addRapidMove(Point3D(endX, 0.0, 15.0));
+        toolpath->addRapidMove(Point3D(51.0, 0.0, 15.0));
+    }
+    return toolpath;
+}
+
+std::vector<Point3D> cutEndPoints(const Toolpath& toolpath) {
+    std::vector<Point3D> points;
+    const MovementView moves = toolpath.getMovements();
+    for (size_t i = 0; i < moves.size(); ++i) {
+        if (moves.type(i) == MovementType::Linear) {
+            points.push_back(moves.position(i));
+        }
+    }
+    return points;
+}
+
+} // namespace
+
+TEST(ToolpathLinkerTest, LowersRetractsToRemainingStock) {
+    std::vector<std::unique_ptr<Toolpath>> timeline;
+    timeline.push_back(makeRoughingPasses({9.0, 8.0, 7.0}, 20.0));
+    const std::vector<Point3D> cutsBefore = cutEndPoints(*timeline.front());
+
+    const ToolpathLinker::Report report = ToolpathLinker(stockParameters()).link(timeline);
+
+    EXPECT_EQ(report.linksRerouted, 2u);
+    EXPECT_LT(report.timeAfter, report.timeBefore);
+    EXPECT_GT(report.timeSaved(), 0.0);
+
+    // Cuts are untouched
+    const std::vector<Point3D> cutsAfter = cutEndPoints(*timeline.front());
+    ASSERT_EQ(cutsAfter.size(), cutsBefore.size());
+    for (size_t i = 0; i < cutsBefore.size(); ++i) {
+        EXPECT_DOUBLE_EQ(cutsAfter[i].x, cutsBefore[i].x);
+        EXPECT_DOUBLE_EQ(cutsAfter[i].z, cutsBefore[i].z);
+    }
+
+    // After the first pass the link clears 9 mm of stock by 2 mm, not 15 mm
+    const MovementView moves = timeline.front()->getMovements();
+    size_t firstCut = 0;
+    while (moves.type(firstCut) != MovementType::Linear) ++firstCut;
+    EXPECT_EQ(moves.type(firstCut + 1), MovementType::Rapid);
+    EXPECT_DOUBLE_EQ(moves.position(firstCut + 1).x, 20.0);
+    EXPECT_DOUBLE_EQ(moves.position(firstCut + 1).z, 11.0);
+    EXPECT_DOUBLE_EQ(moves.position(firstCut + 2).z, 11.0);
+    EXPECT_DOUBLE_EQ(moves.position(firstCut + 3).z, 8.0);
+}
+
+TEST(ToolpathLinkerTest, EnvelopeCarriesAcrossTimeline) {
+    std::vector<std::unique_ptr<Toolpath>> timeline;
+    timeline.push_back(makeRoughingPasses({6.0}, 10.0));
+
+    // A later operation with unlabelled moves, linked against the roughed stock
+    auto finishing = makeRoughingPasses({5.5, 5.0}, 10.0);
+    finishing->setOperationType(OperationType::ExternalFinishing);
+    timeline.push_back(std::move(finishing));
+
+    const ToolpathLinker::Report report = ToolpathLinker(stockParameters()).link(timeline);
+    EXPECT_EQ(report.linksRerouted, 1u);
+
+    // Rapids between the two finishing cuts
+    double highestLink = 0.0;
+    const MovementView moves = timeline.back()->getMovements();
+    size_t firstCut = 0;
+    size_t lastCut = moves.size() - 1;
+    while (moves.type(firstCut) != MovementType::Linear) ++firstCut;
+    while (moves.type(lastCut) != MovementType::Linear) --lastCut;
+    for (size_t i = firstCut + 1; i < lastCut; ++i) {
+        if (moves.type(i) == MovementType::Rapid) {
+            highestLink = std::max(highestLink, moves.position(i).z);
+        }
+    }
+    EXPECT_DOUBLE_EQ(highestLink, 7.5);
+}
+
+TEST(ToolpathLinkerTest, KeepsLinksWithoutClearPath) {
+    // Boring inside the stock: retracting outwards would run through the wall
+    auto boring = std::make_unique<Toolpath>("boring", std::make_shared<Tool>(Tool::Type::Turning, "T2"),
+                                             OperationType::InternalRoughing);
+    boring->addRapidMove(Point3D(52.0, 0.0, 3.0));
+    boring->addLinearMove(Point3D(30.0, 0.0, 3.0), 100.0);
+    boring->addRapidMove(Point3D(30.0, 0.0, 2.5));
+    boring->addRapidMove(Point3D(52.0, 0.0, 2.5));
+    boring->addRapidMove(Point3D(52.0, 0.0, 3.5));
+    boring->addLinearMove(Point3D(30.0, 0.0, 3.5), 100.0);
+
+    std::vector<std::unique_ptr<Toolpath>> timeline;
+    timeline.push_back(std::move(boring));
+    const Toolpath* original = timeline.front().get();
+
+    const ToolpathLinker::Report report = ToolpathLinker(stockParameters()).link(timeline);
+
+    EXPECT_EQ(report.linksRerouted, 0u);
+    EXPECT_EQ(timeline.front().get(), original);
+    EXPECT_DOUBLE_EQ(report.timeSaved(), 0.0);
+}
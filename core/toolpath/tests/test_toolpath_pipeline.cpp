@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/Toolpath/ToolpathGenerationPipeline.h>
+#include <IntuiCAM/Toolpath/Types.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace IntuiCAM::Toolpath;
+
+namespace {
+
+// Inputs with only the cheap, geometry-free stages enabled
+ToolpathGenerationPipeline::PipelineInputs makeInputs() {
+    ToolpathGenerationPipeline::PipelineInputs inputs;
+    inputs.facing = false;
+    inputs.externalRoughing = false;
+    inputs.externalFinishing = false;
+    inputs.internalRoughing = false;
+    inputs.internalFinishing = false;
+    inputs.parting = false;
+
+    ToolpathGenerationPipeline::DetectedFeature hole;
+    hole.type = "hole";
+    hole.depth = 20.0;
+    hole.diameter = 8.0;
+    hole.tool = "drill_8mm";
+    inputs.featuresToBeDrilled.push_back(hole);
+
+    ToolpathGenerationPipeline::DetectedFeature groove;
+    groove.type = "groove";
+    groove.coordinates = IntuiCAM::Geometry::Point3D(25.0, 0.0, 10.0);
+    groove.tool = "grooving tool";
+    inputs.externalFeaturesToBeGrooved.push_back(groove);
+
+    ToolpathGenerationPipeline::DetectedFeature thread;
+    thread.type = "thread";
+    thread.coordinates = IntuiCAM::Geometry::Point3D(40.0, 0.0, 10.0);
+    thread.tool = "threading tool";
+    inputs.featuresToBeThreaded.push_back(thread);
+    return inputs;
+}
+
+std::vector<std::string> timelineNames(const ToolpathGenerationPipeline::PipelineResult& result) {
+    std::vector<std::string> names;
+    for (const auto& tp : result.timeline) {
+        names.push_back(tp->getName());
+    }
+    return names;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Parallel stage execution keeps the chronological timeline order
+// -----------------------------------------------------------------------------
+TEST(ToolpathPipelineTest, ParallelTimelineMatchesSerialOrder) {
+    auto inputs = makeInputs();
+
+    inputs.maxParallelStages = 1;
+    ToolpathGenerationPipeline serialPipeline;
+    auto serial = serialPipeline.executePipeline(inputs);
+    ASSERT_TRUE(serial.success) << serial.errorMessage;
+    ASSERT_FALSE(serial.timeline.empty());
+
+    inputs.maxParallelStages = 4;
+    ToolpathGenerationPipeline parallelPipeline;
+    auto parallel = parallelPipeline.executePipeline(inputs);
+    ASSERT_TRUE(parallel.success) << parallel.errorMessage;
+
+    EXPECT_EQ(timelineNames(serial), timelineNames(parallel));
+    EXPECT_EQ(parallel.timeline.front()->getOperationType(), OperationType::Drilling);
+    EXPECT_EQ(parallel.timeline.back()->getOperationType(), OperationType::Threading);
+}
+
+// -----------------------------------------------------------------------------
+// Stage memoization only regenerates stages whose inputs changed
+// -----------------------------------------------------------------------------
+TEST(ToolpathPipelineTest, StageCacheReusesUnchangedStages) {
+    auto cache = std::make_shared<PipelineStageCache>();
+    ToolpathGenerationPipeline pipeline;
+    pipeline.setStageCache(cache);
+
+    auto inputs = makeInputs();
+    auto first = pipeline.executePipeline(inputs);
+    ASSERT_TRUE(first.success);
+    EXPECT_EQ(cache->getHitCount(), 0u);
+
+    // Only the threading slice changes - every other stage is reused
+    inputs.featuresToBeThreaded.front().geometry["pitch"] = 2.0;
+    auto second = pipeline.executePipeline(inputs);
+    ASSERT_TRUE(second.success);
+    EXPECT_EQ(cache->getHitCount(), 4u);  // drilling, both grooving stages, chamfering
+    EXPECT_EQ(timelineNames(first), timelineNames(second));
+    ASSERT_EQ(first.timeline.front()->getMovementCount(), second.timeline.front()->getMovementCount());
+}
+
+// -----------------------------------------------------------------------------
+// Asynchronous job handle
+// -----------------------------------------------------------------------------
+TEST(ToolpathPipelineTest, AsyncJobDeliversResult) {
+    auto job = ToolpathGenerationPipeline::executePipelineAsync(makeInputs());
+
+    ASSERT_TRUE(job->waitFor(std::chrono::seconds(30)));
+    EXPECT_EQ(job->getState(), PipelineJob::State::Completed);
+
+    auto result = job->takeResult();
+    EXPECT_TRUE(result.success);
+    EXPECT_FALSE(result.timeline.empty());
+    EXPECT_FALSE(job->takeResult().success);  // result can only be taken once
+}
+
+TEST(ToolpathPipelineTest, WaitReturnsAfterCompletionCallback) {
+    std::atomic<bool> callbackReturned{false};
+    auto job = ToolpathGenerationPipeline::executePipelineAsync(
+        makeInputs(), nullptr,
+        [&callbackReturned](const std::shared_ptr<PipelineJob>& finished) {
+            // The result is already available inside the callback
+            EXPECT_NE(finished->getState(), PipelineJob::State::Running);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            callbackReturned = true;
+        });
+
+    // A caller that waits may then destroy whatever the callback captured
+    job->wait();
+    EXPECT_TRUE(callbackReturned);
+    EXPECT_TRUE(job->isFinished());
+}
+
+TEST(ToolpathPipelineTest, CancelBeforeFirstProgressIsNotLost) {
+    auto job = ToolpathGenerationPipeline::executePipelineAsync(makeInputs());
+    job->cancel();
+
+    ASSERT_TRUE(job->waitFor(std::chrono::seconds(30)));
+    EXPECT_EQ(job->getState(), PipelineJob::State::Cancelled);
+    EXPECT_FALSE(job->takeResult().success);
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <IntuiCAM/Common/Trace.h>
+
+#include <algorithm>
+#include <string>
+
+using IntuiCAM::Common::TraceEvent;
+using IntuiCAM::Common::Tracer;
+
+// Spans are compiled the way the pipeline uses them, so a macro or
+// constructor mismatch fails this build when INTUICAM_ENABLE_TRACING is on
+TEST(TraceTest, RecordsLiteralAndRuntimeSpanNames) {
+    Tracer& tracer = Tracer::instance();
+    tracer.clear();
+    tracer.setEnabled(true);
+    {
+        const std::string stage = "facing";
+        TRACE_SPAN("pipeline", "executePipeline");
+        TRACE_SPAN("pipeline", "stage: " + stage);
+        TRACE_COUNTER("pipeline", "timeline toolpaths", 3);
+    }
+    tracer.setEnabled(false);
+
+#if INTUICAM_ENABLE_TRACING
+    const std::vector<TraceEvent> events = tracer.collect();
+    auto has = [&](const std::string& name, const std::string& category) {
+        return std::any_of(events.begin(), events.end(), [&](const TraceEvent& event) {
+            return name == event.name && category == event.category;
+        });
+    };
+    EXPECT_TRUE(has("executePipeline", "pipeline"));
+    EXPECT_TRUE(has("stage: facing", "pipeline"));
+    EXPECT_TRUE(has("timeline toolpaths", "pipeline"));
+#endif
+    tracer.clear();
+}
+
+TEST(TraceTest, RuntimeSpanNameIsNotBuiltWhileDisabled) {
+    Tracer& tracer = Tracer::instance();
+    tracer.clear();
+    tracer.setEnabled(false);
+
+    int built = 0;
+    auto stageName = [&built]() {
+        ++built;
+        return std::string("stage: facing");
+    };
+    (void)stageName;    // Unused when tracing is compiled out
+    {
+        TRACE_SPAN("pipeline", stageName());
+    }
+    EXPECT_EQ(built, 0);
+    EXPECT_TRUE(tracer.collect().empty());
+
+#if INTUICAM_ENABLE_TRACING
+    tracer.setEnabled(true);
+    {
+        TRACE_SPAN("pipeline", stageName());
+    }
+    tracer.setEnabled(false);
+    EXPECT_EQ(built, 1);
+    EXPECT_EQ(tracer.collect().size(), 1u);
+#endif
+    tracer.clear();
+}
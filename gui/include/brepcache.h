@@ -0,0 +1,69 @@
+#ifndef BREPCACHE_H
+#define BREPCACHE_H
+
+#include <QString>
+#include <TopoDS_Shape.hxx>
+#include <atomic>
+#include <mutex>
+
+/**
+ * @brief Persistent cache of imported shapes in OCCT binary BRep format
+ *
+ * Entries are keyed by a content hash of the source file, so an edited file
+ * misses the cache even when its name and timestamp are unchanged. Shapes are
+ * stored with their triangulation, which lets a cache hit skip STEP parsing,
+ * transfer, healing and meshing altogether.
+ *
+ * All methods are thread-safe; imports on worker threads share one instance.
+ */
+class BRepCache
+{
+public:
+    static BRepCache& instance();
+
+    BRepCache(const BRepCache&) = delete;
+    BRepCache& operator=(const BRepCache&) = delete;
+
+    void setEnabled(bool enabled) { m_enabled = enabled; }
+    bool isEnabled() const { return m_enabled; }
+
+    // Defaults to <CacheLocation>/brep
+    void setDirectory(const QString& directory);
+    QString getDirectory() const;
+
+    // Oldest entries are removed once the cache grows past this size
+    void setMaxSizeBytes(qint64 maxSizeBytes) { m_maxSizeBytes = maxSizeBytes; }
+
+    /**
+     * @brief Cache key for a source file
+     * @return Hex digest of the file contents and cache format, or an empty
+     *         string if the file cannot be read
+     */
+    QString computeKey(const QString& sourceFilePath) const;
+
+    /**
+     * @brief Load a cached shape
+     * @return True and the shape if an entry for the key exists and reads back
+     */
+    bool load(const QString& key, TopoDS_Shape& shape) const;
+
+    // Store a shape; an existing entry for the key is left untouched
+    bool store(const QString& key, const TopoDS_Shape& shape);
+
+    // Remove every cache entry
+    void clear();
+
+private:
+    BRepCache();
+
+    QString entryPath(const QString& key) const;
+    void prune();
+
+    std::atomic<bool> m_enabled{true};
+    std::atomic<qint64> m_maxSizeBytes;
+
+    mutable std::mutex m_mutex;
+    QString m_directory;
+};
+
+#endif // BREPCACHE_H
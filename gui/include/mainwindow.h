@@ -19,6 +19,9 @@
 #include <QMenu>
 #include <QTimer>
 
+#include <memory>
+#include <vector>
+
 // OpenCASCADE includes
 #include <gp_Ax1.hxx>
 #include <gp_Pnt.hxx>
@@ -32,6 +35,7 @@
 // Forward declarations for our custom classes
 class OpenGL3DWidget;
 class StepLoader;
+class StepImportJob;
 class WorkspaceController;
 class PartLoadingPanel;
 class WorkpieceManager;
@@ -48,6 +52,10 @@ namespace GUI {
     enum class MaterialType;
     enum class SurfaceFinish;
 }
+namespace Toolpath {
+    class PipelineJob;
+    class PipelineStageCache;
+}
 }
 
 // Include CylinderInfo definition
@@ -249,6 +257,19 @@ private:
     // Timer for debouncing toolpath regeneration
     QTimer* m_toolpathRegenerationTimer;
 
+    // Background toolpath generation; a newer request supersedes (cancels) the
+    // running ones. Every job still in flight is kept so the destructor can join it.
+    std::vector<std::shared_ptr<IntuiCAM::Toolpath::PipelineJob>> m_toolpathJobs;
+    quint64 m_toolpathGeneration = 0;
+    
+    // Per-stage results shared by successive jobs so parameter tweaks only regenerate affected stages
+    std::shared_ptr<IntuiCAM::Toolpath::PipelineStageCache> m_toolpathStageCache;
+
+    // Background STEP import; opening another file supersedes (cancels) the
+    // running ones. Every import still in flight is kept so the destructor can join it.
+    std::vector<std::shared_ptr<StepImportJob>> m_stepImportJobs;
+    quint64 m_stepImportGeneration = 0;
+
 private:
     void createViewModeOverlayButton(QWidget* parent);
     void updateViewModeOverlayButton();
@@ -261,6 +282,10 @@ private:
     
     // Helper methods
     QString getDefaultToolForOperation(const QString& operationName) const;
+    void handleToolpathJobFinished(const std::shared_ptr<IntuiCAM::Toolpath::PipelineJob>& job,
+                                   quint64 generation);
+    void startStepImport(const QString& filePath);
+    void handleStepImportFinished(const std::shared_ptr<StepImportJob>& job, quint64 generation);
 
     QVector<Handle(AIS_Shape)> m_candidateThreadFaces;
     Handle(AIS_Shape) m_currentThreadFaceAIS;
@@ -203,6 +203,13 @@ signals:
      */
     void shapeSelected(const TopoDS_Shape& selectedShape, const gp_Pnt& clickPoint);
 
+    /**
+     * @brief Emitted when a toolpath move is picked in selection mode
+     * @param toolpathName Name of the picked toolpath
+     * @param moveIndex Index of the picked move within that toolpath
+     */
+    void toolpathMoveSelected(const QString& toolpathName, int moveIndex);
+
     /**
      * @brief Emitted when the view mode changes
      * @param mode The new viewing mode
@@ -242,6 +249,19 @@ private:
      */
     void updateView();
     
+    /**
+     * @brief Match each toolpath's wireframe detail level to the current zoom
+     */
+    void updateToolpathLevelOfDetail();
+    
+    /**
+     * @brief Highlight one toolpath move, clearing the previous one
+     * @param toolpathObj Toolpath to highlight in, or null to clear only
+     * @param moveIndex Move within that toolpath
+     */
+    void selectToolpathMove(const Handle(IntuiCAM::Toolpath::ToolpathDisplayObject)& toolpathObj,
+                            size_t moveIndex);
+    
     /**
      * @brief Apply camera settings based on current view mode
      */
@@ -309,6 +329,9 @@ private:
     // Selection mode
     bool m_selectionMode;
 
+    // Toolpath whose picked move is highlighted, if any
+    Handle(IntuiCAM::Toolpath::ToolpathDisplayObject) m_selectedMoveToolpath;
+
     // Auto-fit
     bool m_autoFitEnabled;
 
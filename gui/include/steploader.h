@@ -3,21 +3,44 @@
 
 #include <QString>
 #include <TopoDS_Shape.hxx>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <IntuiCAM/Geometry/IStepLoader.h>
 
+class StepImportJob;
+
 class StepLoader : public IntuiCAM::Geometry::IStepLoader
 {
 public:
+    using ProgressCallback = std::function<void(double, const std::string&)>;
+    using CompletionCallback = std::function<void(const std::shared_ptr<StepImportJob>&)>;
+
     StepLoader();
     ~StepLoader();
-    
+
     // Load a STEP file and return the shape
     TopoDS_Shape loadStepFile(const std::string& filename) override;
-    
+
+    /**
+     * @brief Import a STEP file on a worker thread
+     *
+     * Runs the same parse, transfer, heal and mesh stages as loadStepFile().
+     * Both callbacks are invoked on the worker thread; GUI callers must
+     * marshal them back to the GUI thread themselves.
+     */
+    static std::shared_ptr<StepImportJob> loadStepFileAsync(const std::string& filename,
+                                                            ProgressCallback progressCallback = nullptr,
+                                                            CompletionCallback completionCallback = nullptr);
+
     // Get the last error message
     std::string getLastError() const override { return m_lastError; }
-    
+
     // Check if the last operation was successful
     bool isValid() const override { return m_isValid; }
 
@@ -26,4 +49,76 @@ private:
     bool m_isValid;
 };
 
-#endif // STEPLOADER_H 
\ No newline at end of file
+/**
+ * @brief Handle to a STEP import running in the background
+ *
+ * Progress is reported per stage (parse, transfer, heal, mesh) as an overall
+ * fraction. cancel() is honoured inside OCCT transfer, healing and meshing,
+ * and between stages; parsing itself cannot be interrupted.
+ */
+class StepImportJob : public std::enable_shared_from_this<StepImportJob>
+{
+public:
+    enum class State {
+        Running,
+        Completed,
+        Failed,
+        Cancelled
+    };
+
+    ~StepImportJob() = default;
+
+    // Unique, monotonically increasing id - later jobs always have larger ids
+    std::uint64_t getId() const { return m_id; }
+    const std::string& getFilename() const { return m_filename; }
+
+    State getState() const { return m_state; }
+    bool isFinished() const;
+    bool isCancelRequested() const { return m_cancelRequested; }
+
+    // Last progress value reported by the import (0..1)
+    double getProgress() const { return m_progress; }
+
+    void cancel() { m_cancelRequested = true; }
+
+    // Block until the job has finished and its completion callback has returned
+    void wait() const;
+    bool waitFor(std::chrono::milliseconds timeout) const;
+
+    /**
+     * @brief Move the shape out of a finished job
+     * @return The imported shape, or a null shape if the job is still running,
+     *         failed, or the shape was already taken
+     */
+    TopoDS_Shape takeShape();
+
+    // Error message of a failed or cancelled job
+    std::string getError() const;
+
+private:
+    friend class StepLoader;
+
+    StepImportJob(const std::string& filename,
+                  StepLoader::ProgressCallback progressCallback,
+                  StepLoader::CompletionCallback completionCallback);
+
+    void start();
+    void run();
+
+    std::uint64_t m_id;
+    std::string m_filename;
+    StepLoader::ProgressCallback m_progressCallback;
+    StepLoader::CompletionCallback m_completionCallback;
+
+    std::atomic<State> m_state{State::Running};
+    std::atomic<bool> m_cancelRequested{false};
+    std::atomic<double> m_progress{0.0};
+
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_finishedCondition;
+    TopoDS_Shape m_shape;
+    std::string m_error;
+    bool m_finished = false;    // Set once the completion callback has returned
+};
+
+#endif // STEPLOADER_H
@@ -245,7 +245,6 @@ private:
     void setupCapabilitiesForToolType(IntuiCAM::Toolpath::ToolType toolType);
     
     // Tool assembly persistence
-    QString getToolAssemblyDatabasePath() const;
     bool saveToolAssemblyToDatabase();
     bool loadToolAssemblyFromDatabase(const QString& toolId);
     QJsonObject toolAssemblyToJson(const IntuiCAM::Toolpath::ToolAssembly& assembly) const;
@@ -425,6 +424,7 @@ private:
     // Auto-save system
     QTimer* m_autoSaveTimer;
     bool m_autoSaveEnabled;
+    QString m_unwrittenToolId;  // Stored in the repository, not yet on disk
     
     // 3D Visualization
     Handle(AIS_InteractiveContext) m_aisContext;
@@ -145,10 +145,9 @@ private:
     QIcon getToolTypeIcon(IntuiCAM::Toolpath::ToolType toolType) const;
     QColor getToolStatusColor(bool isActive) const;
     QString getToolStatusText(bool isActive) const;
-    QString getToolAssemblyDatabasePath() const;
     
     // Database operations
-    bool deleteToolFromDatabase(const QString& toolId, const QString& databasePath);
+    bool deleteToolFromDatabase(const QString& toolId);
     bool verifyToolInDatabase(const QString& toolId);
     void cleanupEmptyIdTools();
     
@@ -0,0 +1,130 @@
+#ifndef TOOLREPOSITORY_H
+#define TOOLREPOSITORY_H
+
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <QVector>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace IntuiCAM {
+namespace GUI {
+
+/**
+ * @brief Process-wide, in-memory tool assembly database
+ *
+ * Owns tool_assemblies.json. The file is parsed once on first use; after
+ * that every reader works on the in-memory tools and the indexes by id, tool
+ * type and ISO code (insert and holder).
+ *
+ * Changes are persisted write-behind: each mutation restarts a short timer,
+ * and when it fires the latest snapshot is serialized and written by a
+ * background thread. Bursts of edits coalesce into one write and UI actions
+ * never wait on the disk. saved() or saveFailed() reports each background
+ * write once it is done. flush() writes synchronously and runs at shutdown.
+ *
+ * GUI-thread only, except for the internal writer thread.
+ */
+class ToolRepository : public QObject
+{
+    Q_OBJECT
+
+public:
+    static ToolRepository& instance();
+
+    ~ToolRepository() override;
+
+    QString databasePath() const { return m_databasePath; }
+
+    // False when no database file existed or it could not be parsed
+    bool wasLoadedFromDisk() const { return m_loadedFromDisk; }
+
+    int toolCount() const { return m_tools.size(); }
+    bool isEmpty() const { return m_tools.isEmpty(); }
+
+    // Tools in database order
+    const QVector<QJsonObject>& tools() const { return m_tools; }
+    QStringList toolIds() const;
+
+    bool contains(const QString& toolId) const { return m_indexById.contains(toolId); }
+    QJsonObject tool(const QString& toolId) const;
+
+    QStringList toolIdsByType(int toolType) const { return m_idsByType.value(toolType); }
+    QStringList toolIdsByIsoCode(const QString& isoCode) const { return m_idsByIsoCode.value(isoCode); }
+
+    // Root fields other than the tool array (version, description, ...)
+    QJsonObject metadata() const { return m_metadata; }
+
+    /**
+     * @brief Add a tool, or replace the tool with the same id
+     * @return False for a tool without an id
+     */
+    bool upsertTool(const QJsonObject& toolJson);
+
+    // Remove a tool; an empty id removes the first tool without an id
+    bool removeTool(const QString& toolId);
+
+    // Drop tools stored without an id; returns the number removed
+    int removeToolsWithEmptyId();
+
+    // Replace the whole library
+    void replaceAll(const QJsonArray& tools, const QJsonObject& metadata);
+
+    // Write pending changes now and wait for the disk
+    bool flush();
+
+signals:
+    void toolAdded(const QString& toolId);
+    void toolUpdated(const QString& toolId);
+    void toolRemoved(const QString& toolId);
+    void repositoryReset();
+
+    // A background write reached the disk, or failed; both arrive on the GUI thread
+    void saved();
+    void saveFailed(const QString& error);
+
+private:
+    explicit ToolRepository(QObject* parent = nullptr);
+
+    void load();
+    void rebuildIndexes();
+    void indexTool(int position);
+    void scheduleSave();
+    QJsonObject snapshot() const;
+
+    void writerLoop();
+    bool writeSnapshot(const QJsonObject& root, QString& error) const;
+
+    QString m_databasePath;
+    bool m_loadedFromDisk = false;
+
+    QJsonObject m_metadata;
+    QVector<QJsonObject> m_tools;
+    QHash<QString, int> m_indexById;
+    QHash<int, QStringList> m_idsByType;
+    QHash<QString, QStringList> m_idsByIsoCode;
+
+    QTimer m_saveTimer;
+
+    // Write-behind state shared with the writer thread
+    std::thread m_writer;
+    mutable std::mutex m_writerMutex;
+    std::condition_variable m_writerCondition;
+    QJsonObject m_pendingSnapshot;
+    bool m_hasPendingSnapshot = false;
+    bool m_writeInProgress = false;
+    bool m_stopWriter = false;
+    std::condition_variable m_idleCondition;
+};
+
+} // namespace GUI
+} // namespace IntuiCAM
+
+#endif // TOOLREPOSITORY_H
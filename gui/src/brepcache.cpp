@@ -0,0 +1,178 @@
+#include "brepcache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QTemporaryFile>
+
+#include <BinTools.hxx>
+#include <Standard_Failure.hxx>
+#include <Standard_Version.hxx>
+
+#include <IntuiCAM/Common/Trace.h>
+
+namespace {
+
+// Bump when the import stages change what gets stored (healing, meshing)
+constexpr const char* kCacheFormat = "intuicam-brep-v1";
+
+constexpr qint64 kDefaultMaxSizeBytes = 1024LL * 1024LL * 1024LL;
+
+} // namespace
+
+BRepCache& BRepCache::instance()
+{
+    static BRepCache cache;
+    return cache;
+}
+
+BRepCache::BRepCache()
+    : m_maxSizeBytes(kDefaultMaxSizeBytes)
+    , m_directory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/brep")
+{
+}
+
+void BRepCache::setDirectory(const QString& directory)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_directory = directory;
+}
+
+QString BRepCache::getDirectory() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_directory;
+}
+
+QString BRepCache::entryPath(const QString& key) const
+{
+    return QDir(getDirectory()).absoluteFilePath(key + ".brep");
+}
+
+QString BRepCache::computeKey(const QString& sourceFilePath) const
+{
+    TRACE_SPAN("import", "BRepCache::computeKey");
+
+    QFile file(sourceFilePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+
+    // The OCCT version is part of the key because the binary format and the
+    // transfer results both depend on it
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(QByteArray(kCacheFormat));
+    hash.addData(QByteArray(OCC_VERSION_COMPLETE));
+    if (!hash.addData(&file)) {
+        return QString();
+    }
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+bool BRepCache::load(const QString& key, TopoDS_Shape& shape) const
+{
+    if (!m_enabled || key.isEmpty()) {
+        return false;
+    }
+
+    TRACE_SPAN("import", "BRepCache::load");
+    const QString path = entryPath(key);
+    if (!QFileInfo::exists(path)) {
+        return false;
+    }
+
+    try {
+        TopoDS_Shape cached;
+        if (!BinTools::Read(cached, QFile::encodeName(path).constData()) || cached.IsNull()) {
+            qDebug() << "BRepCache: discarding unreadable entry" << path;
+            QFile::remove(path);
+            return false;
+        }
+        shape = cached;
+    } catch (const Standard_Failure& e) {
+        qDebug() << "BRepCache: failed to read" << path << "-" << e.GetMessageString();
+        QFile::remove(path);
+        return false;
+    }
+
+    // Refresh the timestamp so pruning evicts least recently used entries
+    QFile entry(path);
+    if (entry.open(QIODevice::ReadWrite)) {
+        entry.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+    }
+    return true;
+}
+
+bool BRepCache::store(const QString& key, const TopoDS_Shape& shape)
+{
+    if (!m_enabled || key.isEmpty() || shape.IsNull()) {
+        return false;
+    }
+
+    TRACE_SPAN("import", "BRepCache::store");
+    const QString path = entryPath(key);
+    if (QFileInfo::exists(path)) {
+        return true;
+    }
+
+    QDir dir(getDirectory());
+    if (!dir.exists() && !dir.mkpath(".")) {
+        return false;
+    }
+
+    // Write to a uniquely named file in the cache directory and rename it into
+    // place, so concurrent imports, in this or another process, never observe
+    // a partial entry
+    QTemporaryFile temp(path + QStringLiteral(".XXXXXX.tmp"));
+    if (!temp.open()) {
+        return false;
+    }
+    const QString tempPath = temp.fileName();
+    temp.close();
+    try {
+        if (!BinTools::Write(shape, QFile::encodeName(tempPath).constData())) {
+            return false;
+        }
+    } catch (const Standard_Failure& e) {
+        qDebug() << "BRepCache: failed to write" << tempPath << "-" << e.GetMessageString();
+        return false;
+    }
+
+    if (!temp.rename(path)) {
+        // Another import stored the same entry first
+        return QFileInfo::exists(path);
+    }
+    temp.setAutoRemove(false);
+
+    prune();
+    return true;
+}
+
+void BRepCache::prune()
+{
+    QDir dir(getDirectory());
+    QFileInfoList entries = dir.entryInfoList(QStringList() << "*.brep", QDir::Files, QDir::Time);
+
+    // Entries are newest first; the newest always survives, the rest are
+    // kept until the budget runs out
+    qint64 total = 0;
+    const qint64 budget = m_maxSizeBytes;
+    for (int i = 0; i < entries.size(); ++i) {
+        total += entries[i].size();
+        if (i > 0 && total > budget) {
+            QFile::remove(entries[i].absoluteFilePath());
+        }
+    }
+}
+
+void BRepCache::clear()
+{
+    QDir dir(getDirectory());
+    for (const QFileInfo& entry : dir.entryInfoList(QStringList() << "*.brep", QDir::Files)) {
+        QFile::remove(entry.absoluteFilePath());
+    }
+}
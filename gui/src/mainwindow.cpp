@@ -9,6 +9,7 @@
 #include "toolmanager.h"
 #include "toolmanagementtab.h"
 #include "toolmanagementdialog.h"
+#include "toolrepository.h"
 
 #include "rawmaterialmanager.h"  // For RawMaterialManager signals
 #include "chuckmanager.h"
@@ -44,6 +45,8 @@
 #include <QFileInfo>
 #include <QMessageBox>
 #include <QToolButton>
+#include <QMetaObject>
+#include <QPointer>
 
 // OpenCASCADE includes for geometry handling
 #include <gp_Ax1.hxx>
@@ -56,9 +59,13 @@
 #include <Bnd_Box.hxx>
 #include <BRepBndLib.hxx>
 
+#include <algorithm>
+
 // IntuiCAM Toolpath Pipeline includes
+#include <IntuiCAM/Geometry/ShapeAnalysisIndex.h>
 #include <IntuiCAM/Toolpath/ToolpathGenerationPipeline.h>
 #include <IntuiCAM/Toolpath/Types.h>
+#include <IntuiCAM/Toolpath/ToolpathDisplayObject.h>
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent)
@@ -161,6 +168,22 @@ MainWindow::MainWindow(QWidget *parent)
 
 MainWindow::~MainWindow()
 {
+    // The pipeline and import workers post back into this window, so they must finish first
+    for (const auto& job : m_toolpathJobs) {
+        job->cancel();
+    }
+    for (const auto& job : m_toolpathJobs) {
+        job->wait();
+    }
+    m_toolpathJobs.clear();
+    for (const auto& job : m_stepImportJobs) {
+        job->cancel();
+    }
+    for (const auto& job : m_stepImportJobs) {
+        job->wait();
+    }
+    m_stepImportJobs.clear();
+    
     // Clean up our custom objects
     delete m_stepLoader;
     // Qt handles cleanup of other widgets and WorkspaceController automatically
@@ -311,10 +334,23 @@ void MainWindow::setupConnections()
     // Connect tab widget signal
     connect(m_tabWidget, &QTabWidget::currentChanged, this, &MainWindow::onTabChanged);
     
+    // Tool library writes happen in the background; surface failures here
+    connect(&IntuiCAM::GUI::ToolRepository::instance(), &IntuiCAM::GUI::ToolRepository::saveFailed,
+            this, [this](const QString& error) {
+        statusBar()->showMessage(QString("Tool library not saved: %1").arg(error), 10000);
+        if (m_outputWindow) {
+            m_outputWindow->append(QString("ERROR: Tool library not saved: %1").arg(error));
+        }
+    });
+    
     // Connect 3D viewer signals
     if (m_3dViewer) {
         connect(m_3dViewer, &OpenGL3DWidget::shapeSelected, 
                 this, &MainWindow::handleShapeSelected);
+        connect(m_3dViewer, &OpenGL3DWidget::toolpathMoveSelected,
+                this, [this](const QString& toolpathName, int moveIndex) {
+            statusBar()->showMessage(QString("Toolpath %1: move %2").arg(toolpathName).arg(moveIndex), 5000);
+        });
         connect(m_3dViewer, &OpenGL3DWidget::viewModeChanged,
                 this, &MainWindow::handleViewModeChanged);
     }
@@ -554,60 +590,7 @@ void MainWindow::openStepFile()
         return;
     }
     
-    if (m_outputWindow) {
-        m_outputWindow->append(QString("Loading STEP file: %1").arg(fileName));
-    }
-    
-    // Load the STEP file using workspace controller
-    if (m_stepLoader && m_workspaceController && m_workspaceController->isInitialized()) {
-        TopoDS_Shape shape = m_stepLoader->loadStepFile(fileName.toStdString());
-        
-        if (m_stepLoader->isValid() && !shape.IsNull()) {
-            // Clear previous workpieces (workspace controller handles this cleanly)
-            m_workspaceController->clearWorkpieces();
-            
-            // Add workpiece through workspace controller (handles full workflow)
-            bool success = m_workspaceController->addWorkpiece(shape);
-
-            if (success) {
-                statusBar()->showMessage(tr("STEP file loaded and processed successfully"), 3000);
-                if (m_outputWindow) {
-                    m_outputWindow->append("STEP file loaded as workpiece and processed by workspace controller.");
-                }
-
-                // Fit view to show all content
-                m_3dViewer->fitAll();
-
-                // Immediately apply part and material setup parameters
-                if (m_setupConfigPanel) {
-                    double dist = m_setupConfigPanel->getDistanceToChuck();
-                    double rawDia = m_setupConfigPanel->getRawDiameter();
-                    bool flip = m_setupConfigPanel->isOrientationFlipped();
-                    m_workspaceController->applyPartLoadingSettings(dist, rawDia, flip);
-                }
-            } else {
-                QString errorMsg = "Failed to process workpiece through workspace controller";
-                statusBar()->showMessage(errorMsg, 5000);
-                if (m_outputWindow) {
-                    m_outputWindow->append(errorMsg);
-                }
-            }
-        } else {
-            QString errorMsg = QString("Failed to load STEP file: %1")
-                                     .arg(QString::fromStdString(m_stepLoader->getLastError()));
-            statusBar()->showMessage(errorMsg, 5000);
-            if (m_outputWindow) {
-                m_outputWindow->append(errorMsg);
-            }
-            QMessageBox::warning(this, tr("Error Loading STEP File"), errorMsg);
-        }
-    } else {
-        QString errorMsg = "Workspace controller not initialized";
-        statusBar()->showMessage(errorMsg, 5000);
-        if (m_outputWindow) {
-            m_outputWindow->append(errorMsg);
-        }
-    }
+    startStepImport(fileName);
 }
 
 void MainWindow::saveProject()
@@ -1154,15 +1137,11 @@ void MainWindow::handleGenerateToolpaths()
             inputs.rawMaterialDiameter = m_setupConfigPanel->getRawDiameter();
             inputs.facingAllowance = m_setupConfigPanel->getFacingAllowance();
             
-            // Calculate part dimensions from geometry
-            Bnd_Box bbox;
-            BRepBndLib::Add(partGeometry, bbox);
-            if (!bbox.IsVoid()) {
-                double xmin, ymin, zmin, xmax, ymax, zmax;
-                bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-                
+            // Calculate part dimensions from the shared per-shape analysis
+            auto analysis = IntuiCAM::Geometry::ShapeAnalysisIndex::get(partGeometry);
+            if (!analysis->isEmpty()) {
                 // Calculate part length and update GUI
-                double calculatedPartLength = zmax - zmin;
+                double calculatedPartLength = analysis->getAxialExtent(turningAxis).length();
                 inputs.partLength = calculatedPartLength;
                 m_setupConfigPanel->setPartLength(calculatedPartLength);
                 
@@ -1245,13 +1224,83 @@ void MainWindow::handleGenerateToolpaths()
             return;
         }
         
-        // Step 6: Execute pipeline
+        // Step 6: Execute pipeline off the UI thread. A newer request supersedes
+        // any job still running; its results are discarded when they arrive.
+        for (const auto& job : m_toolpathJobs) {
+            if (!job->isCancelRequested()) {
+                job->cancel();
+                if (m_outputWindow) {
+                    m_outputWindow->append("Cancelling superseded toolpath generation...");
+                }
+            }
+        }
+        
         if (m_outputWindow) {
             m_outputWindow->append("Executing toolpath generation pipeline...");
         }
         
-        auto result = pipeline.executePipeline(inputs);
+        const quint64 generation = ++m_toolpathGeneration;
         
+        if (!m_toolpathStageCache) {
+            m_toolpathStageCache = std::make_shared<IntuiCAM::Toolpath::PipelineStageCache>();
+        }
+        
+        // Callbacks run on the worker thread; queue them onto the GUI thread.
+        // The destructor joins every job, the guard covers posts racing it.
+        QPointer<MainWindow> guard(this);
+        auto job = IntuiCAM::Toolpath::ToolpathGenerationPipeline::executePipelineAsync(
+            inputs,
+            [guard, generation](double progress, const std::string& status) {
+                QString statusText = QString::fromStdString(status);
+                int percent = static_cast<int>(progress * 100.0);
+                QMetaObject::invokeMethod(guard.data(), [guard, generation, statusText, percent]() {
+                    if (!guard || generation != guard->m_toolpathGeneration) {
+                        return;
+                    }
+                    guard->statusBar()->showMessage(QString("%1 (%2%)").arg(statusText).arg(percent), 2000);
+                }, Qt::QueuedConnection);
+            },
+            [guard, generation](const std::shared_ptr<IntuiCAM::Toolpath::PipelineJob>& job) {
+                QMetaObject::invokeMethod(guard.data(), [guard, job, generation]() {
+                    if (guard) {
+                        guard->handleToolpathJobFinished(job, generation);
+                    }
+                }, Qt::QueuedConnection);
+            },
+            m_toolpathStageCache);
+        m_toolpathJobs.push_back(job);
+        
+    } catch (const std::exception& e) {
+        statusBar()->showMessage(QString("Toolpath generation error: %1").arg(e.what()), 5000);
+        if (m_outputWindow) {
+            m_outputWindow->append(QString("EXCEPTION: %1").arg(e.what()));
+            m_outputWindow->append("=== Toolpath Generation Failed ===");
+        }
+    }
+}
+
+void MainWindow::handleToolpathJobFinished(const std::shared_ptr<IntuiCAM::Toolpath::PipelineJob>& job,
+                                           quint64 generation)
+{
+    m_toolpathJobs.erase(std::remove(m_toolpathJobs.begin(), m_toolpathJobs.end(), job),
+                         m_toolpathJobs.end());
+    
+    // Drop results of superseded requests
+    if (!job || generation != m_toolpathGeneration) {
+        return;
+    }
+    
+    if (job->getState() == IntuiCAM::Toolpath::PipelineJob::State::Cancelled) {
+        statusBar()->showMessage("Toolpath generation cancelled", 3000);
+        if (m_outputWindow) {
+            m_outputWindow->append("=== Toolpath Generation Cancelled ===");
+        }
+        return;
+    }
+    
+    auto result = job->takeResult();
+    
+    try {
         if (result.success) {
             statusBar()->showMessage(QString("Toolpath generation completed successfully - %1 toolpaths generated")
                                    .arg(result.timeline.size()), 5000);
@@ -1290,8 +1339,11 @@ void MainWindow::handleGenerateToolpaths()
                 }
             }
             
-            // Create display objects with workpiece transformation
-            auto transformedDisplayObjects = pipeline.createToolpathDisplayObjects(result.timeline, workpieceTransform);
+            // Create display objects with workpiece transformation; they take
+            // over the timeline's toolpaths rather than copying them
+            IntuiCAM::Toolpath::ToolpathGenerationPipeline pipeline;
+            auto transformedDisplayObjects = pipeline.createToolpathDisplayObjects(std::move(result.timeline),
+                                                                                   workpieceTransform);
             
             // Display toolpaths in 3D viewer
             if (m_3dViewer) {
@@ -1814,7 +1866,9 @@ void MainWindow::handleWorkpiecePositionChanged(double distance)
                 for (AIS_ListOfInteractive::Iterator it(allObjects); it.More(); it.Next()) {
                     Handle(AIS_InteractiveObject) obj = it.Value();
                     // Check if this is a toolpath object
-                    if (!obj.IsNull() && obj->DynamicType()->Name() == std::string("AIS_Shape")) {
+                    if (!Handle(IntuiCAM::Toolpath::ToolpathDisplayObject)::DownCast(obj).IsNull()) {
+                        m_3dViewer->getContext()->Remove(obj, Standard_False);
+                    } else if (!obj.IsNull() && obj->DynamicType()->Name() == std::string("AIS_Shape")) {
                         Handle(AIS_Shape) shapeObj = Handle(AIS_Shape)::DownCast(obj);
                         if (!shapeObj.IsNull()) {
                             TopoDS_Shape shape = shapeObj->Shape();
@@ -1987,59 +2041,123 @@ void MainWindow::handleStepFileSelected(const QString& filePath)
         return;
     }
     
+    startStepImport(filePath);
+}
+
+void MainWindow::startStepImport(const QString& filePath)
+{
+    if (!m_workspaceController || !m_workspaceController->isInitialized()) {
+        QString errorMsg = "Workspace controller not initialized";
+        statusBar()->showMessage(errorMsg, 5000);
+        if (m_outputWindow) {
+            m_outputWindow->append(errorMsg);
+        }
+        return;
+    }
+
+    // Opening another file supersedes any import still running; its shape is
+    // discarded when it arrives
+    for (const auto& job : m_stepImportJobs) {
+        if (!job->isCancelRequested()) {
+            job->cancel();
+            if (m_outputWindow) {
+                m_outputWindow->append("Cancelling superseded STEP import...");
+            }
+        }
+    }
+
     statusBar()->showMessage(tr("Loading STEP file..."), 2000);
-    
     if (m_outputWindow) {
         m_outputWindow->append(QString("Loading STEP file: %1").arg(filePath));
     }
-    
-    // Load the STEP file using workspace controller - same logic as original openStepFile()
-    if (m_stepLoader && m_workspaceController && m_workspaceController->isInitialized()) {
-        TopoDS_Shape shape = m_stepLoader->loadStepFile(filePath.toStdString());
-        
-        if (m_stepLoader->isValid() && !shape.IsNull()) {
-            // Clear previous workpieces (workspace controller handles this cleanly)
-            m_workspaceController->clearWorkpieces();
-            
-            // Add workpiece through workspace controller (handles full workflow)
-            bool success = m_workspaceController->addWorkpiece(shape);
-            
-            if (success) {
-                statusBar()->showMessage(tr("STEP file loaded and processed successfully"), 3000);
-                if (m_outputWindow) {
-                    m_outputWindow->append("STEP file loaded as workpiece and processed by workspace controller.");
-                }
-                
-                // Fit view to show all content
-                if (m_3dViewer) {
-                    m_3dViewer->fitAll();
-                }
 
-                // Immediately apply part and material setup parameters
-                if (m_setupConfigPanel) {
-                    double dist = m_setupConfigPanel->getDistanceToChuck();
-                    double rawDia = m_setupConfigPanel->getRawDiameter();
-                    bool flip = m_setupConfigPanel->isOrientationFlipped();
-                    m_workspaceController->applyPartLoadingSettings(dist, rawDia, flip);
+    const quint64 generation = ++m_stepImportGeneration;
+
+    // Callbacks run on the worker thread; queue them onto the GUI thread.
+    // The destructor joins every import, the guard covers posts racing it.
+    QPointer<MainWindow> guard(this);
+    auto job = StepLoader::loadStepFileAsync(
+        filePath.toStdString(),
+        [guard, generation](double progress, const std::string& stage) {
+            QString stageText = QString::fromStdString(stage);
+            int percent = static_cast<int>(progress * 100.0);
+            QMetaObject::invokeMethod(guard.data(), [guard, generation, stageText, percent]() {
+                if (!guard || generation != guard->m_stepImportGeneration) {
+                    return;
                 }
-            } else {
-                QString errorMsg = "Failed to process workpiece through workspace controller";
-                statusBar()->showMessage(errorMsg, 5000);
-                if (m_outputWindow) {
-                    m_outputWindow->append(errorMsg);
+                guard->statusBar()->showMessage(QString("%1 (%2%)").arg(stageText).arg(percent), 2000);
+            }, Qt::QueuedConnection);
+        },
+        [guard, generation](const std::shared_ptr<StepImportJob>& job) {
+            QMetaObject::invokeMethod(guard.data(), [guard, job, generation]() {
+                if (guard) {
+                    guard->handleStepImportFinished(job, generation);
                 }
-            }
-        } else {
-            QString errorMsg = QString("Failed to load STEP file: %1")
-                                     .arg(QString::fromStdString(m_stepLoader->getLastError()));
-            statusBar()->showMessage(errorMsg, 5000);
-            if (m_outputWindow) {
-                m_outputWindow->append(errorMsg);
-            }
-            QMessageBox::warning(this, tr("Error Loading STEP File"), errorMsg);
+            }, Qt::QueuedConnection);
+        });
+    m_stepImportJobs.push_back(job);
+}
+
+void MainWindow::handleStepImportFinished(const std::shared_ptr<StepImportJob>& job, quint64 generation)
+{
+    m_stepImportJobs.erase(std::remove(m_stepImportJobs.begin(), m_stepImportJobs.end(), job),
+                           m_stepImportJobs.end());
+
+    // Drop results of superseded imports
+    if (!job || generation != m_stepImportGeneration) {
+        return;
+    }
+
+    if (job->getState() == StepImportJob::State::Cancelled) {
+        statusBar()->showMessage(tr("STEP import cancelled"), 3000);
+        if (m_outputWindow) {
+            m_outputWindow->append("STEP import cancelled");
+        }
+        return;
+    }
+
+    TopoDS_Shape shape = job->takeShape();
+    if (job->getState() != StepImportJob::State::Completed || shape.IsNull()) {
+        QString errorMsg = QString("Failed to load STEP file: %1")
+                                 .arg(QString::fromStdString(job->getError()));
+        statusBar()->showMessage(errorMsg, 5000);
+        if (m_outputWindow) {
+            m_outputWindow->append(errorMsg);
+        }
+        QMessageBox::warning(this, tr("Error Loading STEP File"), errorMsg);
+        return;
+    }
+
+    if (!m_workspaceController || !m_workspaceController->isInitialized()) {
+        return;
+    }
+
+    // Clear previous workpieces (workspace controller handles this cleanly)
+    m_workspaceController->clearWorkpieces();
+
+    // Add workpiece through workspace controller (handles full workflow)
+    bool success = m_workspaceController->addWorkpiece(shape);
+
+    if (success) {
+        statusBar()->showMessage(tr("STEP file loaded and processed successfully"), 3000);
+        if (m_outputWindow) {
+            m_outputWindow->append("STEP file loaded as workpiece and processed by workspace controller.");
+        }
+
+        // Fit view to show all content
+        if (m_3dViewer) {
+            m_3dViewer->fitAll();
+        }
+
+        // Immediately apply part and material setup parameters
+        if (m_setupConfigPanel) {
+            double dist = m_setupConfigPanel->getDistanceToChuck();
+            double rawDia = m_setupConfigPanel->getRawDiameter();
+            bool flip = m_setupConfigPanel->isOrientationFlipped();
+            m_workspaceController->applyPartLoadingSettings(dist, rawDia, flip);
         }
     } else {
-        QString errorMsg = "Workspace controller not initialized";
+        QString errorMsg = "Failed to process workpiece through workspace controller";
         statusBar()->showMessage(errorMsg, 5000);
         if (m_outputWindow) {
             m_outputWindow->append(errorMsg);
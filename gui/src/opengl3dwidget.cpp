@@ -323,6 +323,7 @@ void OpenGL3DWidget::updateView()
         //makeCurrent(); // makeCurrent() returns void
         
         try {
+            updateToolpathLevelOfDetail();
             m_view->Invalidate();
             m_view->Redraw();
             
@@ -337,6 +338,25 @@ void OpenGL3DWidget::updateView()
     }
 }
 
+void OpenGL3DWidget::updateToolpathLevelOfDetail()
+{
+    if (m_context.IsNull() || m_view.IsNull() || !m_toolpathsVisible) {
+        return;
+    }
+    
+    // Only a zoom change can move an object to another level, so this is a
+    // cheap scale comparison per toolpath on every redraw
+    AIS_ListOfInteractive allObjects;
+    m_context->DisplayedObjects(allObjects);
+    for (AIS_ListOfInteractive::Iterator anIter(allObjects); anIter.More(); anIter.Next()) {
+        Handle(IntuiCAM::Toolpath::ToolpathDisplayObject) toolpathObj =
+            Handle(IntuiCAM::Toolpath::ToolpathDisplayObject)::DownCast(anIter.Value());
+        if (!toolpathObj.IsNull() && toolpathObj->updateLevelOfDetail(m_view)) {
+            m_context->Update(toolpathObj, Standard_False);
+        }
+    }
+}
+
 void OpenGL3DWidget::mousePressEvent(QMouseEvent *event)
 {
     // Store mouse position and button state
@@ -349,6 +369,20 @@ void OpenGL3DWidget::mousePressEvent(QMouseEvent *event)
         //makeCurrent(); // makeCurrent() returns void
         
         m_context->MoveTo(event->pos().x(), event->pos().y(), m_view, Standard_True);
+        
+        // A click on a toolpath picks the move under the cursor
+        Handle(IntuiCAM::Toolpath::ToolpathDisplayObject) toolpathObj;
+        size_t moveIndex = 0;
+        if (m_context->HasDetected()) {
+            toolpathObj = Handle(IntuiCAM::Toolpath::ToolpathDisplayObject)::DownCast(m_context->DetectedInteractive());
+        }
+        if (!toolpathObj.IsNull() && toolpathObj->getDetectedMove(m_context, moveIndex)) {
+            selectToolpathMove(toolpathObj, moveIndex);
+            m_isDragging = false;
+            return;
+        }
+        selectToolpathMove(Handle(IntuiCAM::Toolpath::ToolpathDisplayObject)(), 0);
+        
         if (m_context->HasDetected()) {
             m_context->SelectDetected(AIS_SelectionScheme_Replace);
             for (m_context->InitSelected(); m_context->MoreSelected(); m_context->NextSelected()) {
@@ -372,6 +406,26 @@ void OpenGL3DWidget::mousePressEvent(QMouseEvent *event)
     event->accept();
 }
 
+void OpenGL3DWidget::selectToolpathMove(const Handle(IntuiCAM::Toolpath::ToolpathDisplayObject)& toolpathObj,
+                                        size_t moveIndex)
+{
+    if (!m_selectedMoveToolpath.IsNull()) {
+        m_selectedMoveToolpath->clearHighlights();
+        m_context->Update(m_selectedMoveToolpath, Standard_False);
+    }
+    m_selectedMoveToolpath = toolpathObj;
+    
+    if (!toolpathObj.IsNull()) {
+        toolpathObj->highlightMove(moveIndex);
+        m_context->Update(toolpathObj, Standard_False);
+        
+        const auto toolpath = toolpathObj->getToolpath();
+        emit toolpathMoveSelected(toolpath ? QString::fromStdString(toolpath->getName()) : QString(),
+                                  static_cast<int>(moveIndex));
+    }
+    updateView();
+}
+
 void OpenGL3DWidget::mouseMoveEvent(QMouseEvent *event)
 {
     if (m_view.IsNull()) {
@@ -573,6 +627,13 @@ void OpenGL3DWidget::setSelectionMode(bool enabled)
 
             for (AIS_ListOfInteractive::Iterator anIter(allObjects); anIter.More(); anIter.Next()) {
                 Handle(AIS_InteractiveObject) anObj = anIter.Value();
+                
+                // Toolpaths are pickable per move
+                if (!Handle(IntuiCAM::Toolpath::ToolpathDisplayObject)::DownCast(anObj).IsNull()) {
+                    m_context->Activate(anObj, 0, Standard_False);
+                    continue;
+                }
+                
                 Handle(AIS_Shape) aShape = Handle(AIS_Shape)::DownCast(anObj);
                 if (!aShape.IsNull()) {
                     // Skip raw material - it should remain non-selectable
@@ -603,6 +664,7 @@ void OpenGL3DWidget::setSelectionMode(bool enabled)
         
         // Deactivate all selection modes
         if (!m_context.IsNull()) {
+            selectToolpathMove(Handle(IntuiCAM::Toolpath::ToolpathDisplayObject)(), 0);
             m_context->Deactivate();
             m_context->ClearSelected(Standard_False);
             updateView();
@@ -18,7 +18,8 @@
 #include <BRepTools.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
-#include <BRepBuilderAPI_Transform.hxx>
+
+#include <IntuiCAM/Geometry/ShapeAnalysisIndex.h>
 
 // Standard material diameters in mm (ISO metric standard stock sizes)
 const QVector<double> RawMaterialManager::STANDARD_DIAMETERS = {
@@ -275,40 +276,18 @@ double RawMaterialManager::calculateOptimalLength(const TopoDS_Shape& workpiece,
     }
     
     try {
-        // Get bounding box of the workpiece
-        Bnd_Box bbox;
-        BRepBndLib::Add(workpiece, bbox);
+        // Bounds come from the shared per-shape analysis
+        auto analysis = IntuiCAM::Geometry::ShapeAnalysisIndex::get(workpiece);
         
-        if (bbox.IsVoid()) {
+        if (analysis->isEmpty()) {
             qDebug() << "Empty bounding box for workpiece";
             return 100.0;
         }
         
-        double xmin, ymin, zmin, xmax, ymax, zmax;
-        bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-        
-        // Calculate the bounds along the rotation axis
-        gp_Dir axisDir = axis.Direction();
-        gp_Pnt axisLoc = axis.Location();
-        
-        // Project bounding box corners onto the axis to find extent
-        double minProjection = std::numeric_limits<double>::max();
-        double maxProjection = std::numeric_limits<double>::lowest();
-        
-        // Check all 8 corners of the bounding box
-        gp_Pnt corners[8] = {
-            gp_Pnt(xmin, ymin, zmin), gp_Pnt(xmax, ymin, zmin),
-            gp_Pnt(xmin, ymax, zmin), gp_Pnt(xmax, ymax, zmin),
-            gp_Pnt(xmin, ymin, zmax), gp_Pnt(xmax, ymin, zmax),
-            gp_Pnt(xmin, ymax, zmax), gp_Pnt(xmax, ymax, zmax)
-        };
-        
-        for (int i = 0; i < 8; i++) {
-            gp_Vec toCorner(axisLoc, corners[i]);
-            double projection = toCorner.Dot(axisDir);
-            minProjection = std::min(minProjection, projection);
-            maxProjection = std::max(maxProjection, projection);
-        }
+        // Extent of the workpiece along the rotation axis
+        IntuiCAM::Geometry::ShapeAnalysisIndex::AxialExtent extent = analysis->getAxialExtent(axis);
+        double minProjection = extent.min;
+        double maxProjection = extent.max;
         
         double workpieceLength = maxProjection - minProjection;
         
@@ -349,47 +328,18 @@ double RawMaterialManager::calculateOptimalLengthWithTransform(const TopoDS_Shap
     }
     
     try {
-        // Apply transformation to the workpiece for calculation
-        TopoDS_Shape transformedWorkpiece = workpiece;
-        if (transform.Form() != gp_Identity) {
-            BRepBuilderAPI_Transform transformer(workpiece, transform);
-            transformedWorkpiece = transformer.Shape();
-        }
-        
-        // Get bounding box of the transformed workpiece
-        Bnd_Box bbox;
-        BRepBndLib::Add(transformedWorkpiece, bbox);
+        // The unmoved workpiece's shared analysis; the transform is applied to the extent
+        auto analysis = IntuiCAM::Geometry::ShapeAnalysisIndex::get(workpiece);
         
-        if (bbox.IsVoid()) {
+        if (analysis->isEmpty()) {
             qDebug() << "Empty bounding box for transformed workpiece";
             return 100.0;
         }
         
-        double xmin, ymin, zmin, xmax, ymax, zmax;
-        bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-        
-        // Calculate the bounds along the rotation axis
-        gp_Dir axisDir = axis.Direction();
-        gp_Pnt axisLoc = axis.Location();
-        
-        // Project bounding box corners onto the axis to find extent
-        double minProjection = std::numeric_limits<double>::max();
-        double maxProjection = std::numeric_limits<double>::lowest();
-        
-        // Check all 8 corners of the bounding box
-        gp_Pnt corners[8] = {
-            gp_Pnt(xmin, ymin, zmin), gp_Pnt(xmax, ymin, zmin),
-            gp_Pnt(xmin, ymax, zmin), gp_Pnt(xmax, ymax, zmin),
-            gp_Pnt(xmin, ymin, zmax), gp_Pnt(xmax, ymin, zmax),
-            gp_Pnt(xmin, ymax, zmax), gp_Pnt(xmax, ymax, zmax)
-        };
-        
-        for (int i = 0; i < 8; i++) {
-            gp_Vec toCorner(axisLoc, corners[i]);
-            double projection = toCorner.Dot(axisDir);
-            minProjection = std::min(minProjection, projection);
-            maxProjection = std::max(maxProjection, projection);
-        }
+        // Extent of the transformed workpiece along the rotation axis
+        IntuiCAM::Geometry::ShapeAnalysisIndex::AxialExtent extent = analysis->getAxialExtent(axis, transform);
+        double minProjection = extent.min;
+        double maxProjection = extent.max;
         
         double workpieceLength = maxProjection - minProjection;
         
@@ -428,37 +378,19 @@ TopoDS_Shape RawMaterialManager::createCylinderForWorkpiece(double diameter, dou
     try {
         double radius = diameter / 2.0;
         
-        // Get workpiece bounding box to determine proper positioning
-        Bnd_Box bbox;
-        BRepBndLib::Add(workpiece, bbox);
+        // Bounds come from the shared per-shape analysis
+        auto analysis = IntuiCAM::Geometry::ShapeAnalysisIndex::get(workpiece);
         
         gp_Pnt cylinderStartPoint;
-        if (!bbox.IsVoid()) {
+        if (!analysis->isEmpty()) {
             // Calculate the proper positioning along the axis
-            double xmin, ymin, zmin, xmax, ymax, zmax;
-            bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-            
             gp_Dir axisDir = axis.Direction();
             gp_Pnt axisLoc = axis.Location();
             
-            // Project all bounding box corners onto the axis to find the true extent
-            double minProjection = std::numeric_limits<double>::max();
-            double maxProjection = std::numeric_limits<double>::lowest();
-            
-            // Check all 8 corners of the bounding box
-            gp_Pnt corners[8] = {
-                gp_Pnt(xmin, ymin, zmin), gp_Pnt(xmax, ymin, zmin),
-                gp_Pnt(xmin, ymax, zmin), gp_Pnt(xmax, ymax, zmin),
-                gp_Pnt(xmin, ymin, zmax), gp_Pnt(xmax, ymin, zmax),
-                gp_Pnt(xmin, ymax, zmax), gp_Pnt(xmax, ymax, zmax)
-            };
-            
-            for (int i = 0; i < 8; i++) {
-                gp_Vec toCorner(axisLoc, corners[i]);
-                double projection = toCorner.Dot(axisDir);
-                minProjection = std::min(minProjection, projection);
-                maxProjection = std::max(maxProjection, projection);
-            }
+            // Extent of the workpiece along the axis
+            IntuiCAM::Geometry::ShapeAnalysisIndex::AxialExtent extent = analysis->getAxialExtent(axis);
+            double minProjection = extent.min;
+            double maxProjection = extent.max;
             
             // For lathe operations, ensure raw material:
             // 1. Always extends exactly 50mm in -Z direction (into chuck) from Z=0
@@ -521,44 +453,19 @@ TopoDS_Shape RawMaterialManager::createCylinderForWorkpieceWithTransform(double
     try {
         double radius = diameter / 2.0;
         
-        // Apply transformation to the workpiece for bounding box calculation
-        TopoDS_Shape transformedWorkpiece = workpiece;
-        if (transform.Form() != gp_Identity) {
-            BRepBuilderAPI_Transform transformer(workpiece, transform);
-            transformedWorkpiece = transformer.Shape();
-        }
-        
-        // Get transformed workpiece bounding box to determine proper positioning
-        Bnd_Box bbox;
-        BRepBndLib::Add(transformedWorkpiece, bbox);
+        // The unmoved workpiece's shared analysis; the transform is applied to the extent
+        auto analysis = IntuiCAM::Geometry::ShapeAnalysisIndex::get(workpiece);
         
         gp_Pnt cylinderStartPoint;
-        if (!bbox.IsVoid()) {
+        if (!analysis->isEmpty()) {
             // Calculate the proper positioning along the axis
-            double xmin, ymin, zmin, xmax, ymax, zmax;
-            bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-            
             gp_Dir axisDir = axis.Direction();
             gp_Pnt axisLoc = axis.Location();
             
-            // Project all bounding box corners onto the axis to find the true extent
-            double minProjection = std::numeric_limits<double>::max();
-            double maxProjection = std::numeric_limits<double>::lowest();
-            
-            // Check all 8 corners of the bounding box
-            gp_Pnt corners[8] = {
-                gp_Pnt(xmin, ymin, zmin), gp_Pnt(xmax, ymin, zmin),
-                gp_Pnt(xmin, ymax, zmin), gp_Pnt(xmax, ymax, zmin),
-                gp_Pnt(xmin, ymin, zmax), gp_Pnt(xmax, ymin, zmax),
-                gp_Pnt(xmin, ymax, zmax), gp_Pnt(xmax, ymax, zmax)
-            };
-            
-            for (int i = 0; i < 8; i++) {
-                gp_Vec toCorner(axisLoc, corners[i]);
-                double projection = toCorner.Dot(axisDir);
-                minProjection = std::min(minProjection, projection);
-                maxProjection = std::max(maxProjection, projection);
-            }
+            // Extent of the transformed workpiece along the axis
+            IntuiCAM::Geometry::ShapeAnalysisIndex::AxialExtent extent = analysis->getAxialExtent(axis, transform);
+            double minProjection = extent.min;
+            double maxProjection = extent.max;
             
             // For lathe operations, ensure raw material:
             // 1. Always extends exactly 50mm in -Z direction (into chuck) from Z=0
@@ -1,8 +1,14 @@
 #include "steploader.h"
+#include "brepcache.h"
 
 #include <QDebug>
 #include <QFileInfo>
 
+#include <algorithm>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
 // OpenCASCADE STEP reader includes
 #include <STEPCAFControl_Reader.hxx>
 #include <TDocStd_Document.hxx>
@@ -18,115 +24,370 @@
 // Alternative simpler STEP reader
 #include <STEPControl_Reader.hxx>
 
-StepLoader::StepLoader()
-    : m_isValid(false)
+// Healing, meshing and progress reporting
+#include <Bnd_Box.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <Message_ProgressIndicator.hxx>
+#include <Message_ProgressScope.hxx>
+#include <ShapeFix_Shape.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <IntuiCAM/Common/Trace.h>
+
+namespace {
+
+std::atomic<std::uint64_t> g_nextStepImportJobId{1};
+
+// Share of the overall progress given to each import stage
+struct ImportStage {
+    const char* name;
+    double begin;
+    double end;
+};
+
+constexpr ImportStage kParseStage{"Parsing STEP file", 0.0, 0.35};
+constexpr ImportStage kTransferStage{"Transferring shapes", 0.35, 0.75};
+constexpr ImportStage kHealStage{"Healing shapes", 0.75, 0.85};
+constexpr ImportStage kMeshStage{"Meshing for display", 0.85, 1.0};
+
+// Matches the AIS defaults (deviation coefficient 0.001, 20 degrees) so the
+// viewer reuses the triangulation instead of meshing again on the GUI thread
+constexpr double kDisplayDeviationCoefficient = 0.001;
+constexpr double kDisplayDeviationAngle = 20.0 * 3.14159265358979323846 / 180.0;
+
+/**
+ * @brief Cancellation and progress hooks threaded through an import
+ *
+ * Both members are optional; the synchronous loader passes neither.
+ */
+struct ImportControl {
+    const std::atomic<bool>* cancelRequested = nullptr;
+    std::function<void(double, const char*)> report;
+
+    bool isCancelled() const { return cancelRequested && *cancelRequested; }
+
+    void enter(const ImportStage& stage) const {
+        if (report) {
+            report(stage.begin, stage.name);
+        }
+    }
+};
+
+/**
+ * @brief Maps OCCT progress of one stage onto the overall import progress
+ *
+ * OCCT polls UserBreak() from inside the algorithms, which is what makes
+ * transfer, healing and meshing cancellable mid-stage.
+ */
+class StageProgressIndicator : public Message_ProgressIndicator
+{
+public:
+    StageProgressIndicator(const ImportControl& control, const ImportStage& stage)
+        : m_control(control)
+        , m_stage(stage)
+    {
+    }
+
+    Standard_Boolean UserBreak() override
+    {
+        return m_control.isCancelled();
+    }
+
+    void Show(const Message_ProgressScope& /*theScope*/, const Standard_Boolean isForce) override
+    {
+        if (!m_control.report) {
+            return;
+        }
+        // Called under the indicator's lock; only forward whole-percent steps
+        double position = GetPosition();
+        if (!isForce && position - m_lastShown < 0.01) {
+            return;
+        }
+        m_lastShown = position;
+        m_control.report(m_stage.begin + (m_stage.end - m_stage.begin) * position, m_stage.name);
+    }
+
+private:
+    const ImportControl& m_control;
+    ImportStage m_stage;
+    double m_lastShown = 0.0;
+};
+
+// Roots that share no faces, edges or vertices can be healed concurrently;
+// ShapeFix edits shared TFace/TEdge/TVertex in place, so anything else is
+// healed on one thread. Sharing is by TShape, whatever the location.
+bool rootsShareSubShapes(const std::vector<TopoDS_Shape>& roots)
 {
+    std::unordered_set<const void*> seen;
+    for (const TopoDS_Shape& root : roots) {
+        std::unordered_set<const void*> own;
+        for (TopAbs_ShapeEnum type : {TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX}) {
+            TopTools_IndexedMapOfShape subShapes;
+            TopExp::MapShapes(root, type, subShapes);
+            for (int i = 1; i <= subShapes.Extent(); ++i) {
+                const void* tshape = subShapes(i).TShape().get();
+                if (own.insert(tshape).second && !seen.insert(tshape).second) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
 }
 
-StepLoader::~StepLoader()
+void healRoots(std::vector<TopoDS_Shape>& roots, const ImportControl& control)
 {
+    TRACE_SPAN("import", "StepImport::heal");
+    control.enter(kHealStage);
+
+    Handle(StageProgressIndicator) indicator = new StageProgressIndicator(control, kHealStage);
+    Message_ProgressScope scope(indicator->Start(), "Heal", static_cast<Standard_Real>(roots.size()));
+
+    // Ranges must be split off on this thread before workers consume them
+    std::vector<Message_ProgressRange> ranges;
+    ranges.reserve(roots.size());
+    for (size_t i = 0; i < roots.size(); ++i) {
+        ranges.push_back(scope.Next());
+    }
+
+    auto healOne = [&roots, &ranges](size_t index) {
+        ShapeFix_Shape fixer(roots[index]);
+        fixer.Perform(ranges[index]);
+        TopoDS_Shape healed = fixer.Shape();
+        if (!healed.IsNull()) {
+            roots[index] = healed;
+        }
+    };
+
+    size_t workerCount = std::min<size_t>(roots.size(), std::max(1u, std::thread::hardware_concurrency()));
+    if (workerCount <= 1 || rootsShareSubShapes(roots)) {
+        for (size_t i = 0; i < roots.size() && !control.isCancelled(); ++i) {
+            healOne(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextIndex{0};
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t w = 0; w < workerCount; ++w) {
+        workers.emplace_back([&]() {
+            for (size_t i = nextIndex++; i < roots.size() && !control.isCancelled(); i = nextIndex++) {
+                healOne(i);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
 }
 
-TopoDS_Shape StepLoader::loadStepFile(const std::string& filename)
+void meshForDisplay(const TopoDS_Shape& shape, const ImportControl& control)
 {
-    m_isValid = false;
-    m_lastError.clear();
-    
+    TRACE_SPAN("import", "StepImport::mesh");
+    control.enter(kMeshStage);
+
+    Bnd_Box bounds;
+    BRepBndLib::Add(shape, bounds);
+    if (bounds.IsVoid()) {
+        return;
+    }
+    Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
+    bounds.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+    double maxDimension = std::max({xMax - xMin, yMax - yMin, zMax - zMin});
+
+    IMeshTools_Parameters parameters;
+    parameters.Deflection = kDisplayDeviationCoefficient * maxDimension * 4.0;
+    parameters.Angle = kDisplayDeviationAngle;
+    parameters.InParallel = Standard_True;
+
+    Handle(StageProgressIndicator) indicator = new StageProgressIndicator(control, kMeshStage);
+    BRepMesh_IncrementalMesh mesher(shape, parameters, indicator->Start());
+}
+
+/**
+ * @brief Staged STEP import shared by the synchronous and asynchronous paths
+ *
+ * Looks the file up in the BRep cache first and stores the healed, meshed
+ * result there, so only the first load of a given file pays for parsing.
+ * @return The imported shape, or a null shape with error set
+ */
+TopoDS_Shape importStepFile(const std::string& filename, const ImportControl& control, std::string& error)
+{
+    TRACE_SPAN("import", "StepImport::importStepFile");
     TopoDS_Shape result;
-    
+
     // Check if file exists
-    QString qFilename = QString::fromStdString(filename);
-    QFileInfo fileInfo(qFilename);
+    QFileInfo fileInfo(QString::fromStdString(filename));
     if (!fileInfo.exists())
     {
-        m_lastError = std::string("File does not exist: ") + filename;
+        error = std::string("File does not exist: ") + filename;
         return result;
     }
-    
+
     if (!fileInfo.isReadable())
     {
-        m_lastError = std::string("File is not readable: ") + filename;
+        error = std::string("File is not readable: ") + filename;
         return result;
     }
-    
-    try {
-        // Use the provided filename for OpenCASCADE
-        const std::string& stdFilename = filename;
-        
-        // Use the simpler STEPControl_Reader for basic STEP file loading
-        STEPControl_Reader reader;
-        
-        // Read the file
-        IFSelect_ReturnStatus stat = reader.ReadFile(stdFilename.c_str());
-        
-        if (stat != IFSelect_RetDone)
-        {
-            m_lastError = std::string("Failed to read STEP file: ") + filename;
-            return result;
+
+    const std::string cancelledMessage = std::string("Import cancelled: ") + filename;
+
+    // A cached copy already carries healing and triangulation
+    control.enter(kParseStage);
+    BRepCache& cache = BRepCache::instance();
+    const QString cacheKey = cache.isEnabled() ? cache.computeKey(fileInfo.absoluteFilePath()) : QString();
+    if (cache.load(cacheKey, result))
+    {
+        qDebug() << "Loaded STEP file from BRep cache:" << fileInfo.absoluteFilePath();
+        if (control.report) {
+            control.report(1.0, "STEP import complete (cached)");
         }
-        
-        // Transfer the contents
-        Standard_Integer nbr = reader.NbRootsForTransfer();
-        if (nbr <= 0)
+        return result;
+    }
+    if (control.isCancelled()) {
+        error = cancelledMessage;
+        return result;
+    }
+
+    // Use the simpler STEPControl_Reader for basic STEP file loading
+    STEPControl_Reader reader;
+
+    {
+        TRACE_SPAN("import", "StepImport::parse");
+        IFSelect_ReturnStatus stat = reader.ReadFile(filename.c_str());
+        if (stat != IFSelect_RetDone)
         {
-            m_lastError = std::string("No shapes found in STEP file: ") + filename;
+            error = std::string("Failed to read STEP file: ") + filename;
             return result;
         }
-        
-        qDebug() << "Found" << nbr << "root shapes in STEP file";
-        
-        // Transfer all roots
-        reader.PrintCheckTransfer(Standard_False, IFSelect_ItemsByEntity);
-        
-        for (Standard_Integer n = 1; n <= nbr; n++)
+    }
+    if (control.isCancelled()) {
+        error = cancelledMessage;
+        return result;
+    }
+
+    // Transfer the contents
+    Standard_Integer nbr = reader.NbRootsForTransfer();
+    if (nbr <= 0)
+    {
+        error = std::string("No shapes found in STEP file: ") + filename;
+        return result;
+    }
+
+    qDebug() << "Found" << nbr << "root shapes in STEP file";
+
+    // The transfer process of one reader is not reentrant, so roots are
+    // transferred in order; the per-root work that follows runs in parallel
+    std::vector<TopoDS_Shape> roots;
+    {
+        TRACE_SPAN("import", "StepImport::transfer");
+        control.enter(kTransferStage);
+
+        Handle(StageProgressIndicator) indicator = new StageProgressIndicator(control, kTransferStage);
+        Message_ProgressScope scope(indicator->Start(), "Transfer", nbr);
+        for (Standard_Integer n = 1; n <= nbr && scope.More(); n++)
         {
-            reader.TransferRoot(n);
+            reader.TransferRoot(n, scope.Next());
         }
-        
-        // Get the number of resulting shapes
-        Standard_Integer nbs = reader.NbShapes();
-        if (nbs <= 0)
-        {
-            m_lastError = std::string("No shapes could be transferred from STEP file: ") + filename;
+        if (control.isCancelled()) {
+            error = cancelledMessage;
             return result;
         }
-        
-        qDebug() << "Transferred" << nbs << "shapes from STEP file";
-        
-        if (nbs == 1)
-        {
-            // Single shape
-            result = reader.Shape(1);
-        }
-        else
+
+        Standard_Integer nbs = reader.NbShapes();
+        for (Standard_Integer i = 1; i <= nbs; i++)
         {
-            // Multiple shapes - create a compound
-            TopoDS_Compound compound;
-            BRep_Builder builder;
-            builder.MakeCompound(compound);
-            
-            for (Standard_Integer i = 1; i <= nbs; i++)
+            TopoDS_Shape shape = reader.Shape(i);
+            if (!shape.IsNull())
             {
-                TopoDS_Shape shape = reader.Shape(i);
-                if (!shape.IsNull())
-                {
-                    builder.Add(compound, shape);
-                }
+                roots.push_back(shape);
             }
-            
-            result = compound;
         }
-        
+    }
+
+    if (roots.empty())
+    {
+        error = std::string("No shapes could be transferred from STEP file: ") + filename;
+        return result;
+    }
+
+    qDebug() << "Transferred" << roots.size() << "shapes from STEP file";
+    TRACE_COUNTER("import", "step roots", roots.size());
+
+    healRoots(roots, control);
+    if (control.isCancelled()) {
+        error = cancelledMessage;
+        return result;
+    }
+
+    if (roots.size() == 1)
+    {
+        // Single shape
+        result = roots.front();
+    }
+    else
+    {
+        // Multiple shapes - create a compound
+        TopoDS_Compound compound;
+        BRep_Builder builder;
+        builder.MakeCompound(compound);
+        for (const TopoDS_Shape& shape : roots)
+        {
+            builder.Add(compound, shape);
+        }
+        result = compound;
+    }
+
+    meshForDisplay(result, control);
+    if (control.isCancelled()) {
+        error = cancelledMessage;
+        return TopoDS_Shape();
+    }
+
+    cache.store(cacheKey, result);
+
+    if (control.report) {
+        control.report(1.0, "STEP import complete");
+    }
+    return result;
+}
+
+} // namespace
+
+StepLoader::StepLoader()
+    : m_isValid(false)
+{
+}
+
+StepLoader::~StepLoader()
+{
+}
+
+TopoDS_Shape StepLoader::loadStepFile(const std::string& filename)
+{
+    m_isValid = false;
+    m_lastError.clear();
+
+    TopoDS_Shape result;
+
+    try {
+        result = importStepFile(filename, ImportControl(), m_lastError);
+
         if (!result.IsNull())
         {
             m_isValid = true;
             qDebug() << "Successfully loaded STEP file:" << QString::fromStdString(filename);
         }
-        else
+        else if (m_lastError.empty())
         {
             m_lastError = "Resulting shape is null";
         }
-        
+
     } catch (const std::exception& e) {
         m_lastError = std::string("Exception while loading STEP file: ") + e.what();
         qDebug() << QString::fromStdString(m_lastError);
@@ -134,6 +395,129 @@ TopoDS_Shape StepLoader::loadStepFile(const std::string& filename)
         m_lastError = "Unknown exception while loading STEP file";
         qDebug() << QString::fromStdString(m_lastError);
     }
-    
+
     return result;
-} 
\ No newline at end of file
+}
+
+std::shared_ptr<StepImportJob> StepLoader::loadStepFileAsync(const std::string& filename,
+                                                             ProgressCallback progressCallback,
+                                                             CompletionCallback completionCallback)
+{
+    std::shared_ptr<StepImportJob> job(new StepImportJob(filename,
+                                                         std::move(progressCallback),
+                                                         std::move(completionCallback)));
+    job->start();
+    return job;
+}
+
+// ---------------------------------------------------------------------------
+// StepImportJob
+// ---------------------------------------------------------------------------
+
+StepImportJob::StepImportJob(const std::string& filename,
+                             StepLoader::ProgressCallback progressCallback,
+                             StepLoader::CompletionCallback completionCallback)
+    : m_id(g_nextStepImportJobId++)
+    , m_filename(filename)
+    , m_progressCallback(std::move(progressCallback))
+    , m_completionCallback(std::move(completionCallback))
+{
+}
+
+void StepImportJob::start()
+{
+    // The worker holds a strong reference so the job outlives a dropped handle
+    std::thread([self = shared_from_this()]() {
+        self->run();
+    }).detach();
+}
+
+void StepImportJob::run()
+{
+    ImportControl control;
+    control.cancelRequested = &m_cancelRequested;
+    control.report = [this](double progress, const char* stage) {
+        m_progress = progress;
+        if (m_progressCallback && !m_cancelRequested) {
+            m_progressCallback(progress, stage);
+        }
+    };
+
+    TopoDS_Shape shape;
+    std::string error;
+    try {
+        shape = importStepFile(m_filename, control, error);
+        if (shape.IsNull() && error.empty()) {
+            error = "Resulting shape is null";
+        }
+    } catch (const std::exception& e) {
+        error = std::string("Exception while loading STEP file: ") + e.what();
+    } catch (...) {
+        error = "Unknown exception while loading STEP file";
+    }
+
+    State finalState = State::Completed;
+    if (m_cancelRequested) {
+        finalState = State::Cancelled;
+        shape.Nullify();
+        if (error.empty()) {
+            error = std::string("Import cancelled: ") + m_filename;
+        }
+    } else if (shape.IsNull()) {
+        finalState = State::Failed;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shape = shape;
+        m_error = error;
+        m_state = finalState;
+    }
+
+    // Waiters are woken only after the callbacks have run and been released
+    StepLoader::CompletionCallback completion = std::move(m_completionCallback);
+    m_completionCallback = nullptr;
+    m_progressCallback = nullptr;
+    if (completion) {
+        completion(shared_from_this());
+        completion = nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished = true;
+    }
+    m_finishedCondition.notify_all();
+}
+
+bool StepImportJob::isFinished() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_finished;
+}
+
+void StepImportJob::wait() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finishedCondition.wait(lock, [this]() { return m_finished; });
+}
+
+bool StepImportJob::waitFor(std::chrono::milliseconds timeout) const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_finishedCondition.wait_for(lock, timeout, [this]() { return m_finished; });
+}
+
+TopoDS_Shape StepImportJob::takeShape()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    TopoDS_Shape shape = m_shape;
+    m_shape.Nullify();
+    return shape;
+}
+
+std::string StepImportJob::getError() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_error;
+}
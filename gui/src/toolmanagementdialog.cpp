@@ -29,6 +29,7 @@
 #include <QSet>
 
 #include "toolmanager.h"
+#include "toolrepository.h"
 #include "opengl3dwidget.h"
 
 // OpenCASCADE includes for geometry generation
@@ -148,6 +149,24 @@ void ToolManagementDialog::setupAutoSave() {
     m_autoSaveTimer->setSingleShot(true);
     m_autoSaveTimer->setInterval(AUTO_SAVE_DELAY_MS);
     connect(m_autoSaveTimer, &QTimer::timeout, this, &ToolManagementDialog::onAutoSaveTimeout);
+
+    // The repository writes in the background; report the outcome once it is known
+    IntuiCAM::GUI::ToolRepository& repository = IntuiCAM::GUI::ToolRepository::instance();
+    connect(&repository, &IntuiCAM::GUI::ToolRepository::saved, this, [this]() {
+        if (!m_unwrittenToolId.isEmpty()) {
+            qDebug() << "Successfully saved tool:" << m_unwrittenToolId;
+            m_unwrittenToolId.clear();
+        }
+    });
+    connect(&repository, &IntuiCAM::GUI::ToolRepository::saveFailed, this, [this](const QString& error) {
+        if (m_unwrittenToolId.isEmpty()) {
+            return;
+        }
+        qWarning() << "Failed to save tool:" << m_unwrittenToolId << error;
+        QMessageBox::warning(this, "Save Failed",
+            QString("Tool '%1' could not be written to the tool database:\n%2").arg(m_unwrittenToolId, error));
+        m_unwrittenToolId.clear();
+    });
 }
 
 void ToolManagementDialog::createToolEditPanel() {
@@ -284,7 +303,8 @@ void ToolManagementDialog::saveCurrentTool() {
     // Save to database/file system
     bool wasNewTool = m_isNewTool;
     if (saveToolAssemblyToDatabase()) {
-        qDebug() << "Successfully saved tool:" << m_currentToolId;
+        // Logged as saved once the background write completes
+        m_unwrittenToolId = m_currentToolId;
         
         m_dataModified = false;
         
@@ -620,28 +640,11 @@ QString ToolManagementDialog::getToolTypePrefix(ToolType toolType) const {
 }
 
 QString ToolManagementDialog::generateUniqueToolId(const QString& prefix) const {
-    // Load existing database to check for existing IDs
-    QString dbPath = getToolAssemblyDatabasePath();
+    // Check against the ids already in the shared tool repository
     QSet<QString> existingIds;
-    
-    QFile file(dbPath);
-    if (file.open(QIODevice::ReadOnly)) {
-        QByteArray data = file.readAll();
-        file.close();
-        
-        QJsonParseError error;
-        QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-        if (error.error == QJsonParseError::NoError && doc.isObject()) {
-            QJsonObject database = doc.object();
-            QJsonArray toolsArray = database["tools"].toArray();
-            
-            for (const QJsonValue& toolValue : toolsArray) {
-                QJsonObject toolObj = toolValue.toObject();
-                QString existingId = toolObj["id"].toString();
-                if (!existingId.isEmpty()) {  // Skip empty IDs
-                    existingIds.insert(existingId);
-                }
-            }
+    for (const QString& existingId : IntuiCAM::GUI::ToolRepository::instance().toolIds()) {
+        if (!existingId.isEmpty()) {  // Skip empty IDs
+            existingIds.insert(existingId);
         }
     }
     
@@ -2472,36 +2475,8 @@ void ToolManagementDialog::setMaterialManager(IntuiCAM::GUI::MaterialManager* ma
     }
 }
 
-QString ToolManagementDialog::getToolAssemblyDatabasePath() const {
-    QString dataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
-    QDir dir(dataDir);
-    if (!dir.exists()) {
-        dir.mkpath(".");
-    }
-    return dir.absoluteFilePath("tool_assemblies.json");
-}
-
 bool ToolManagementDialog::saveToolAssemblyToDatabase() {
-    QString dbPath = getToolAssemblyDatabasePath();
-    
-    // Load existing database
-    QJsonObject database;
-    QFile file(dbPath);
-    if (file.open(QIODevice::ReadOnly)) {
-        QByteArray data = file.readAll();
-        file.close();
-        
-        QJsonParseError error;
-        QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-        if (error.error == QJsonParseError::NoError && doc.isObject()) {
-            database = doc.object();
-        }
-    }
-    
-    // Ensure tools array exists
-    if (!database.contains("tools")) {
-        database["tools"] = QJsonArray();
-    }
+    IntuiCAM::GUI::ToolRepository& repository = IntuiCAM::GUI::ToolRepository::instance();
     
     // For new tools, ensure we have a proper unique ID before saving
     if (m_isNewTool) {
@@ -2541,68 +2516,30 @@ bool ToolManagementDialog::saveToolAssemblyToDatabase() {
     QJsonObject toolJson = toolAssemblyToJson(m_currentToolAssembly);
     
     // Update or add tool in database
-    QJsonArray toolsArray = database["tools"].toArray();
-    bool toolFound = false;
     QString toolIdToSave = QString::fromStdString(m_currentToolAssembly.id);
     
-    // For existing tools, find and update
     if (!m_isNewTool) {
-        for (int i = 0; i < toolsArray.size(); ++i) {
-            QJsonObject existingTool = toolsArray[i].toObject();
-            if (existingTool["id"].toString() == toolIdToSave) {
-                toolsArray[i] = toolJson;
-                toolFound = true;
-                qDebug() << "Updated existing tool in database:" << toolIdToSave;
-                break;
-            }
-        }
-        
-        if (!toolFound) {
-            qWarning() << "Existing tool not found in database for update:" << toolIdToSave;
+        if (repository.contains(toolIdToSave)) {
+            qDebug() << "Updated existing tool in database:" << toolIdToSave;
+        } else {
             // For safety, treat as new tool
-            toolsArray.append(toolJson);
+            qWarning() << "Existing tool not found in database for update:" << toolIdToSave;
             qDebug() << "Added as new tool since existing tool not found:" << toolIdToSave;
         }
-    } else {
-        // For new tools, verify uniqueness and append
-        for (int i = 0; i < toolsArray.size(); ++i) {
-            QJsonObject existingTool = toolsArray[i].toObject();
-            if (existingTool["id"].toString() == toolIdToSave) {
-                qWarning() << "ID collision detected for new tool:" << toolIdToSave;
-                // Generate a completely new unique ID to avoid collision
-                QString newUniqueId = QString("%1_%2").arg(getToolTypePrefix(m_currentToolType))
-                                                     .arg(QDateTime::currentMSecsSinceEpoch());
-                m_currentToolId = newUniqueId;
-                m_currentToolAssembly.id = m_currentToolId.toStdString();
-                toolJson = toolAssemblyToJson(m_currentToolAssembly);
-                qDebug() << "Generated new ID to avoid collision:" << newUniqueId;
-                break;
-            }
-        }
-        
-        // Add new tool to the end of the array
-        toolsArray.append(toolJson);
-        qDebug() << "Added new tool to database:" << QString::fromStdString(m_currentToolAssembly.id) 
-                 << "Total tools:" << toolsArray.size();
-    }
-    
-    database["tools"] = toolsArray;
-    database["version"] = "1.0";
-    database["lastModified"] = QDateTime::currentDateTime().toString(Qt::ISODate);
-    database["toolCount"] = toolsArray.size();
-    
-    // Save database with error checking
-    QJsonDocument doc(database);
-    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        qWarning() << "Failed to open tool assembly database for writing:" << dbPath;
-        return false;
-    }
-    
-    qint64 bytesWritten = file.write(doc.toJson());
-    file.close();
-    
-    if (bytesWritten == -1) {
-        qWarning() << "Failed to write tool data to database";
+    } else if (repository.contains(toolIdToSave)) {
+        qWarning() << "ID collision detected for new tool:" << toolIdToSave;
+        // Generate a completely new unique ID to avoid collision
+        QString newUniqueId = QString("%1_%2").arg(getToolTypePrefix(m_currentToolType))
+                                             .arg(QDateTime::currentMSecsSinceEpoch());
+        m_currentToolId = newUniqueId;
+        m_currentToolAssembly.id = m_currentToolId.toStdString();
+        toolJson = toolAssemblyToJson(m_currentToolAssembly);
+        qDebug() << "Generated new ID to avoid collision:" << newUniqueId;
+    }
+    
+    // The repository persists in the background; saving never waits on the disk
+    if (!repository.upsertTool(toolJson)) {
+        qWarning() << "Failed to store tool assembly in database";
         return false;
     }
     
@@ -2612,49 +2549,17 @@ bool ToolManagementDialog::saveToolAssemblyToDatabase() {
         qDebug() << "Tool is no longer considered 'new' after first successful save:" << QString::fromStdString(m_currentToolAssembly.id);
     }
     
-    qDebug() << "Successfully saved tool assembly to database:" << QString::fromStdString(m_currentToolAssembly.id);
-    qDebug() << "Database now contains" << toolsArray.size() << "tools";
+    qDebug() << "Stored tool assembly in repository:" << QString::fromStdString(m_currentToolAssembly.id);
+    qDebug() << "Database now contains" << repository.toolCount() << "tools";
     return true;
 }
 
 bool ToolManagementDialog::loadToolAssemblyFromDatabase(const QString& toolId) {
-    QString dbPath = getToolAssemblyDatabasePath();
-    
-    QFile file(dbPath);
-    if (!file.open(QIODevice::ReadOnly)) {
-        qDebug() << "Tool assembly database not found:" << dbPath;
-        return false;
-    }
-    
-    QByteArray data = file.readAll();
-    file.close();
-    
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-    if (error.error != QJsonParseError::NoError) {
-        qWarning() << "Failed to parse tool assembly database:" << error.errorString();
-        return false;
-    }
-    
-    if (!doc.isObject()) {
-        qWarning() << "Tool assembly database is not a valid JSON object";
-        return false;
-    }
-    
-    QJsonObject database = doc.object();
-    if (!database.contains("tools")) {
-        qDebug() << "No tools found in database";
-        return false;
-    }
-    
-    QJsonArray toolsArray = database["tools"].toArray();
-    for (const QJsonValue& toolValue : toolsArray) {
-        QJsonObject toolObj = toolValue.toObject();
-        if (toolObj["id"].toString() == toolId) {
-            m_currentToolAssembly = toolAssemblyFromJson(toolObj);
-            qDebug() << "Loaded tool assembly from database:" << toolId;
-            return true;
-        }
+    const IntuiCAM::GUI::ToolRepository& repository = IntuiCAM::GUI::ToolRepository::instance();
+    if (repository.contains(toolId)) {
+        m_currentToolAssembly = toolAssemblyFromJson(repository.tool(toolId));
+        qDebug() << "Loaded tool assembly from database:" << toolId;
+        return true;
     }
     
     qDebug() << "Tool not found in database:" << toolId;
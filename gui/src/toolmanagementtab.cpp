@@ -1,5 +1,6 @@
 ﻿#include "toolmanagementtab.h"
 #include "toolmanagementdialog.h"
+#include "toolrepository.h"
 #include "mainwindow.h"
 #include "IntuiCAM/Toolpath/ToolTypes.h"
 
@@ -16,6 +17,7 @@
 #include <QDir>
 #include <QFile>
 #include <QDateTime>
+#include <QSet>
 
 using namespace IntuiCAM::Toolpath;
 
@@ -380,51 +382,19 @@ void ToolManagementTab::setupContextMenu() {
 void ToolManagementTab::populateToolList() {
     m_toolTreeWidget->clear();
     
-    // Load tools from the tool assembly database
-    QString databasePath = getToolAssemblyDatabasePath();
-    QFile file(databasePath);
-    
-    if (!file.open(QIODevice::ReadOnly)) {
-        qDebug() << "Tool assembly database not found, creating default tools:" << databasePath;
-        
+    // Tools come from the shared in-memory repository; nothing is re-read from disk
+    IntuiCAM::GUI::ToolRepository& repository = IntuiCAM::GUI::ToolRepository::instance();
+    if (!repository.wasLoadedFromDisk() && repository.isEmpty()) {
+        qDebug() << "Tool assembly database not found, creating default tools:" << repository.databasePath();
+
         // Automatically create default tools when no database exists
         createDefaultToolDatabase();
-        
-        // Try to open the newly created database
-        if (!file.open(QIODevice::ReadOnly)) {
-            qWarning() << "Failed to create or open tool assembly database:" << databasePath;
-            return;
-        }
-    }
-    
-    // Read and parse the tool database
-    QByteArray data = file.readAll();
-    file.close();
-    
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-    if (error.error != QJsonParseError::NoError) {
-        qWarning() << "Failed to parse tool assembly database:" << error.errorString();
-        return;
-    }
-    
-    if (!doc.isObject()) {
-        qWarning() << "Tool assembly database is not a valid JSON object";
-        return;
     }
-    
-    QJsonObject database = doc.object();
-    if (!database.contains("tools")) {
-        qDebug() << "No tools found in database";
-        return;
-    }
-    
-    QJsonArray toolsArray = database["tools"].toArray();
-    
+
+    const QVector<QJsonObject>& tools = repository.tools();
+
     // Populate tree widget with tools from database
-    for (const QJsonValue& toolValue : toolsArray) {
-        QJsonObject toolObj = toolValue.toObject();
-        
+    for (const QJsonObject& toolObj : tools) {
         auto item = new QTreeWidgetItem(m_toolTreeWidget);
         item->setText(COL_NAME, toolObj["name"].toString());
         item->setData(COL_NAME, Qt::UserRole, toolObj.value("id").toString());
@@ -481,7 +451,7 @@ void ToolManagementTab::populateToolList() {
         }
     }
     
-    qDebug() << "Loaded" << toolsArray.size() << "tools from database";
+    qDebug() << "Loaded" << tools.size() << "tools from database";
     
     // Resize columns to fit content
     for (int i = 0; i < m_toolTreeWidget->columnCount(); ++i) {
@@ -687,92 +657,16 @@ void ToolManagementTab::addNewTool() {
 }
 
 void ToolManagementTab::cleanupEmptyIdTools() {
-    QString databasePath = getToolAssemblyDatabasePath();
-    QFile dbFile(databasePath);
-    
-    if (!dbFile.open(QIODevice::ReadOnly)) {
-        qDebug() << "Cannot open database for cleanup";
-        return;
-    }
-
-    QByteArray data = dbFile.readAll();
-    dbFile.close();
-
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
-        qDebug() << "Cannot parse database for cleanup";
-        return;
-    }
-
-    QJsonObject rootObj = doc.object();
-    QJsonArray toolsArray = rootObj["tools"].toArray();
-    QJsonArray cleanedArray;
-    bool foundEmptyIds = false;
-    
-    // Remove tools with empty IDs and assign new IDs to any that should be kept
-    for (int i = 0; i < toolsArray.size(); ++i) {
-        QJsonObject toolObj = toolsArray[i].toObject();
-        QString currentId = toolObj["id"].toString();
-        
-        if (currentId.isEmpty()) {
-            foundEmptyIds = true;
-            qDebug() << "Found tool with empty ID, removing:" << toolObj["name"].toString();
-            // Don't add to cleaned array (effectively deleting it)
-        } else {
-            cleanedArray.append(toolObj);
-        }
-    }
-    
-    if (foundEmptyIds) {
-        // Update the database
-        rootObj["tools"] = cleanedArray;
-        rootObj["lastModified"] = QDateTime::currentDateTime().toString(Qt::ISODate);
-        rootObj["toolCount"] = cleanedArray.size();
-        
-        if (dbFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-            QJsonDocument newDoc(rootObj);
-            dbFile.write(newDoc.toJson());
-            dbFile.close();
-            qDebug() << "Cleaned up tools with empty IDs from database";
-        }
+    int removed = IntuiCAM::GUI::ToolRepository::instance().removeToolsWithEmptyId();
+    if (removed > 0) {
+        qDebug() << "Cleaned up" << removed << "tools with empty IDs from database";
     }
 }
 
 bool ToolManagementTab::verifyToolInDatabase(const QString& toolId) {
-    QString databasePath = getToolAssemblyDatabasePath();
-    QFile dbFile(databasePath);
-    
-    if (!dbFile.open(QIODevice::ReadOnly)) {
-        qWarning() << "Failed to open database for verification:" << databasePath;
-        return false;
-    }
-
-    QByteArray data = dbFile.readAll();
-    dbFile.close();
-
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-    if (error.error != QJsonParseError::NoError) {
-        qWarning() << "Failed to parse database JSON during verification:" << error.errorString();
-        return false;
-    }
-
-    if (!doc.isObject()) {
-        qWarning() << "Database is not a valid JSON object during verification";
-        return false;
-    }
-
-    QJsonObject rootObj = doc.object();
-    QJsonArray toolsArray = rootObj["tools"].toArray();
-    
-    // Check if the tool exists in the database
-    for (const QJsonValue& toolValue : toolsArray) {
-        QJsonObject toolObj = toolValue.toObject();
-        if (toolObj["id"].toString() == toolId) {
-            qDebug() << "Verified tool exists in database:" << toolId;
-            return true;
-        }
+    if (IntuiCAM::GUI::ToolRepository::instance().contains(toolId)) {
+        qDebug() << "Verified tool exists in database:" << toolId;
+        return true;
     }
 
     qWarning() << "Tool not found in database during verification:" << toolId;
@@ -863,8 +757,7 @@ void ToolManagementTab::deleteSelectedTool() {
             bool deletionSuccessful = false;
             
             // Remove tool from the persistent database first
-            QString databasePath = getToolAssemblyDatabasePath();
-            if (deleteToolFromDatabase(toolId, databasePath)) {
+            if (deleteToolFromDatabase(toolId)) {
                 // Only remove from UI if database deletion was successful
                 auto selectedItems = m_toolTreeWidget->selectedItems();
                 if (!selectedItems.isEmpty()) {
@@ -901,108 +794,15 @@ void ToolManagementTab::deleteSelectedTool() {
     }
 }
 
-bool ToolManagementTab::deleteToolFromDatabase(const QString& toolId, const QString& databasePath) {
-    QFile dbFile(databasePath);
-    if (!dbFile.open(QIODevice::ReadOnly)) {
-        qWarning() << "Failed to open database for reading:" << databasePath;
-        return false;
-    }
-
-    QByteArray data = dbFile.readAll();
-    dbFile.close();
-
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-    if (error.error != QJsonParseError::NoError) {
-        qWarning() << "Failed to parse database JSON:" << error.errorString();
-        return false;
-    }
-
-    if (!doc.isObject()) {
-        qWarning() << "Database is not a valid JSON object";
-        return false;
-    }
-
-    QJsonObject rootObj = doc.object();
-    QJsonArray toolsArray = rootObj["tools"].toArray();
-    QJsonArray newArray;
-    bool toolFound = false;
-    int deletedToolIndex = -1;
-    
-    // Filter out the tool to be deleted
-    for (int i = 0; i < toolsArray.size(); ++i) {
-        QJsonObject obj = toolsArray[i].toObject();
-        QString currentId = obj["id"].toString();
-        
-        // Handle different deletion cases
-        bool shouldDelete = false;
-        if (toolId.isEmpty() && currentId.isEmpty()) {
-            // Both are empty - delete the first empty ID tool found
-            shouldDelete = true;
-        } else if (!toolId.isEmpty() && currentId == toolId) {
-            // Normal case - exact ID match
-            shouldDelete = true;
-        }
-        
-        if (shouldDelete && !toolFound) {
-            toolFound = true;
-            deletedToolIndex = i;
-            qDebug() << "Found tool to delete at index" << i << "with ID:" << (currentId.isEmpty() ? "<empty>" : currentId);
-            // Don't add this tool to the new array (effectively deleting it)
-        } else {
-            newArray.append(obj);
-        }
-    }
-
-    if (!toolFound) {
+bool ToolManagementTab::deleteToolFromDatabase(const QString& toolId) {
+    IntuiCAM::GUI::ToolRepository& repository = IntuiCAM::GUI::ToolRepository::instance();
+    if (!repository.removeTool(toolId)) {
         qWarning() << "Tool not found in database:" << (toolId.isEmpty() ? "<empty ID>" : toolId);
-        
-        // If looking for empty ID tool, try to find and delete any tool with empty ID
-        if (toolId.isEmpty()) {
-            for (int i = 0; i < toolsArray.size(); ++i) {
-                QJsonObject obj = toolsArray[i].toObject();
-                if (obj["id"].toString().isEmpty()) {
-                    // Found a tool with empty ID, delete it
-                    newArray = QJsonArray(); // Reset the array
-                    for (int j = 0; j < toolsArray.size(); ++j) {
-                        if (j != i) {
-                            newArray.append(toolsArray[j]);
-                        }
-                    }
-                    toolFound = true;
-                    qDebug() << "Deleted tool with empty ID at index:" << i;
-                    break;
-                }
-            }
-        }
-        
-        if (!toolFound) {
-            return false;
-        }
-    }
-
-    // Update the database with the new array
-    rootObj["tools"] = newArray;
-    rootObj["lastModified"] = QDateTime::currentDateTime().toString(Qt::ISODate);
-    rootObj["toolCount"] = newArray.size();
-    
-    // Write back to database
-    if (!dbFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-        qWarning() << "Failed to open database for writing:" << databasePath;
-        return false;
-    }
-
-    QJsonDocument newDoc(rootObj);
-    qint64 bytesWritten = dbFile.write(newDoc.toJson());
-    dbFile.close();
-
-    if (bytesWritten == -1) {
-        qWarning() << "Failed to write to database";
         return false;
     }
 
     qDebug() << "Successfully deleted tool from database:" << (toolId.isEmpty() ? "<empty ID>" : toolId);
-    qDebug() << "Database now contains" << newArray.size() << "tools";
+    qDebug() << "Database now contains" << repository.toolCount() << "tools";
     return true;
 }
 
@@ -1870,80 +1670,41 @@ void ToolManagementTab::loadDefaultTools() {
         database["created"] = QDateTime::currentDateTime().toString(Qt::ISODate);
         database["description"] = "IntuiCAM Default Tool Library";
         
-        // Write to database file
-        QString databasePath = getToolAssemblyDatabasePath();
-        QJsonDocument doc(database);
-        QFile file(databasePath);
+        // Hand the library to the repository; it is written in the background
+        IntuiCAM::GUI::ToolRepository::instance().replaceAll(toolsArray, database);
+        qDebug() << "Stored 9 default tools in the repository; the write follows in the background";
         
-        if (file.open(QIODevice::WriteOnly)) {
-            file.write(doc.toJson());
-            file.close();
-            
-            qDebug() << "Successfully saved 9 default tools to database:" << databasePath;
-            
-            // Refresh the tool list to show the new tools
-            refreshToolList();
-            
-            QMessageBox::information(this, "Default Tools Loaded", 
-                "Successfully created and loaded 9 professional lathe tools:\n\n"
-                "• Right-Hand Internal Threading (T01)\n"
-                "• Right-Hand Internal Boring (T02)\n"
-                "• Right-Hand Parting/Grooving (T03)\n"
-                "• Right-Hand External Threading (T04)\n"
-                "• Left-Hand Longitudinal Turning (T05)\n"
-                "• Right-Hand Longitudinal/Facing/Chamfering (T06)\n"
-                "• Right-Hand Longitudinal Turning (T07)\n"
-                "• Right-Hand Facing/Chamfering (T08)\n"
-                "• Neutral Longitudinal Turning (T09)\n\n"
-                "All tools include complete insert, holder, and cutting parameters.");
-        } else {
-            QMessageBox::warning(this, "Error", 
-                "Failed to save default tools to database: " + file.errorString());
-        }
+        // Refresh the tool list to show the new tools
+        refreshToolList();
+        
+        QMessageBox::information(this, "Default Tools Loaded", 
+            "Successfully created and loaded 9 professional lathe tools:\n\n"
+            "• Right-Hand Internal Threading (T01)\n"
+            "• Right-Hand Internal Boring (T02)\n"
+            "• Right-Hand Parting/Grooving (T03)\n"
+            "• Right-Hand External Threading (T04)\n"
+            "• Left-Hand Longitudinal Turning (T05)\n"
+            "• Right-Hand Longitudinal/Facing/Chamfering (T06)\n"
+            "• Right-Hand Longitudinal Turning (T07)\n"
+            "• Right-Hand Facing/Chamfering (T08)\n"
+            "• Neutral Longitudinal Turning (T09)\n\n"
+            "All tools include complete insert, holder, and cutting parameters.");
         
         emit toolLibraryChanged();
     }
 }
 
 void ToolManagementTab::ensureDefaultToolsExist() {
-    QString databasePath = getToolAssemblyDatabasePath();
-    qDebug() << "ToolManagementTab::ensureDefaultToolsExist() - Database path:" << databasePath;
-    QFile file(databasePath);
-    
-    // If database file doesn't exist, create it with default tools
-    if (!file.exists()) {
-        qDebug() << "No tool database found, creating default tools on startup";
+    IntuiCAM::GUI::ToolRepository& repository = IntuiCAM::GUI::ToolRepository::instance();
+    qDebug() << "ToolManagementTab::ensureDefaultToolsExist() - Database path:" << repository.databasePath();
+
+    // The repository parsed the file once at startup; a missing, corrupted or
+    // empty database all show up as an empty repository
+    if (repository.isEmpty()) {
+        qDebug() << "Tool database missing, corrupted or empty, creating default tools";
         createDefaultToolDatabase();
     } else {
-        // If file exists, check if it has tools in it
-        if (file.open(QIODevice::ReadOnly)) {
-            QByteArray data = file.readAll();
-            file.close();
-            
-            QJsonParseError error;
-            QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-            if (error.error == QJsonParseError::NoError && doc.isObject()) {
-                QJsonObject database = doc.object();
-                if (database.contains("tools")) {
-                    QJsonArray toolsArray = database["tools"].toArray();
-                    if (toolsArray.isEmpty()) {
-                        qDebug() << "Tool database exists but is empty, creating default tools";
-                        createDefaultToolDatabase();
-                    } else {
-                        qDebug() << "Tool database exists with" << toolsArray.size() << "tools";
-                    }
-                } else {
-                    qDebug() << "Tool database exists but has no tools array, creating default tools";
-                    createDefaultToolDatabase();
-                }
-            } else {
-                qDebug() << "Tool database exists but is corrupted, recreating with default tools";
-                createDefaultToolDatabase();
-            }
-        } else {
-            qDebug() << "Could not read tool database, creating default tools";
-            createDefaultToolDatabase();
-        }
+        qDebug() << "Tool database exists with" << repository.toolCount() << "tools";
     }
 }
 
@@ -2655,18 +2416,9 @@ void ToolManagementTab::createDefaultToolDatabase() {
     database["created"] = QDateTime::currentDateTime().toString(Qt::ISODate);
     database["description"] = "IntuiCAM Default Tool Library - Auto-created on first run";
     
-    // Write to database file
-    QString databasePath = getToolAssemblyDatabasePath();
-    QJsonDocument doc(database);
-    QFile file(databasePath);
-    
-    if (file.open(QIODevice::WriteOnly)) {
-        file.write(doc.toJson());
-        file.close();
-        qDebug() << "Successfully created default tool database with 9 tools:" << databasePath;
-    } else {
-        qWarning() << "Failed to create default tool database:" << file.errorString();
-    }
+    // Hand the library to the repository; it is written in the background
+    IntuiCAM::GUI::ToolRepository::instance().replaceAll(toolsArray, database);
+    qDebug() << "Stored default tool database with 9 tools; the write follows in the background";
 }
 
 // Filter and utility methods
@@ -2686,12 +2438,34 @@ void ToolManagementTab::applyFilters() {
     QString materialFilter = m_materialFilter->currentText();
     QString statusFilter = m_statusFilter->currentText();
     
+    // Type and exact ISO code matches come from the repository's indexes
+    const IntuiCAM::GUI::ToolRepository& repository = IntuiCAM::GUI::ToolRepository::instance();
+    QSet<QString> typeIds;
+    if (typeFilter != "All Types") {
+        for (int type = static_cast<int>(ToolType::GENERAL_TURNING);
+             type <= static_cast<int>(ToolType::LIVE_TOOLING); ++type) {
+            if (formatToolType(static_cast<ToolType>(type)) == typeFilter) {
+                for (const QString& id : repository.toolIdsByType(type)) {
+                    typeIds.insert(id);
+                }
+            }
+        }
+    }
+    QSet<QString> isoCodeIds;
+    const QString isoCode = m_searchBox->text().trimmed().toUpper();
+    if (!isoCode.isEmpty()) {
+        for (const QString& id : repository.toolIdsByIsoCode(isoCode)) {
+            isoCodeIds.insert(id);
+        }
+    }
+    
     for (int i = 0; i < m_toolTreeWidget->topLevelItemCount(); ++i) {
         auto item = m_toolTreeWidget->topLevelItem(i);
+        const QString toolId = item->data(COL_NAME, Qt::UserRole).toString();
         bool visible = true;
         
         // Apply search filter
-        if (!searchText.isEmpty()) {
+        if (!searchText.isEmpty() && !isoCodeIds.contains(toolId)) {
             QString itemText = item->text(COL_NAME).toLower() + " " +
                               item->text(COL_INSERT_TYPE).toLower() + " " +
                               item->text(COL_HOLDER_TYPE).toLower();
@@ -2700,7 +2474,7 @@ void ToolManagementTab::applyFilters() {
         
         // Apply type filter
         if (typeFilter != "All Types") {
-            visible = visible && (item->text(COL_TYPE) == typeFilter);
+            visible = visible && typeIds.contains(toolId);
         }
         
         // Apply status filter
@@ -3045,14 +2819,3 @@ QStringList ToolManagementTab::getSelectedToolIds() const {
     }
     return toolIds;
 }
-
-QString ToolManagementTab::getToolAssemblyDatabasePath() const {
-    QString dataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
-    QDir dir(dataDir);
-    if (!dir.exists()) {
-        dir.mkpath(dataDir);
-    }
-    
-    QString dbPath = dir.filePath("tool_assemblies.json");
-    return dbPath;
-}
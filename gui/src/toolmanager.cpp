@@ -1,4 +1,5 @@
 #include "toolmanager.h"
+#include "toolrepository.h"
 #include <QDebug>
 #include <QJsonArray>
 #include <QStandardPaths>
@@ -35,23 +36,32 @@ ToolManager::ToolManager(QObject *parent)
 {
     m_databasePath = getDatabaseFilePath();
     
-    // Try to load existing database, create default if none exists
+    // Fall back to built-in tools while the shared library is empty; they are
+    // kept in memory only and never overwrite the user's database
     if (!loadToolDatabase()) {
-        qDebug() << "Creating default tool database...";
+        qDebug() << "Tool library is empty, using built-in default tools";
         initializeDefaultTools();
-        saveToolDatabase();
     }
     
-    connect(this, &ToolManager::toolAdded, this, &ToolManager::onDatabaseChanged);
-    connect(this, &ToolManager::toolUpdated, this, &ToolManager::onDatabaseChanged);
-    connect(this, &ToolManager::toolRemoved, this, &ToolManager::onDatabaseChanged);
+    // Mirror the shared repository rather than re-reading the database file
+    ToolRepository& repository = ToolRepository::instance();
+    connect(&repository, &ToolRepository::toolAdded, this, [this](const QString& toolId) {
+        onDatabaseChanged();
+        emit toolAdded(toolId);
+    });
+    connect(&repository, &ToolRepository::toolUpdated, this, [this](const QString& toolId) {
+        onDatabaseChanged();
+        emit toolUpdated(toolId);
+    });
+    connect(&repository, &ToolRepository::toolRemoved, this, [this](const QString& toolId) {
+        onDatabaseChanged();
+        emit toolRemoved(toolId);
+    });
+    connect(&repository, &ToolRepository::repositoryReset, this, &ToolManager::onDatabaseChanged);
 }
 
 ToolManager::~ToolManager()
 {
-    if (m_databaseLoaded) {
-        saveToolDatabase();
-    }
 }
 
 QStringList ToolManager::getAllToolIds() const
@@ -373,44 +383,20 @@ double ToolManager::calculateSuitabilityScore(
 
 QString ToolManager::getDatabaseFilePath() const
 {
-    QString dataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
-    QDir dir(dataDir);
-    if (!dir.exists()) {
-        dir.mkpath(".");
-    }
-    return dir.absoluteFilePath("tool_assemblies.json");
+    return ToolRepository::instance().databasePath();
 }
 
 bool ToolManager::loadToolDatabase()
 {
-    QFile file(m_databasePath);
-    if (!file.open(QIODevice::ReadOnly)) {
-        return false;
-    }
-
-    QByteArray data = file.readAll();
-    file.close();
-
-    QJsonParseError error;
-    QJsonDocument doc = QJsonDocument::fromJson(data, &error);
-    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
-        return false;
-    }
-
-    QJsonObject root = doc.object();
-    if (!root.contains("tools")) {
+    const ToolRepository& repository = ToolRepository::instance();
+    if (repository.isEmpty()) {
         return false;
     }
 
     m_tools.clear();
     m_toolsByType.clear();
 
-    QJsonArray toolsArray = root["tools"].toArray();
-    for (const QJsonValue &val : toolsArray) {
-        if (!val.isObject())
-            continue;
-        QJsonObject obj = val.toObject();
-
+    for (const QJsonObject &obj : repository.tools()) {
         CuttingTool tool;
         tool.id = obj["id"].toString();
         tool.name = obj["name"].toString();
@@ -466,15 +452,16 @@ bool ToolManager::loadToolDatabase()
 
 bool ToolManager::saveToolDatabase()
 {
-    Q_UNUSED(m_databasePath);
-    // Writing back to the tool assembly database is handled by the
-    // ToolManagementDialog. Avoid overwriting user data here.
-    return true;
+    // Tool assemblies are persisted by ToolRepository; this view never writes
+    return ToolRepository::instance().flush();
 }
 
 void ToolManager::onDatabaseChanged()
 {
-    saveToolDatabase();
+    // Rebuilt from the in-memory repository, so no file access or JSON parsing
+    if (!loadToolDatabase()) {
+        initializeDefaultTools();
+    }
 }
 
 // Static method implementations
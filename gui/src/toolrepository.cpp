@@ -0,0 +1,344 @@
+#include "toolrepository.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include <algorithm>
+
+namespace IntuiCAM {
+namespace GUI {
+
+namespace {
+
+// Long enough to coalesce a burst of edits, short enough that a crash loses little
+constexpr int kSaveDelayMs = 500;
+
+const char* const kInsertKeys[] = {"turningInsert", "threadingInsert", "groovingInsert", "holder"};
+
+ToolRepository* s_instance = nullptr;
+
+} // namespace
+
+ToolRepository& ToolRepository::instance()
+{
+    if (!s_instance) {
+        // Owned by the application so pending writes are flushed before exit
+        s_instance = new ToolRepository(QCoreApplication::instance());
+        if (QCoreApplication::instance()) {
+            connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit,
+                    s_instance, &ToolRepository::flush);
+        }
+    }
+    return *s_instance;
+}
+
+ToolRepository::ToolRepository(QObject* parent)
+    : QObject(parent)
+{
+    QString dataDir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir dir(dataDir);
+    if (!dir.exists()) {
+        dir.mkpath(".");
+    }
+    m_databasePath = dir.absoluteFilePath("tool_assemblies.json");
+
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(kSaveDelayMs);
+    connect(&m_saveTimer, &QTimer::timeout, this, [this]() {
+        std::lock_guard<std::mutex> lock(m_writerMutex);
+        m_pendingSnapshot = snapshot();
+        m_hasPendingSnapshot = true;
+        m_writerCondition.notify_one();
+    });
+
+    load();
+    m_writer = std::thread([this]() { writerLoop(); });
+}
+
+ToolRepository::~ToolRepository()
+{
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(m_writerMutex);
+        m_stopWriter = true;
+    }
+    m_writerCondition.notify_one();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+    if (s_instance == this) {
+        s_instance = nullptr;
+    }
+}
+
+void ToolRepository::load()
+{
+    QFile file(m_databasePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "ToolRepository: no tool database at" << m_databasePath;
+        return;
+    }
+
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError || !doc.isObject()) {
+        qWarning() << "ToolRepository: failed to parse tool database:" << error.errorString();
+        return;
+    }
+
+    QJsonObject root = doc.object();
+    const QJsonArray toolsArray = root.take("tools").toArray();
+    m_metadata = root;
+
+    m_tools.clear();
+    m_tools.reserve(toolsArray.size());
+    for (const QJsonValue& value : toolsArray) {
+        if (value.isObject()) {
+            m_tools.append(value.toObject());
+        }
+    }
+    rebuildIndexes();
+    m_loadedFromDisk = true;
+
+    qDebug() << "ToolRepository: loaded" << m_tools.size() << "tools from" << m_databasePath;
+}
+
+void ToolRepository::rebuildIndexes()
+{
+    // Cheap next to any file access: a library holds at most a few hundred tools
+    m_indexById.clear();
+    m_idsByType.clear();
+    m_idsByIsoCode.clear();
+    for (int i = 0; i < m_tools.size(); ++i) {
+        indexTool(i);
+    }
+}
+
+void ToolRepository::indexTool(int position)
+{
+    const QJsonObject& toolObj = m_tools[position];
+    const QString id = toolObj.value("id").toString();
+    if (id.isEmpty()) {
+        return;
+    }
+
+    m_indexById.insert(id, position);
+    m_idsByType[toolObj.value("toolType").toInt()].append(id);
+
+    for (const char* key : kInsertKeys) {
+        const QString isoCode = toolObj.value(key).toObject().value("isoCode").toString();
+        if (!isoCode.isEmpty()) {
+            m_idsByIsoCode[isoCode].append(id);
+        }
+    }
+}
+
+QStringList ToolRepository::toolIds() const
+{
+    QStringList ids;
+    ids.reserve(m_tools.size());
+    for (const QJsonObject& toolObj : m_tools) {
+        ids.append(toolObj.value("id").toString());
+    }
+    return ids;
+}
+
+QJsonObject ToolRepository::tool(const QString& toolId) const
+{
+    auto it = m_indexById.constFind(toolId);
+    return it != m_indexById.constEnd() ? m_tools[it.value()] : QJsonObject();
+}
+
+bool ToolRepository::upsertTool(const QJsonObject& toolJson)
+{
+    const QString id = toolJson.value("id").toString();
+    if (id.isEmpty()) {
+        qWarning() << "ToolRepository: refusing to store a tool without an id";
+        return false;
+    }
+
+    auto it = m_indexById.constFind(id);
+    if (it != m_indexById.constEnd()) {
+        m_tools[it.value()] = toolJson;
+        rebuildIndexes();
+        scheduleSave();
+        emit toolUpdated(id);
+    } else {
+        m_tools.append(toolJson);
+        indexTool(m_tools.size() - 1);
+        scheduleSave();
+        emit toolAdded(id);
+    }
+    return true;
+}
+
+bool ToolRepository::removeTool(const QString& toolId)
+{
+    int position = -1;
+    if (toolId.isEmpty()) {
+        for (int i = 0; i < m_tools.size(); ++i) {
+            if (m_tools[i].value("id").toString().isEmpty()) {
+                position = i;
+                break;
+            }
+        }
+    } else {
+        position = m_indexById.value(toolId, -1);
+    }
+
+    if (position < 0) {
+        return false;
+    }
+
+    m_tools.remove(position);
+    rebuildIndexes();
+    scheduleSave();
+    emit toolRemoved(toolId);
+    return true;
+}
+
+int ToolRepository::removeToolsWithEmptyId()
+{
+    const int before = m_tools.size();
+    m_tools.erase(std::remove_if(m_tools.begin(), m_tools.end(), [](const QJsonObject& toolObj) {
+        return toolObj.value("id").toString().isEmpty();
+    }), m_tools.end());
+
+    const int removed = before - m_tools.size();
+    if (removed > 0) {
+        rebuildIndexes();
+        scheduleSave();
+        emit repositoryReset();
+    }
+    return removed;
+}
+
+void ToolRepository::replaceAll(const QJsonArray& tools, const QJsonObject& metadata)
+{
+    m_metadata = metadata;
+    m_metadata.remove("tools");
+
+    m_tools.clear();
+    m_tools.reserve(tools.size());
+    for (const QJsonValue& value : tools) {
+        if (value.isObject()) {
+            m_tools.append(value.toObject());
+        }
+    }
+    rebuildIndexes();
+    scheduleSave();
+    emit repositoryReset();
+}
+
+void ToolRepository::scheduleSave()
+{
+    m_saveTimer.start();
+}
+
+QJsonObject ToolRepository::snapshot() const
+{
+    QJsonArray toolsArray;
+    for (const QJsonObject& toolObj : m_tools) {
+        toolsArray.append(toolObj);
+    }
+
+    QJsonObject root = m_metadata;
+    if (!root.contains("version")) {
+        root["version"] = "1.0";
+    }
+    root["tools"] = toolsArray;
+    root["toolCount"] = toolsArray.size();
+    root["lastModified"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+    return root;
+}
+
+bool ToolRepository::flush()
+{
+    std::unique_lock<std::mutex> lock(m_writerMutex);
+    if (m_saveTimer.isActive()) {
+        m_saveTimer.stop();
+        m_pendingSnapshot = snapshot();
+        m_hasPendingSnapshot = true;
+    }
+
+    if (!m_hasPendingSnapshot) {
+        // Wait for a write the thread may already have picked up
+        m_idleCondition.wait(lock, [this]() { return !m_writeInProgress; });
+        return true;
+    }
+
+    // Write on the calling thread rather than racing the writer
+    QJsonObject root = m_pendingSnapshot;
+    m_hasPendingSnapshot = false;
+    m_idleCondition.wait(lock, [this]() { return !m_writeInProgress; });
+
+    QString error;
+    bool written = writeSnapshot(root, error);
+    if (!written) {
+        qWarning() << "ToolRepository:" << error;
+    }
+    return written;
+}
+
+void ToolRepository::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_writerMutex);
+    while (true) {
+        m_writerCondition.wait(lock, [this]() { return m_stopWriter || m_hasPendingSnapshot; });
+        if (m_stopWriter) {
+            return;
+        }
+
+        // Only the newest snapshot is ever written; older ones were superseded
+        QJsonObject root = m_pendingSnapshot;
+        m_pendingSnapshot = QJsonObject();
+        m_hasPendingSnapshot = false;
+        m_writeInProgress = true;
+
+        lock.unlock();
+        QString error;
+        bool written = writeSnapshot(root, error);
+        lock.lock();
+
+        m_writeInProgress = false;
+        m_idleCondition.notify_all();
+
+        if (written) {
+            QMetaObject::invokeMethod(this, [this]() {
+                qDebug() << "ToolRepository: saved tool database to" << m_databasePath;
+                emit saved();
+            }, Qt::QueuedConnection);
+        } else {
+            QMetaObject::invokeMethod(this, [this, error]() {
+                qWarning() << "ToolRepository:" << error;
+                emit saveFailed(error);
+            }, Qt::QueuedConnection);
+        }
+    }
+}
+
+bool ToolRepository::writeSnapshot(const QJsonObject& root, QString& error) const
+{
+    // QSaveFile replaces the database atomically, so a crash mid-write never
+    // leaves a truncated library behind
+    QSaveFile file(m_databasePath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        error = QString("Failed to open tool database for writing: %1").arg(file.errorString());
+        return false;
+    }
+    if (file.write(QJsonDocument(root).toJson()) == -1 || !file.commit()) {
+        error = QString("Failed to write tool database: %1").arg(file.errorString());
+        return false;
+    }
+    return true;
+}
+
+} // namespace GUI
+} // namespace IntuiCAM
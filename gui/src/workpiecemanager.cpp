@@ -32,6 +32,10 @@
 #include <BRep_Tool.hxx>
 #include <TopExp.hxx>
 
+#include <IntuiCAM/Geometry/ShapeAnalysisIndex.h>
+
+using IntuiCAM::Geometry::ShapeAnalysisIndex;
+
 WorkpieceManager::WorkpieceManager(QObject *parent)
     : QObject(parent)
     , m_detectedDiameter(0.0)
@@ -173,28 +177,22 @@ void WorkpieceManager::performDetailedCylinderAnalysis(const TopoDS_Shape& shape
     }
     
     try {
-        TopExp_Explorer faceExplorer(shape, TopAbs_FACE);
+        // Face classification and bounds come from one pass over the shape
+        auto analysis = ShapeAnalysisIndex::get(shape);
         QVector<CylinderInfo> tempCylinders;
         
-        for (; faceExplorer.More(); faceExplorer.Next()) {
-            TopoDS_Face face = TopoDS::Face(faceExplorer.Current());
-            BRepAdaptor_Surface surface(face);
+        for (const ShapeAnalysisIndex::FaceInfo* face : analysis->getFaces(ShapeAnalysisIndex::SurfaceKind::Cylinder)) {
+            gp_Ax1 axis = face->axis;
+            double diameter = 2.0 * face->radius;
             
-            if (surface.GetType() == GeomAbs_Cylinder) {
-                gp_Cylinder cylinder = surface.Cylinder();
-                gp_Ax1 axis = cylinder.Axis();
-                double radius = cylinder.Radius();
-                double diameter = 2.0 * radius;
+            // Only consider cylinders with reasonable diameters (> 5mm, < 500mm)
+            if (diameter > 5.0 && diameter < 500.0) {
+                double estimatedLength = estimateCylinderLength(shape, axis);
                 
-                // Only consider cylinders with reasonable diameters (> 5mm, < 500mm)
-                if (diameter > 5.0 && diameter < 500.0) {
-                    double estimatedLength = estimateCylinderLength(shape, axis);
-                    
-                    CylinderInfo info(axis, diameter, estimatedLength);
-                    tempCylinders.append(info);
-                    
-                    qDebug() << "WorkpieceManager: Detected cylinder - Diameter:" << diameter << "mm, Length:" << estimatedLength << "mm";
-                }
+                CylinderInfo info(axis, diameter, estimatedLength);
+                tempCylinders.append(info);
+                
+                qDebug() << "WorkpieceManager: Detected cylinder - Diameter:" << diameter << "mm, Length:" << estimatedLength << "mm";
             }
         }
         
@@ -222,41 +220,13 @@ void WorkpieceManager::performDetailedCylinderAnalysis(const TopoDS_Shape& shape
 double WorkpieceManager::estimateCylinderLength(const TopoDS_Shape& workpiece, const gp_Ax1& axis)
 {
     try {
-        // Get bounding box of the workpiece
-        Bnd_Box bbox;
-        BRepBndLib::Add(workpiece, bbox);
-        
-        if (bbox.IsVoid()) {
+        // The shape's bounds are cached, so this is constant time per axis
+        auto analysis = ShapeAnalysisIndex::get(workpiece);
+        if (analysis->isEmpty()) {
             return 100.0; // Default length
         }
         
-        double xmin, ymin, zmin, xmax, ymax, zmax;
-        bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-        
-        // Calculate the bounds along the cylinder axis
-        gp_Vec axisDir = axis.Direction();
-        gp_Pnt axisLoc = axis.Location();
-        
-        // Project bounding box corners onto the axis to find extent
-        double minProjection = std::numeric_limits<double>::max();
-        double maxProjection = std::numeric_limits<double>::lowest();
-        
-        // Check all 8 corners of the bounding box
-        gp_Pnt corners[8] = {
-            gp_Pnt(xmin, ymin, zmin), gp_Pnt(xmax, ymin, zmin),
-            gp_Pnt(xmin, ymax, zmin), gp_Pnt(xmax, ymax, zmin),
-            gp_Pnt(xmin, ymin, zmax), gp_Pnt(xmax, ymin, zmax),
-            gp_Pnt(xmin, ymax, zmax), gp_Pnt(xmax, ymax, zmax)
-        };
-        
-        for (int i = 0; i < 8; i++) {
-            gp_Vec toCorner(axisLoc, corners[i]);
-            double projection = toCorner.Dot(axisDir);
-            minProjection = std::min(minProjection, projection);
-            maxProjection = std::max(maxProjection, projection);
-        }
-        
-        double length = maxProjection - minProjection;
+        double length = analysis->getAxialExtent(axis).length();
         return std::max(length, 10.0); // Minimum 10mm length
         
     } catch (const std::exception& e) {
@@ -283,33 +253,26 @@ void WorkpieceManager::analyzeCylindricalFaces(const TopoDS_Shape& shape, QVecto
 {
     // This method is kept for backward compatibility
     // The actual analysis is now done in performDetailedCylinderAnalysis
-    TopExp_Explorer faceExplorer(shape, TopAbs_FACE);
+    auto analysis = ShapeAnalysisIndex::get(shape);
     
     double largestDiameter = 0.0;
     
-    for (; faceExplorer.More(); faceExplorer.Next()) {
-        TopoDS_Face face = TopoDS::Face(faceExplorer.Current());
-        BRepAdaptor_Surface surface(face);
+    for (const ShapeAnalysisIndex::FaceInfo* face : analysis->getFaces(ShapeAnalysisIndex::SurfaceKind::Cylinder)) {
+        gp_Ax1 axis = face->axis;
+        double diameter = 2.0 * face->radius;
         
-        if (surface.GetType() == GeomAbs_Cylinder) {
-            gp_Cylinder cylinder = surface.Cylinder();
-            gp_Ax1 axis = cylinder.Axis();
-            double radius = cylinder.Radius();
-            double diameter = 2.0 * radius;
+        // Only consider cylinders with reasonable diameters (> 5mm, < 500mm)
+        if (diameter > 5.0 && diameter < 500.0) {
+            cylinders.append(axis);
             
-            // Only consider cylinders with reasonable diameters (> 5mm, < 500mm)
-            if (diameter > 5.0 && diameter < 500.0) {
-                cylinders.append(axis);
-                
-                // Track the largest diameter for main cylinder identification
-                if (diameter > largestDiameter) {
-                    largestDiameter = diameter;
-                    m_detectedDiameter = diameter;
-                }
-                
-                emit cylinderDetected(diameter, 100.0, axis); // Default length estimate
-                qDebug() << "Detected cylinder: diameter =" << diameter << "mm";
+            // Track the largest diameter for main cylinder identification
+            if (diameter > largestDiameter) {
+                largestDiameter = diameter;
+                m_detectedDiameter = diameter;
             }
+            
+            emit cylinderDetected(diameter, 100.0, axis); // Default length estimate
+            qDebug() << "Detected cylinder: diameter =" << diameter << "mm";
         }
     }
 }
@@ -500,15 +463,12 @@ double WorkpieceManager::getLocalMinZ(const TopoDS_Shape& shape) const
         return 0.0;
     }
 
-    Bnd_Box bbox;
-    BRepBndLib::Add(shape, bbox);
-    if (bbox.IsVoid()) {
+    auto analysis = ShapeAnalysisIndex::get(shape);
+    if (analysis->isEmpty()) {
         return 0.0;
     }
 
-    double xmin, ymin, zmin, xmax, ymax, zmax;
-    bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-    return zmin;
+    return analysis->getBounds().CornerMin().Z();
 }
 
 /**
@@ -532,14 +492,12 @@ double WorkpieceManager::currentMinZ() const
         if (aisShape.IsNull()) {
             continue;
         }
-        const TopoDS_Shape& shp = aisShape->Shape();
-        Bnd_Box bbox;
-        BRepBndLib::Add(shp, bbox);
-        if (bbox.IsVoid()) {
+        auto analysis = ShapeAnalysisIndex::get(aisShape->Shape());
+        if (analysis->isEmpty()) {
             continue;
         }
         double xmin, ymin, zmin, xmax, ymax, zmax;
-        bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
+        analysis->getBounds().Get(xmin, ymin, zmin, xmax, ymax, zmax);
 
         gp_Pnt corners[8] = {
             gp_Pnt(xmin, ymin, zmin), gp_Pnt(xmax, ymin, zmin),
@@ -4,6 +4,7 @@
 #include "workpiecemanager.h"
 #include "rawmaterialmanager.h"
 #include <IntuiCAM/Geometry/IStepLoader.h>
+#include <IntuiCAM/Geometry/ShapeAnalysisIndex.h>
 #include <IntuiCAM/Toolpath/ToolpathGenerationPipeline.h>
 #include <IntuiCAM/Toolpath/ToolpathDisplayObject.h>
 
@@ -1109,39 +1110,16 @@ void WorkspaceController::initializeWorkCoordinateSystem(const gp_Ax1& axis) {
         // Get the current workpiece transformation to calculate proper bounds
         gp_Trsf currentTransform = m_workpieceManager->getCurrentTransformation();
         
-        // Apply transformation to workpiece for calculation
-        TopoDS_Shape transformedWorkpiece = m_currentWorkpiece;
-        if (currentTransform.Form() != gp_Identity) {
-            BRepBuilderAPI_Transform transformer(m_currentWorkpiece, currentTransform);
-            transformedWorkpiece = transformer.Shape();
-        }
-        
-        // Calculate workpiece bounds along the axis
-        Bnd_Box bbox;
-        BRepBndLib::Add(transformedWorkpiece, bbox);
+        // The unmoved workpiece's shared analysis; the transform is applied to the extent
+        auto analysis = IntuiCAM::Geometry::ShapeAnalysisIndex::get(m_currentWorkpiece);
         
-        if (!bbox.IsVoid()) {
-            double xmin, ymin, zmin, xmax, ymax, zmax;
-            bbox.Get(xmin, ymin, zmin, xmax, ymax, zmax);
-            
+        if (!analysis->isEmpty()) {
             gp_Dir axisDir = axis.Direction();
             gp_Pnt axisLoc = axis.Location();
             
-            // Project bounding box corners to find extent along axis
-            double maxProjection = std::numeric_limits<double>::lowest();
-            
-            gp_Pnt corners[8] = {
-                gp_Pnt(xmin, ymin, zmin), gp_Pnt(xmax, ymin, zmin),
-                gp_Pnt(xmin, ymax, zmin), gp_Pnt(xmax, ymax, zmin),
-                gp_Pnt(xmin, ymin, zmax), gp_Pnt(xmax, ymin, zmax),
-                gp_Pnt(xmin, ymax, zmax), gp_Pnt(xmax, ymax, zmax)
-            };
-            
-            for (int i = 0; i < 8; i++) {
-                gp_Vec toCorner(axisLoc, corners[i]);
-                double projection = toCorner.Dot(axisDir);
-                maxProjection = std::max(maxProjection, projection);
-            }
+            // Extent of the transformed workpiece along the axis
+            IntuiCAM::Geometry::ShapeAnalysisIndex::AxialExtent extent = analysis->getAxialExtent(axis, currentTransform);
+            double maxProjection = extent.max;
             
             // Calculate raw material end position
             // Raw material extends beyond the workpiece with facing allowance